@@ -0,0 +1,438 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*-----------------------------------------------------------
+* Implementation of functions defined in portable.h for the host simulation
+* port: the firmware built with TM4C_HOST_SIM for a Linux host, on the
+* simulated board of Tools/firmware_sim.c.
+*
+* Unlike the POSIX port, which gives every task a pthread and ticks from a
+* real time signal, this port runs every task, interrupt and the tick on one
+* host thread, with a ucontext per task, and has no clock of its own.  Time
+* is the virtual clock of the board, which runs the SysTick and the
+* peripherals and calls in at every register access.  The run is the same
+* every time and goes as fast as the host can execute it.
+*
+* The port emulates the part of the Cortex-M4 exception model the kernel
+* and the drivers rely on: PRIMASK, BASEPRI, the execution priority of the
+* running handler, and PendSV.  A yield pends the PendSV, which switches once
+* neither a handler nor the masks hold it back, as on the target.
+*
+* Each task runs on a host stack of portHOST_STACK_SIZE bytes.  Its FreeRTOS
+* stack only holds the pointer to its host thread, just below pxTopOfStack,
+* so the stack high water marks of the target are not reproduced.
+*----------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#ifndef TM4C_HOST_SIM
+    #error This port runs on the simulated board, build it with TM4C_HOST_SIM defined.
+#endif
+
+#if ( configMAX_SYSCALL_INTERRUPT_PRIORITY == 0 )
+    #error configMAX_SYSCALL_INTERRUPT_PRIORITY must not be set to 0.  See http: /*www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+#endif
+
+/* The core registers are emulated by the board with the peripherals (MCAL/hw_sim.c). */
+extern volatile uint32_t * Sim_PeripheralAddress( uint32_t ulAddress );
+
+/* Constants required to manipulate the core.  Registers first... */
+#define portNVIC_SYSTICK_CTRL_REG             ( *Sim_PeripheralAddress( 0xe000e010UL ) )
+#define portNVIC_SYSTICK_LOAD_REG             ( *Sim_PeripheralAddress( 0xe000e014UL ) )
+#define portNVIC_SYSTICK_CURRENT_VALUE_REG    ( *Sim_PeripheralAddress( 0xe000e018UL ) )
+#define portNVIC_SHPR3_REG                    ( *Sim_PeripheralAddress( 0xe000ed20UL ) )
+/* ...then bits in the registers. */
+#define portNVIC_SYSTICK_CLK_BIT              ( 1UL << 2UL )
+#define portNVIC_SYSTICK_INT_BIT              ( 1UL << 1UL )
+#define portNVIC_SYSTICK_ENABLE_BIT           ( 1UL << 0UL )
+
+#define portNVIC_PENDSV_PRI                   ( ( ( uint32_t ) configKERNEL_INTERRUPT_PRIORITY ) << 16UL )
+#define portNVIC_SYSTICK_PRI                  ( ( ( uint32_t ) configKERNEL_INTERRUPT_PRIORITY ) << 24UL )
+
+/* Execution priority of thread mode, below every exception. */
+#define portTHREAD_MODE_PRIORITY              ( 0x100UL )
+
+/* Host stack of every task.  The kernel, the drivers and the board code the
+ * register accesses run all execute on it. */
+#define portHOST_STACK_SIZE                   ( 64UL * 1024UL )
+
+/* The SysTick runs from the core clock as on the target. */
+#ifndef configSYSTICK_CLOCK_HZ
+    #define configSYSTICK_CLOCK_HZ             ( configCPU_CLOCK_HZ )
+    #define portNVIC_SYSTICK_CLK_BIT_CONFIG    ( portNVIC_SYSTICK_CLK_BIT )
+#else
+    #define portNVIC_SYSTICK_CLK_BIT_CONFIG    ( 0 )
+#endif
+
+/* A host thread, one per task. */
+typedef struct HostThread
+{
+    ucontext_t xContext;
+    TaskFunction_t pxCode;
+    void * pvParameters;
+    void * pvStack;
+} HostThread_t;
+
+/*
+ * Setup the timer to generate the tick interrupts.
+ */
+void vPortSetupTimerInterrupt( void );
+
+/*
+ * Exception handlers.
+ */
+void xPortSysTickHandler( void );
+
+/*
+ * Used to catch tasks that attempt to return from their implementing function.
+ */
+static void prvTaskExitError( void );
+
+/*
+ * First function of every host thread, calls the task function.
+ */
+static void prvTaskStart( void );
+
+/*
+ * The PendSV handler.
+ */
+static void prvSwitchContext( void );
+
+/*-----------------------------------------------------------*/
+
+/* Each task maintains its own interrupt status in the critical nesting
+ * variable. */
+static UBaseType_t uxCriticalNesting = 0xaaaaaaaa;
+
+/* Emulated core state. */
+static volatile uint32_t ulBASEPRI = 0;
+static volatile uint32_t ulPRIMASK = 0;
+static volatile uint32_t ulActivePriority = portTHREAD_MODE_PRIORITY;
+static volatile BaseType_t xPendSVPending = pdFALSE;
+
+/* The context vTaskStartScheduler was called from. */
+static ucontext_t xSchedulerContext;
+
+/*-----------------------------------------------------------*/
+
+/* The host thread of a task: pxTopOfStack, the first member of the TCB,
+ * points at the pointer pxPortInitialiseStack() left there. */
+static HostThread_t * prvThreadOf( void * pvTCB )
+{
+    HostThread_t * pxThread;
+
+    memcpy( &pxThread, *( ( StackType_t * const * ) pvTCB ), sizeof( pxThread ) );
+
+    return pxThread;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
+                                     TaskFunction_t pxCode,
+                                     void * pvParameters )
+{
+    HostThread_t * pxThread;
+
+    pxThread = ( HostThread_t * ) malloc( sizeof( HostThread_t ) );
+
+    if( pxThread != NULL )
+    {
+        pxThread->pvStack = malloc( portHOST_STACK_SIZE );
+    }
+
+    if( ( pxThread == NULL ) || ( pxThread->pvStack == NULL ) )
+    {
+        fprintf( stderr, "port: no host memory for the stack of a new task\n" );
+        abort();
+    }
+
+    pxThread->pxCode = pxCode;
+    pxThread->pvParameters = pvParameters;
+    ( void ) getcontext( &( pxThread->xContext ) );
+    pxThread->xContext.uc_stack.ss_sp = pxThread->pvStack;
+    pxThread->xContext.uc_stack.ss_size = portHOST_STACK_SIZE;
+    pxThread->xContext.uc_link = NULL;
+    makecontext( &( pxThread->xContext ), prvTaskStart, 0 );
+
+    /* The pointer takes two stack words, the last of them is the top. */
+    pxTopOfStack -= ( sizeof( pxThread ) / sizeof( StackType_t ) ) - 1U;
+    memcpy( pxTopOfStack, &pxThread, sizeof( pxThread ) );
+
+    return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTaskStart( void )
+{
+    HostThread_t * pxThread = prvThreadOf( xTaskGetCurrentTaskHandle() );
+
+    pxThread->pxCode( pxThread->pvParameters );
+
+    prvTaskExitError();
+}
+/*-----------------------------------------------------------*/
+
+static void prvTaskExitError( void )
+{
+    /* A function that implements a task must not exit or attempt to return to
+     * its caller as there is nothing to return to.  If a task wants to exit it
+     * should instead call vTaskDelete( NULL ).
+     *
+     * Artificially force an assert() to be triggered if configASSERT() is
+     * defined, the host configASSERT() ends the simulation. */
+    configASSERT( uxCriticalNesting == ~0UL );
+    fprintf( stderr, "port: a task returned from its function\n" );
+    abort();
+}
+/*-----------------------------------------------------------*/
+
+void vPortCleanUpTCB( void * pvTCB )
+{
+    HostThread_t * pxThread = prvThreadOf( pvTCB );
+
+    /* Only called for a task that is not running, its host stack is free. */
+    free( pxThread->pvStack );
+    free( pxThread );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+BaseType_t xPortStartScheduler( void )
+{
+    /* Make PendSV and SysTick the lowest priority interrupts. */
+    portNVIC_SHPR3_REG |= portNVIC_PENDSV_PRI;
+    portNVIC_SHPR3_REG |= portNVIC_SYSTICK_PRI;
+
+    /* Start the timer that generates the tick ISR.  Interrupts are disabled
+     * here already. */
+    vPortSetupTimerInterrupt();
+
+    /* Initialise the critical nesting count ready for the first task. */
+    uxCriticalNesting = 0;
+
+    /* Start the first task, with the interrupts unmasked as the SVC handler
+     * of the target leaves them. */
+    ulBASEPRI = 0;
+    ( void ) swapcontext( &xSchedulerContext, &( prvThreadOf( xTaskGetCurrentTaskHandle() )->xContext ) );
+
+    /* Should not get here! */
+    return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+    /* Not implemented in ports where there is nothing to return to, the
+     * simulation ends by exiting the host process.  Artificially force an
+     * assert. */
+    configASSERT( uxCriticalNesting == 1000UL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+    portDISABLE_INTERRUPTS();
+    uxCriticalNesting++;
+
+    /* This is not the interrupt safe version of the enter critical function so
+     * assert() if it is being called from an interrupt context.  Only API
+     * functions that end in "FromISR" can be used in an interrupt.  Only assert if
+     * the critical nesting count is 1 to protect against recursive calls if the
+     * assert function also uses a critical section. */
+    if( uxCriticalNesting == 1 )
+    {
+        configASSERT( ulActivePriority == portTHREAD_MODE_PRIORITY );
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+    configASSERT( uxCriticalNesting );
+    uxCriticalNesting--;
+
+    if( uxCriticalNesting == 0 )
+    {
+        portENABLE_INTERRUPTS();
+    }
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulPortRaiseBASEPRI( void )
+{
+    uint32_t ulOriginalBASEPRI = ulBASEPRI;
+
+    ulBASEPRI = configMAX_SYSCALL_INTERRUPT_PRIORITY;
+
+    return ulOriginalBASEPRI;
+}
+/*-----------------------------------------------------------*/
+
+void vPortSetBASEPRI( uint32_t ulNewMaskValue )
+{
+    ulBASEPRI = ulNewMaskValue;
+
+    /* Whatever the mask held back runs now. */
+    vPortSimInterruptPoint();
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+    /* Set a PendSV to request a context switch. */
+    xPendSVPending = pdTRUE;
+    vPortSimInterruptPoint();
+}
+/*-----------------------------------------------------------*/
+
+void xPortSysTickHandler( void )
+{
+    /* The SysTick runs at the lowest interrupt priority, so when this interrupt
+     * executes all interrupts must be unmasked.  There is therefore no need to
+     * save and then restore the interrupt mask value as its value is already
+     * known. */
+    ( void ) portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        /* Increment the RTOS tick. */
+        if( xTaskIncrementTick() != pdFALSE )
+        {
+            /* A context switch is required.  Context switching is performed in
+             * the PendSV interrupt.  Pend the PendSV interrupt. */
+            xPendSVPending = pdTRUE;
+        }
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR( 0 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchContext( void )
+{
+    HostThread_t * pxFrom;
+    HostThread_t * pxTo;
+
+    /* Runs as the PendSV handler, at the kernel priority with BASEPRI raised
+     * around the selection like the target one. */
+    xPendSVPending = pdFALSE;
+    ulActivePriority = configKERNEL_INTERRUPT_PRIORITY;
+    pxFrom = prvThreadOf( xTaskGetCurrentTaskHandle() );
+
+    ( void ) ulPortRaiseBASEPRI();
+    vTaskSwitchContext();
+    ulBASEPRI = 0;
+
+    pxTo = prvThreadOf( xTaskGetCurrentTaskHandle() );
+    ulActivePriority = portTHREAD_MODE_PRIORITY;
+
+    if( pxFrom != pxTo )
+    {
+        /* Returns once the task is switched in again, in thread mode with
+         * nothing masked as it left. */
+        ( void ) swapcontext( &( pxFrom->xContext ), &( pxTo->xContext ) );
+    }
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulPortSimExecutionPriority( void )
+{
+    uint32_t ulPriority = ulActivePriority;
+
+    if( ( ulBASEPRI != 0 ) && ( ulBASEPRI < ulPriority ) )
+    {
+        ulPriority = ulBASEPRI;
+    }
+
+    if( ulPRIMASK != 0 )
+    {
+        ulPriority = 0;
+    }
+
+    return ulPriority;
+}
+/*-----------------------------------------------------------*/
+
+void vPortSimSetPRIMASK( uint32_t ulMasked )
+{
+    ulPRIMASK = ulMasked;
+
+    if( ulMasked == 0 )
+    {
+        vPortSimInterruptPoint();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortSimRunHandler( void ( * pxHandler )( void ),
+                         uint32_t ulPriority )
+{
+    uint32_t ulInterruptedPriority = ulActivePriority;
+
+    ulActivePriority = ulPriority;
+    pxHandler();
+    ulActivePriority = ulInterruptedPriority;
+}
+/*-----------------------------------------------------------*/
+
+void vPortSimInterruptPoint( void )
+{
+    vApplicationSimTakeInterrupts();
+
+    /* PendSV has the lowest priority, it waits for every other handler. */
+    if( ( xPendSVPending != pdFALSE ) && ( ulPortSimExecutionPriority() > configKERNEL_INTERRUPT_PRIORITY ) )
+    {
+        prvSwitchContext();
+    }
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Setup the systick timer to generate the tick interrupts at the required
+ * frequency.
+ */
+void vPortSetupTimerInterrupt( void )
+{
+    /* Stop and clear the SysTick. */
+    portNVIC_SYSTICK_CTRL_REG = 0UL;
+    portNVIC_SYSTICK_CURRENT_VALUE_REG = 0UL;
+
+    /* Configure SysTick to interrupt at the requested rate. */
+    portNVIC_SYSTICK_LOAD_REG = ( configSYSTICK_CLOCK_HZ / configTICK_RATE_HZ ) - 1UL;
+    portNVIC_SYSTICK_CTRL_REG = ( portNVIC_SYSTICK_CLK_BIT_CONFIG | portNVIC_SYSTICK_INT_BIT | portNVIC_SYSTICK_ENABLE_BIT );
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,181 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+
+#ifndef PORTMACRO_H
+    #define PORTMACRO_H
+
+    #ifdef __cplusplus
+        extern "C" {
+    #endif
+
+/*-----------------------------------------------------------
+ * Port specific definitions.
+ *
+ * The settings in this file configure FreeRTOS correctly for the
+ * host simulation of the TM4C123GH6PM (see port.c), built with GCC for a
+ * 64-bit Linux host.
+ *
+ * These settings should not be altered.
+ *-----------------------------------------------------------
+ */
+
+/* Type definitions.  The stack stays in 32-bit words as on the target, so the
+ * stack depths of the application mean the same number of words. */
+    #define portCHAR                 char
+    #define portFLOAT                float
+    #define portDOUBLE               double
+    #define portLONG                 long
+    #define portSHORT                short
+    #define portSTACK_TYPE           uint32_t
+    #define portBASE_TYPE            long
+    #define portPOINTER_SIZE_TYPE    uintptr_t
+
+    typedef portSTACK_TYPE   StackType_t;
+    typedef long             BaseType_t;
+    typedef unsigned long    UBaseType_t;
+
+    #if ( configUSE_16_BIT_TICKS == 1 )
+        typedef uint16_t     TickType_t;
+        #define portMAX_DELAY              ( TickType_t ) 0xffff
+    #else
+        typedef uint32_t     TickType_t;
+        #define portMAX_DELAY              ( TickType_t ) 0xffffffffUL
+
+/* Every task, interrupt and the tick run on one host thread, a read of the
+ * tick count is never interrupted half way. */
+        #define portTICK_TYPE_IS_ATOMIC    1
+    #endif
+/*-----------------------------------------------------------*/
+
+/* Architecture specifics. */
+    #define portSTACK_GROWTH      ( -1 )
+    #define portTICK_PERIOD_MS    ( ( TickType_t ) 1000 / configTICK_RATE_HZ )
+    #define portBYTE_ALIGNMENT    8
+/*-----------------------------------------------------------*/
+
+/* Scheduler utilities.  A yield pends the emulated PendSV, which switches
+ * as soon as the execution priority lets it, as on the target. */
+    extern void vPortYield( void );
+
+    #define portYIELD()                                 vPortYield()
+    #define portEND_SWITCHING_ISR( xSwitchRequired )    do { if( xSwitchRequired != pdFALSE ) portYIELD(); } while( 0 )
+    #define portYIELD_FROM_ISR( x )                     portEND_SWITCHING_ISR( x )
+
+/*-----------------------------------------------------------*/
+
+/* Architecture specific optimisations. */
+    #ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+        #define configUSE_PORT_OPTIMISED_TASK_SELECTION    1
+    #endif
+
+    #if configUSE_PORT_OPTIMISED_TASK_SELECTION == 1
+
+/* Check the configuration. */
+        #if ( configMAX_PRIORITIES > 32 )
+            #error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 32.  It is very rare that a system requires more than 10 to 15 difference priorities as tasks that share a priority will time slice.
+        #endif
+
+/* Store/clear the ready priorities in a bit map. */
+        #define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities )    ( uxReadyPriorities ) |= ( 1UL << ( uxPriority ) )
+        #define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities )     ( uxReadyPriorities ) &= ~( 1UL << ( uxPriority ) )
+
+/*-----------------------------------------------------------*/
+
+        #define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities )    uxTopPriority = ( 31 - __builtin_clz( ( unsigned int ) ( uxReadyPriorities ) ) )
+
+    #endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+/*-----------------------------------------------------------*/
+
+/* Critical section management.  BASEPRI is emulated, the interrupts it held
+ * back are taken when it is lowered again. */
+    extern void vPortEnterCritical( void );
+    extern void vPortExitCritical( void );
+    extern uint32_t ulPortRaiseBASEPRI( void );
+    extern void vPortSetBASEPRI( uint32_t ulNewMaskValue );
+
+    #define portDISABLE_INTERRUPTS()                  ( void ) ulPortRaiseBASEPRI()
+    #define portENABLE_INTERRUPTS()                   vPortSetBASEPRI( 0 )
+    #define portENTER_CRITICAL()                      vPortEnterCritical()
+    #define portEXIT_CRITICAL()                       vPortExitCritical()
+    #define portSET_INTERRUPT_MASK_FROM_ISR()         ulPortRaiseBASEPRI()
+    #define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )    vPortSetBASEPRI( x )
+/*-----------------------------------------------------------*/
+
+/* Tickless idle/low power functionality.  The application brings its own
+ * (LowPower_SuppressTicksAndSleep), this port has no default one. */
+    #if ( configUSE_TICKLESS_IDLE != 0 ) && !defined( portSUPPRESS_TICKS_AND_SLEEP )
+        #error The host simulation port needs portSUPPRESS_TICKS_AND_SLEEP from FreeRTOSConfig.h when configUSE_TICKLESS_IDLE is set
+    #endif
+
+/*-----------------------------------------------------------*/
+
+/* Task function macros as described on the FreeRTOS.org WEB site.  These are
+ * not necessary for to use this port.  They are defined so the common demo files
+ * (which build with all the ports) will build. */
+    #define portTASK_FUNCTION_PROTO( vFunction, pvParameters )    void vFunction( void * pvParameters )
+    #define portTASK_FUNCTION( vFunction, pvParameters )          void vFunction( void * pvParameters )
+/*-----------------------------------------------------------*/
+
+/* Frees the host thread of a deleted task. */
+    extern void vPortCleanUpTCB( void * pvTCB );
+    #define portCLEAN_UP_TCB( pxTCB )    vPortCleanUpTCB( pxTCB )
+
+/* portNOP() is not required by this port. */
+    #define portNOP()
+
+    #define portMEMORY_BARRIER()    __asm volatile ( "" ::: "memory" )
+
+/*-----------------------------------------------------------*/
+
+/* The emulated Cortex-M4 exception model, used by the simulated board that
+ * owns the peripherals, the NVIC and the virtual clock (Tools/firmware_sim.c).
+ * Priorities are NVIC priority values, lower is more urgent. */
+
+/* Priority an exception must be below to be taken now, 0 while PRIMASK is set */
+    extern uint32_t ulPortSimExecutionPriority( void );
+
+/* PRIMASK, set by "cpsid i" and cleared by "cpsie i" on the target */
+    extern void vPortSimSetPRIMASK( uint32_t ulMasked );
+
+/* Runs an exception handler at its priority, the board decided it preempts */
+    extern void vPortSimRunHandler( void ( * pxHandler )( void ), uint32_t ulPriority );
+
+/* An instruction boundary: takes the pending exceptions the execution
+ * priority allows, the PendSV context switch last */
+    extern void vPortSimInterruptPoint( void );
+
+/* Board side of vPortSimInterruptPoint: runs every pending interrupt that
+ * preempts the current execution priority, highest priority first */
+    extern void vApplicationSimTakeInterrupts( void );
+
+    #ifdef __cplusplus
+        }
+    #endif
+
+#endif /* PORTMACRO_H */
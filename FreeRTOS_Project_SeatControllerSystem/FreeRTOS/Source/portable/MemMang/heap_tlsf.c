@@ -0,0 +1,573 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * An implementation of pvPortMalloc() and vPortFree() on a two-level segregated
+ * fit (TLSF) allocator, built instead of heap_2.c when configUSE_HEAP_TLSF is 1
+ * in FreeRTOSConfig.h.
+ *
+ * Free blocks are kept in one list per size class.  The first level is the
+ * power of two of the size, the second level splits it into heapSL_INDEX_COUNT
+ * equal ranges, and blocks below heapSMALL_BLOCK_SIZE get one class per
+ * portBYTE_ALIGNMENT step.  A bitmap per level marks the non-empty lists, so
+ * finding a block takes two count-leading-zeros whatever the number of free
+ * blocks, and malloc and free run in constant time.
+ *
+ * A request is rounded up to the next class before the search, so the head of
+ * any list found fits it, and the rest of the block goes back as a free block.
+ * Every block header holds its size and the block just below it in memory, so a
+ * freed block is merged with both free neighbours at once: two free blocks are
+ * never adjacent.
+ *
+ * The block header is two words like the heap_2.c one, the list heads and
+ * bitmaps take heapFL_INDEX_COUNT * ( heapSL_INDEX_COUNT + 1 ) + 1 words of
+ * .bss (364 bytes).  Tools/heap_bench.c compares it with heap_2.c on random
+ * traces.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c and heap_4.c for alternative
+ * implementations, and the memory management pages of https://www.FreeRTOS.org
+ * for more information.
+ */
+#include <stddef.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* The project builds every source file, only the selected heap is compiled. */
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_HEAP_TLSF == 1 ) )
+
+#ifndef configHEAP_CLEAR_MEMORY_ON_FREE
+    #define configHEAP_CLEAR_MEMORY_ON_FREE    0
+#endif
+
+/* Max value that fits in a size_t type. */
+#define heapSIZE_MAX                          ( ~( ( size_t ) 0 ) )
+
+/* Check if multiplying a and b will result in overflow. */
+#define heapMULTIPLY_WILL_OVERFLOW( a, b )    ( ( ( a ) > 0 ) && ( ( b ) > ( heapSIZE_MAX / ( a ) ) ) )
+
+/* Size classes: 2^heapSL_INDEX_LOG2 second-level lists per power of two, one
+ * class per alignment step below heapSMALL_BLOCK_SIZE, blocks below
+ * 2^heapFL_INDEX_MAX bytes. */
+#define heapALIGNMENT_LOG2                    ( 3U )
+#define heapSL_INDEX_LOG2                     ( 3U )
+#define heapSL_INDEX_COUNT                    ( 1U << heapSL_INDEX_LOG2 )
+#define heapFL_INDEX_SHIFT                    ( heapSL_INDEX_LOG2 + heapALIGNMENT_LOG2 )
+#define heapFL_INDEX_MAX                      ( 15U )
+#define heapFL_INDEX_COUNT                    ( heapFL_INDEX_MAX - heapFL_INDEX_SHIFT + 1U )
+#define heapSMALL_BLOCK_SIZE                  ( ( size_t ) 1 << heapFL_INDEX_SHIFT )
+
+/* The low bit of a block size is set while the block is free, sizes are
+ * multiples of portBYTE_ALIGNMENT. */
+#define heapBLOCK_FREE_BIT                    ( ( size_t ) 1 )
+#define heapBLOCK_SIZE( pxBlock )             ( ( pxBlock )->xBlockSize & ~heapBLOCK_FREE_BIT )
+#define heapBLOCK_IS_FREE( pxBlock )          ( ( ( pxBlock )->xBlockSize & heapBLOCK_FREE_BIT ) != 0 )
+#define heapNEXT_PHYSICAL_BLOCK( pxBlock )    ( ( TlsfBlock_t * ) ( ( ( uint8_t * ) ( pxBlock ) ) + heapBLOCK_SIZE( pxBlock ) ) )
+
+#define heapALIGN_UP( xSize )                 ( ( ( xSize ) + portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/* Index of the highest set bit of a non-zero 32-bit value, and of the lowest. */
+#if defined( __TI_ARM__ )
+    #define heapFLS( ulValue )    ( ( UBaseType_t ) ( 31 - __clz( ulValue ) ) )
+#elif defined( __GNUC__ )
+    #define heapFLS( ulValue )    ( ( UBaseType_t ) ( 31 - __builtin_clz( ulValue ) ) )
+#else
+    #define heapFLS( ulValue )    prvFls( ulValue )
+#endif
+#define heapFFS( ulValue )        heapFLS( ( ulValue ) & ( ~( ulValue ) + 1U ) )
+
+/*-----------------------------------------------------------*/
+
+/* Allocate the memory for the heap. */
+#if ( configAPPLICATION_ALLOCATED_HEAP == 1 )
+
+/* The application writer has already defined the array used for the RTOS
+* heap - probably so it can be placed in a special segment or address. */
+    extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#else
+    PRIVILEGED_DATA static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#endif /* configAPPLICATION_ALLOCATED_HEAP */
+
+/* Every block starts with the first two members, a free block uses the
+ * first bytes it would hand out for the free list links. */
+typedef struct TLSF_BLOCK
+{
+    struct TLSF_BLOCK * pxPrevPhysicalBlock; /*<< The block just below in memory, NULL for the first block. */
+    size_t xBlockSize;                       /*<< The whole block with its header, heapBLOCK_FREE_BIT while free. */
+    struct TLSF_BLOCK * pxNextFreeBlock;     /*<< The next block of the same size class, free blocks only. */
+    struct TLSF_BLOCK * pxPrevFreeBlock;     /*<< The previous block of the same size class, free blocks only. */
+} TlsfBlock_t;
+
+#define heapHEADER_SIZE           heapALIGN_UP( offsetof( TlsfBlock_t, pxNextFreeBlock ) )
+#define heapMINIMUM_BLOCK_SIZE    heapALIGN_UP( sizeof( TlsfBlock_t ) )
+
+/* The size classes must match the alignment, each bitmap must fit a word and
+ * every block size of the heap a first-level list. */
+typedef char heapAlignmentMatchesPort[ ( ( 1U << heapALIGNMENT_LOG2 ) == portBYTE_ALIGNMENT ) ? 1 : -1 ];
+typedef char heapFirstLevelFitsWord[ ( heapFL_INDEX_COUNT < 32U ) ? 1 : -1 ];
+typedef char heapSecondLevelFitsWord[ ( heapSL_INDEX_COUNT <= 32U ) ? 1 : -1 ];
+typedef char heapSizeFitsFirstLevel[ ( configTOTAL_HEAP_SIZE < ( ( size_t ) 1 << heapFL_INDEX_MAX ) ) ? 1 : -1 ];
+
+/* Heads of the free lists and the bitmaps of the non-empty ones. */
+PRIVILEGED_DATA static TlsfBlock_t * pxFreeLists[ heapFL_INDEX_COUNT ][ heapSL_INDEX_COUNT ];
+PRIVILEGED_DATA static uint32_t ulFirstLevelBitmap = 0;
+PRIVILEGED_DATA static uint32_t ulSecondLevelBitmaps[ heapFL_INDEX_COUNT ];
+
+/* The zero-sized allocated block closing the heap, NULL until the first call. */
+PRIVILEGED_DATA static TlsfBlock_t * pxHeapEnd = NULL;
+
+/* Keeps track of the number of free bytes remaining, and of the lowest it has
+ * been, but says nothing about fragmentation. */
+PRIVILEGED_DATA static size_t xFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulAllocations = 0;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulFrees = 0;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Initialises the heap structures before their first use.
+ */
+static void prvHeapInit( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Size class of a block, the first and second level list indexes.
+ */
+static void prvMapSize( size_t xSize,
+                        UBaseType_t * puxFirst,
+                        UBaseType_t * puxSecond ) PRIVILEGED_FUNCTION;
+
+/*
+ * Insert a free block at the head of the list of its size class, or take one
+ * out of it.
+ */
+static void prvInsertFreeBlock( TlsfBlock_t * pxBlock ) PRIVILEGED_FUNCTION;
+static void prvRemoveFreeBlock( TlsfBlock_t * pxBlock ) PRIVILEGED_FUNCTION;
+
+/*
+ * A free block of at least xSize bytes, NULL if there is none.
+ */
+static TlsfBlock_t * prvFindFreeBlock( size_t xSize ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+#if !defined( __TI_ARM__ ) && !defined( __GNUC__ )
+    static UBaseType_t prvFls( uint32_t ulValue )
+    {
+        UBaseType_t uxBit = 0;
+
+        while( ( ulValue >>= 1 ) != 0U )
+        {
+            uxBit++;
+        }
+
+        return uxBit;
+    }
+#endif
+/*-----------------------------------------------------------*/
+
+static void prvMapSize( size_t xSize,
+                        UBaseType_t * puxFirst,
+                        UBaseType_t * puxSecond )
+{
+    UBaseType_t uxHighestBit;
+
+    if( xSize < heapSMALL_BLOCK_SIZE )
+    {
+        *puxFirst = 0;
+        *puxSecond = ( UBaseType_t ) ( xSize >> heapALIGNMENT_LOG2 );
+    }
+    else
+    {
+        uxHighestBit = heapFLS( ( uint32_t ) xSize );
+        *puxFirst = uxHighestBit - ( heapFL_INDEX_SHIFT - 1U );
+        *puxSecond = ( UBaseType_t ) ( ( xSize >> ( uxHighestBit - heapSL_INDEX_LOG2 ) ) ^ heapSL_INDEX_COUNT );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( TlsfBlock_t * pxBlock )
+{
+    UBaseType_t uxFirst;
+    UBaseType_t uxSecond;
+
+    prvMapSize( heapBLOCK_SIZE( pxBlock ), &uxFirst, &uxSecond );
+
+    pxBlock->xBlockSize |= heapBLOCK_FREE_BIT;
+    pxBlock->pxPrevFreeBlock = NULL;
+    pxBlock->pxNextFreeBlock = pxFreeLists[ uxFirst ][ uxSecond ];
+
+    if( pxBlock->pxNextFreeBlock != NULL )
+    {
+        pxBlock->pxNextFreeBlock->pxPrevFreeBlock = pxBlock;
+    }
+
+    pxFreeLists[ uxFirst ][ uxSecond ] = pxBlock;
+    ulFirstLevelBitmap |= ( 1UL << uxFirst );
+    ulSecondLevelBitmaps[ uxFirst ] |= ( 1UL << uxSecond );
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( TlsfBlock_t * pxBlock )
+{
+    UBaseType_t uxFirst;
+    UBaseType_t uxSecond;
+
+    prvMapSize( heapBLOCK_SIZE( pxBlock ), &uxFirst, &uxSecond );
+
+    if( pxBlock->pxNextFreeBlock != NULL )
+    {
+        pxBlock->pxNextFreeBlock->pxPrevFreeBlock = pxBlock->pxPrevFreeBlock;
+    }
+
+    if( pxBlock->pxPrevFreeBlock != NULL )
+    {
+        pxBlock->pxPrevFreeBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+    }
+    else
+    {
+        /* The block was the head of its list, the list may now be empty. */
+        pxFreeLists[ uxFirst ][ uxSecond ] = pxBlock->pxNextFreeBlock;
+
+        if( pxBlock->pxNextFreeBlock == NULL )
+        {
+            ulSecondLevelBitmaps[ uxFirst ] &= ~( 1UL << uxSecond );
+
+            if( ulSecondLevelBitmaps[ uxFirst ] == 0U )
+            {
+                ulFirstLevelBitmap &= ~( 1UL << uxFirst );
+            }
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static TlsfBlock_t * prvFindFreeBlock( size_t xSize )
+{
+    UBaseType_t uxFirst;
+    UBaseType_t uxSecond;
+    uint32_t ulBitmap;
+
+    /* Round up to the next class, every block of the list found is then large
+     * enough and the head can be taken without walking the list. */
+    if( xSize >= heapSMALL_BLOCK_SIZE )
+    {
+        xSize += ( ( size_t ) 1 << ( heapFLS( ( uint32_t ) xSize ) - heapSL_INDEX_LOG2 ) ) - 1U;
+    }
+
+    prvMapSize( xSize, &uxFirst, &uxSecond );
+
+    if( uxFirst >= heapFL_INDEX_COUNT )
+    {
+        return NULL;
+    }
+
+    /* A list of this first level at or above the class, else the smallest
+     * list of a larger first level. */
+    ulBitmap = ulSecondLevelBitmaps[ uxFirst ] & ( ~0UL << uxSecond );
+
+    if( ulBitmap == 0U )
+    {
+        ulBitmap = ulFirstLevelBitmap & ( ~0UL << ( uxFirst + 1U ) );
+
+        if( ulBitmap == 0U )
+        {
+            return NULL;
+        }
+
+        uxFirst = heapFFS( ulBitmap );
+        ulBitmap = ulSecondLevelBitmaps[ uxFirst ];
+    }
+
+    uxSecond = heapFFS( ulBitmap );
+
+    return pxFreeLists[ uxFirst ][ uxSecond ];
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortMalloc( size_t xWantedSize )
+{
+    TlsfBlock_t * pxBlock;
+    TlsfBlock_t * pxRemainder;
+    void * pvReturn = NULL;
+    size_t xBlockSize = 0;
+
+    vTaskSuspendAll();
+    {
+        /* If this is the first call to malloc then the heap will require
+         * initialisation to setup the list of free blocks. */
+        if( pxHeapEnd == NULL )
+        {
+            prvHeapInit();
+        }
+
+        /* Nothing larger than the heap can fit, which also keeps the size
+         * calculations below from overflowing. */
+        if( ( xWantedSize > 0 ) && ( xWantedSize <= configTOTAL_HEAP_SIZE ) )
+        {
+            /* The block holds the header and the requested bytes, rounded up
+             * to the alignment, and must hold the free list links once freed. */
+            xBlockSize = heapALIGN_UP( xWantedSize + heapHEADER_SIZE );
+
+            if( xBlockSize < heapMINIMUM_BLOCK_SIZE )
+            {
+                xBlockSize = heapMINIMUM_BLOCK_SIZE;
+            }
+
+            pxBlock = prvFindFreeBlock( xBlockSize );
+
+            if( pxBlock != NULL )
+            {
+                prvRemoveFreeBlock( pxBlock );
+
+                /* If the block is larger than required the rest goes back to
+                 * the free lists.  It cannot have a free neighbour above, the
+                 * block it came from had none. */
+                if( ( heapBLOCK_SIZE( pxBlock ) - xBlockSize ) >= heapMINIMUM_BLOCK_SIZE )
+                {
+                    pxRemainder = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xBlockSize );
+                    pxRemainder->pxPrevPhysicalBlock = pxBlock;
+                    pxRemainder->xBlockSize = heapBLOCK_SIZE( pxBlock ) - xBlockSize;
+                    heapNEXT_PHYSICAL_BLOCK( pxRemainder )->pxPrevPhysicalBlock = pxRemainder;
+                    pxBlock->xBlockSize = xBlockSize;
+                    prvInsertFreeBlock( pxRemainder );
+                }
+
+                /* The block is being returned - it is allocated and owned
+                 * by the application. */
+                pxBlock->xBlockSize = heapBLOCK_SIZE( pxBlock );
+                xBlockSize = pxBlock->xBlockSize;
+                xFreeBytesRemaining -= xBlockSize;
+                xNumberOfSuccessfulAllocations++;
+
+                if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+                {
+                    xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                }
+
+                pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + heapHEADER_SIZE );
+            }
+        }
+
+        /* Reports the bytes taken from the heap like heap_2.c does. */
+        traceMALLOC( pvReturn, xBlockSize );
+    }
+    ( void ) xTaskResumeAll();
+
+    #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
+    {
+        if( pvReturn == NULL )
+        {
+            vApplicationMallocFailedHook();
+        }
+    }
+    #endif
+
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+    TlsfBlock_t * pxBlock;
+    TlsfBlock_t * pxNeighbour;
+
+    if( pv != NULL )
+    {
+        /* The memory being freed will have the block header immediately
+         * before it. */
+        pxBlock = ( void * ) ( ( ( uint8_t * ) pv ) - heapHEADER_SIZE );
+
+        configASSERT( heapBLOCK_IS_FREE( pxBlock ) == 0 );
+        configASSERT( pxBlock->xBlockSize >= heapMINIMUM_BLOCK_SIZE );
+
+        if( ( heapBLOCK_IS_FREE( pxBlock ) == 0 ) && ( pxBlock->xBlockSize >= heapMINIMUM_BLOCK_SIZE ) )
+        {
+            #if ( configHEAP_CLEAR_MEMORY_ON_FREE == 1 )
+            {
+                ( void ) memset( pv, 0, pxBlock->xBlockSize - heapHEADER_SIZE );
+            }
+            #endif
+
+            vTaskSuspendAll();
+            {
+                xFreeBytesRemaining += pxBlock->xBlockSize;
+                xNumberOfSuccessfulFrees++;
+                traceFREE( pv, pxBlock->xBlockSize );
+
+                /* Merge with the free block below, it then starts the block. */
+                pxNeighbour = pxBlock->pxPrevPhysicalBlock;
+
+                if( ( pxNeighbour != NULL ) && ( heapBLOCK_IS_FREE( pxNeighbour ) != 0 ) )
+                {
+                    prvRemoveFreeBlock( pxNeighbour );
+                    pxNeighbour->xBlockSize = heapBLOCK_SIZE( pxNeighbour ) + pxBlock->xBlockSize;
+                    pxBlock = pxNeighbour;
+                }
+
+                /* Merge with the free block above, the heap end block never is. */
+                pxNeighbour = heapNEXT_PHYSICAL_BLOCK( pxBlock );
+
+                if( heapBLOCK_IS_FREE( pxNeighbour ) != 0 )
+                {
+                    prvRemoveFreeBlock( pxNeighbour );
+                    pxBlock->xBlockSize = heapBLOCK_SIZE( pxBlock ) + heapBLOCK_SIZE( pxNeighbour );
+                }
+
+                heapNEXT_PHYSICAL_BLOCK( pxBlock )->pxPrevPhysicalBlock = pxBlock;
+                prvInsertFreeBlock( pxBlock );
+            }
+            ( void ) xTaskResumeAll();
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+    return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+    return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t * pxHeapStats )
+{
+    TlsfBlock_t * pxBlock;
+    UBaseType_t uxFirst;
+    UBaseType_t uxSecond;
+    size_t xBlocks = 0, xMaxSize = 0, xMinSize = heapSIZE_MAX;
+
+    vTaskSuspendAll();
+    {
+        for( uxFirst = 0; uxFirst < heapFL_INDEX_COUNT; uxFirst++ )
+        {
+            for( uxSecond = 0; uxSecond < heapSL_INDEX_COUNT; uxSecond++ )
+            {
+                for( pxBlock = pxFreeLists[ uxFirst ][ uxSecond ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+                {
+                    xBlocks++;
+
+                    if( heapBLOCK_SIZE( pxBlock ) > xMaxSize )
+                    {
+                        xMaxSize = heapBLOCK_SIZE( pxBlock );
+                    }
+
+                    if( heapBLOCK_SIZE( pxBlock ) < xMinSize )
+                    {
+                        xMinSize = heapBLOCK_SIZE( pxBlock );
+                    }
+                }
+            }
+        }
+    }
+    ( void ) xTaskResumeAll();
+
+    pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+    pxHeapStats->xSizeOfSmallestFreeBlockInBytes = ( xBlocks != 0 ) ? xMinSize : 0;
+    pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+
+    taskENTER_CRITICAL();
+    {
+        pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+        pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+        pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+        pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+    /* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortCalloc( size_t xNum,
+                     size_t xSize )
+{
+    void * pv = NULL;
+
+    if( heapMULTIPLY_WILL_OVERFLOW( xNum, xSize ) == 0 )
+    {
+        pv = pvPortMalloc( xNum * xSize );
+
+        if( pv != NULL )
+        {
+            ( void ) memset( pv, 0, xNum * xSize );
+        }
+    }
+
+    return pv;
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapInit( void ) /* PRIVILEGED_FUNCTION */
+{
+    TlsfBlock_t * pxFirstFreeBlock;
+    uint8_t * pucAlignedHeap;
+    uint8_t * pucHeapEnd;
+
+    /* Ensure the heap starts and ends on a correctly aligned boundary. */
+    pucAlignedHeap = ( uint8_t * ) ( ( ( portPOINTER_SIZE_TYPE ) &ucHeap[ portBYTE_ALIGNMENT - 1 ] ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) );
+    pucHeapEnd = ( uint8_t * ) ( ( ( portPOINTER_SIZE_TYPE ) &ucHeap[ configTOTAL_HEAP_SIZE ] ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) );
+
+    /* The top of the heap is an allocated block of no size, it stops the
+     * merging there.  Only its header is used, it is given the room of a
+     * smallest block to stay a whole TlsfBlock_t inside the heap array. */
+    pxHeapEnd = ( void * ) ( pucHeapEnd - heapMINIMUM_BLOCK_SIZE );
+
+    /* To start with there is a single free block that is sized to take up the
+     * entire heap space below it. */
+    pxFirstFreeBlock = ( void * ) pucAlignedHeap;
+    pxFirstFreeBlock->pxPrevPhysicalBlock = NULL;
+    pxFirstFreeBlock->xBlockSize = ( size_t ) ( ( uint8_t * ) pxHeapEnd - pucAlignedHeap );
+
+    pxHeapEnd->pxPrevPhysicalBlock = pxFirstFreeBlock;
+    pxHeapEnd->xBlockSize = 0;
+
+    xFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+    xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+    prvInsertFreeBlock( pxFirstFreeBlock );
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION && configUSE_HEAP_TLSF */
@@ -19,6 +19,11 @@
 #define FREERTOS_CONFIG_H
 
 #include "GPTM.h"
+#include "Timebase.h"
+#include "JobStats.h"
+#include "Trace.h"
+#include "HeapMonitor.h"
+#include "LowPower.h"
 #include "std_types.h"
 
 /******************************************************************************/
@@ -35,6 +40,14 @@
  * in our case Tick time will be 1ms */
 #define configTICK_RATE_HZ                    ((TickType_t)1000)
 
+/* Set configUSE_TICKLESS_IDLE to 2 to stop the tick interrupt and sleep while no
+ * task is due for configEXPECTED_IDLE_TIME_BEFORE_SLEEP ticks or more, woken by
+ * WTimer1A (see Services/LowPower.h). Set it to 0 to keep the tick running. */
+#define configUSE_TICKLESS_IDLE               2
+#define configEXPECTED_IDLE_TIME_BEFORE_SLEEP 2
+#define portSUPPRESS_TICKS_AND_SLEEP(xExpectedIdleTime) \
+    LowPower_SuppressTicksAndSleep(xExpectedIdleTime)
+
 /* Size of the stack allocated to the Idle task. 128 Words = 512 Bytes */
 #define configMINIMAL_STACK_SIZE              (128)
 
@@ -57,20 +70,63 @@
 /* Set the following configUSE_* constants to 1 to include the named feature in
  * the build, or 0 to exclude the named feature from the build. */
 #define configUSE_APPLICATION_TASK_TAG         1
+/* The trace recorder names tasks by their TCB number (see Services/Trace.h) */
+#if (TRACE_OUTPUT == STD_ON)
+#define configUSE_TRACE_FACILITY               1
+#else
+#define configUSE_TRACE_FACILITY               0
+#endif
+/* Software timers debounce the seat buttons, the timer service task runs at the highest priority
+ * so a debounce period ends on time whatever the application tasks are doing */
+#define configUSE_TIMERS                       1
+#define configTIMER_TASK_PRIORITY              (configMAX_PRIORITIES - 1)
+#define configTIMER_QUEUE_LENGTH               4
+#define configTIMER_TASK_STACK_DEPTH           configMINIMAL_STACK_SIZE
+/* The UART0 driver lets one sending task at a time into its transmit ring (see uart0.h) */
+#define configUSE_MUTEXES                      1
 /* Set the following INCLUDE_* constants to 1 to include the named API function,
  * or 0 to exclude the named API function.  Most linkers will remove unused
  * functions even when the constant is 1. */
 #define INCLUDE_vTaskDelay                     1
 #define INCLUDE_vTaskDelayUntil                1
+#define INCLUDE_xTaskGetSchedulerState         1
+#define INCLUDE_xTimerGetTimerDaemonTaskHandle 1
+/* Stack use monitoring (see Services/StackMonitor.h) */
+#define INCLUDE_uxTaskGetStackHighWaterMark    1
+#define INCLUDE_xTaskGetIdleTaskHandle         1
+
+/* Number of notification values per task. Index 0 is used by the application,
+ * index 1 by the UART0 driver to block a sender while its transmit ring is full
+ * and index 2 by the inter-task signals (Services/Signal.h) */
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES  3
 /******************************************************************************/
 /* Memory allocation related definitions. *************************************/
 /******************************************************************************/
 
+/* Set configSUPPORT_STATIC_ALLOCATION to 1 to place every task control block,
+ * task stack, the timer and the timer queue in .bss (see main.c). The kernel never
+ * allocates and heap_2.c compiles to nothing, so the heap leaves the link. Set it
+ * to 0 to create them from the heap. Tools/map_ram_report.c compares the RAM of
+ * both builds from their map files. */
+#define configSUPPORT_STATIC_ALLOCATION       0
+#define configSUPPORT_DYNAMIC_ALLOCATION      (1 - configSUPPORT_STATIC_ALLOCATION)
+
+/* Heap of the dynamic build: 0 for heap_2.c, 1 for heap_tlsf.c, a two-level
+ * segregated fit allocator with constant-time malloc and free that merges a
+ * freed block with its free neighbours. Tools/heap_bench.c compares both. */
+#define configUSE_HEAP_TLSF                   0
+
 /* Sets the total size of the FreeRTOS heap, in bytes, when heap_1.c, heap_2.c
  * or heap_4.c are included in the build. This value is defaulted to 4096 bytes but
  * it must be tailored to each application. Note the heap will appear in the .bss
  * section. */
-#define configTOTAL_HEAP_SIZE                 ((size_t)(8000))
+#ifdef TM4C_HOST_SIM
+/* 64-bit host build (Tools/firmware_sim.c): the task control blocks and the
+ * kernel objects hold 8-byte pointers */
+#define configTOTAL_HEAP_SIZE                 ((size_t)(16000))
+#else
+#define configTOTAL_HEAP_SIZE                 ((size_t)(9000))
+#endif
 
 /******************************************************************************/
 /* Definitions that include or exclude functionality. *************************/
@@ -89,7 +145,13 @@
  * functionality in the build.  Set to 0 to exclude the hook functionality from the
  * build.  The application writer is responsible for providing the hook function
  * for any set to 1. */
+#ifdef TM4C_HOST_SIM
+/* The simulated board advances its virtual clock in the idle hook, the idle loop
+ * touches no register while the next task is due within a tick */
+#define configUSE_IDLE_HOOK                   1
+#else
 #define configUSE_IDLE_HOOK                   0
+#endif
 #define configUSE_TICK_HOOK                   0
 
 /******************************************************************************/
@@ -121,26 +183,102 @@ PRIORITY THAN THIS! (higher priorities are lower numeric values. */
 /* Debugging assistance. ******************************************************/
 /******************************************************************************/
 
+#ifdef TM4C_HOST_SIM
+/* The simulated board reports the failed assert and ends the run */
+extern void vAssertCalled(const char *pcFile, unsigned long ulLine);
+#define configASSERT( x ) if( ( x ) == 0 ) { vAssertCalled( __FILE__, __LINE__ ); }
+#else
 /* Normal assert() semantics without relying on the provision of an assert.h header file. */
 #define configASSERT( x ) if( ( x ) == 0 ) { taskDISABLE_INTERRUPTS(); for( ;; ); }
+#endif
 /******************************************************************************/
 /* RTOS Runtime Measurements. *************************************************/
 /******************************************************************************/
 
-extern uint32 ullTasksOutTime[9];
-extern uint32 ullTasksInTime[9];
-extern uint32 ullTasksTotalTime[9];
+/* One slot per application task tag, slot 0 is the idle task (see FreeRTOS_Project.h) */
+#define NUMBER_OF_TASK_TAGS 8
+
+/* Timebase ticks (see Timebase.h), 64-bit so the totals never wrap */
+extern uint64 ullTasksOutTime[NUMBER_OF_TASK_TAGS];
+extern uint64 ullTasksInTime[NUMBER_OF_TASK_TAGS];
+extern uint64 ullTasksTotalTime[NUMBER_OF_TASK_TAGS];
 
 #define traceTASK_SWITCHED_IN()                                    \
 do{                                                                \
-    uint32 taskInTag = (uint32)(pxCurrentTCB->pxTaskTag);          \
-    ullTasksInTime[taskInTag] = GPTM_WTimer0Read();                \
+    uint32 taskInTag = (uint32)(portPOINTER_SIZE_TYPE)(pxCurrentTCB->pxTaskTag); \
+    ullTasksInTime[taskInTag] = Timebase_Now();                    \
+    JobStats_TaskSwitchedIn(taskInTag, ullTasksInTime[taskInTag]); \
+    TRACE_RECORD(TRACE_EVENT_TASK_SWITCHED_IN, pxCurrentTCB->uxTCBNumber, pxCurrentTCB->uxPriority); \
 }while(0);
 
+/* A task switched out while still in its ready list was preempted or yielded, its job goes on */
 #define traceTASK_SWITCHED_OUT()                                                                 \
 do{                                                                                              \
-    uint32 taskOutTag = (uint32)(pxCurrentTCB->pxTaskTag);                                       \
-    ullTasksOutTime[taskOutTag] = GPTM_WTimer0Read();                                            \
+    uint32 taskOutTag = (uint32)(portPOINTER_SIZE_TYPE)(pxCurrentTCB->pxTaskTag);                \
+    ullTasksOutTime[taskOutTag] = Timebase_Now();                                                \
     ullTasksTotalTime[taskOutTag] += ullTasksOutTime[taskOutTag] - ullTasksInTime[taskOutTag];   \
+    JobStats_TaskSwitchedOut(taskOutTag, ullTasksOutTime[taskOutTag] - ullTasksInTime[taskOutTag], \
+        (listLIST_ITEM_CONTAINER(&(pxCurrentTCB->xStateListItem)) !=                             \
+         &(pxReadyTasksLists[pxCurrentTCB->uxPriority])) ? TRUE : FALSE);                        \
 }while(0);
+
+/* Releases a job of the task (see JobStats.h), also from the FromISR API */
+#define traceMOVED_TASK_TO_READY_STATE(pxTCB)                                                    \
+do{                                                                                              \
+    JobStats_TaskReady((uint32)(portPOINTER_SIZE_TYPE)((pxTCB)->pxTaskTag), Timebase_Now());     \
+    TRACE_RECORD(TRACE_EVENT_TASK_READY, (pxTCB)->uxTCBNumber, (pxTCB)->uxPriority);             \
+}while(0)
+
+/******************************************************************************/
+/* Kernel event trace (see Services/Trace.h). *********************************/
+/******************************************************************************/
+#if (TRACE_OUTPUT == STD_ON)
+
+#define traceTASK_CREATE(pxNewTCB) \
+    Trace_TaskCreated((pxNewTCB)->uxTCBNumber, (pxNewTCB)->pcTaskName)
+
+#define traceTASK_DELAY() \
+    TRACE_RECORD(TRACE_EVENT_TASK_DELAY, pxCurrentTCB->uxTCBNumber, TRACE_SATURATE(xTicksToDelay))
+
+/* Also used by the event list waits with their time-out */
+#define traceTASK_DELAY_UNTIL(xTimeToWake) \
+    TRACE_RECORD(TRACE_EVENT_TASK_DELAY_UNTIL, pxCurrentTCB->uxTCBNumber, TRACE_SATURATE((xTimeToWake) - xTickCount))
+
+#define traceTASK_NOTIFY(uxIndexToNotify) \
+    TRACE_RECORD(TRACE_EVENT_NOTIFY, pxTCB->uxTCBNumber, uxIndexToNotify)
+
+#define traceTASK_NOTIFY_FROM_ISR(uxIndexToNotify) \
+    TRACE_RECORD(TRACE_EVENT_NOTIFY_FROM_ISR, pxTCB->uxTCBNumber, uxIndexToNotify)
+
+#define traceTASK_NOTIFY_GIVE_FROM_ISR(uxIndexToNotify) \
+    TRACE_RECORD(TRACE_EVENT_NOTIFY_FROM_ISR, pxTCB->uxTCBNumber, uxIndexToNotify)
+
+#define traceTASK_NOTIFY_WAIT_BLOCK(uxIndexToWait) \
+    TRACE_RECORD(TRACE_EVENT_NOTIFY_WAIT, pxCurrentTCB->uxTCBNumber, uxIndexToWait)
+
+#define traceTASK_NOTIFY_TAKE_BLOCK(uxIndexToWait) \
+    TRACE_RECORD(TRACE_EVENT_NOTIFY_WAIT, pxCurrentTCB->uxTCBNumber, uxIndexToWait)
+
+/* Event groups are outside tasks.c, the running task is recorded as task 0 */
+#define traceEVENT_GROUP_SET_BITS(xEventGroup, uxBitsToSet) \
+    TRACE_RECORD(TRACE_EVENT_GROUP_SET_BITS, 0U, TRACE_SATURATE(uxBitsToSet))
+
+#define traceEVENT_GROUP_SET_BITS_FROM_ISR(xEventGroup, uxBitsToSet) \
+    TRACE_RECORD(TRACE_EVENT_GROUP_SET_BITS, 0U, TRACE_SATURATE(uxBitsToSet))
+
+#define traceEVENT_GROUP_WAIT_BITS_BLOCK(xEventGroup, uxBitsToWaitFor) \
+    TRACE_RECORD(TRACE_EVENT_GROUP_WAIT_BITS, 0U, TRACE_SATURATE(uxBitsToWaitFor))
+
+#endif /* TRACE_OUTPUT */
+
+/******************************************************************************/
+/* Kernel heap instrumentation (see Services/HeapMonitor.h). ******************/
+/******************************************************************************/
+/* Both run with the scheduler suspended, a failed allocation reports a NULL pvAddress */
+#define traceMALLOC(pvAddress, uiSize) \
+    HeapMonitor_Malloc((pvAddress), (uiSize), HEAPMONITOR_CALL_SITE())
+
+#define traceFREE(pvAddress, uiSize) \
+    HeapMonitor_Free((pvAddress), (uiSize), HEAPMONITOR_CALL_SITE())
+
 #endif /* FREERTOS_CONFIG_H */
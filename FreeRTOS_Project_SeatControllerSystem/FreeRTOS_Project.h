@@ -10,16 +10,91 @@
 #ifndef FREERTOS_PROJECT_H_
 #define FREERTOS_PROJECT_H_
 
+#include <stdint.h>
+#include "std_types.h"
+
+/* Number of heated seats, each one is described by an entry of Seat_Configuration (Services/Seat_PBcfg.c) */
+#define NUMBER_OF_SEATS (2U)
+
 #define SEAT_HEATING_OFF 0
+#define LOW_HEATER_DUTY_PERCENT (33U)
+#define MEDIUM_HEATER_DUTY_PERCENT (66U)
+#define HIGH_HEATER_DUTY_PERCENT (100U)
 #define LOW_SEAT_HEATING_TEMPERATURE 25
 #define MEDIUM_SEAT_HEATING_TEMPERATURE 30
 #define HIGH_SEAT_HEATING_TEMPERATURE 35
-#define DRIVER_TASK_ID 0
-#define PASSENGER_TASK_ID 1
-#define MAX_VALID_TEMP 45
+#define MAX_VALID_TEMP 40
 #define MIN_VALID_TEMP 5
-#define ADC_FULL_SCALE_VALUE 4095
-#define RUNTIME_MEASUREMENTS_TASK_PERIODICITY (2000U)
+#define ADC_CONVERSION_TIMEOUT_MS (10U)
+
+/* Seat buttons raise an edge interrupt that starts a scan of every button each BUTTON_SCAN_PERIOD_MS,
+ * debounced over DEBOUNCE_STABLE_SCANS scans, until the buttons are idle again. Holding a button
+ * for BUTTON_LONG_PRESS_MS (at most 255 scans) switches that seat off */
+#define BUTTON_SCAN_PERIOD_MS (5U)
+#define BUTTON_LONG_PRESS_MS (1000U)
+
+/* Seat button task notification value: bit n is a press of seat n, bit (SEAT_LONG_PRESS_SHIFT + n) a long press */
+#define SEAT_LONG_PRESS_SHIFT (16U)
+
+/* Seat heater PID: setpoint and measurement in 0.1 C, output is the heater duty in %.
+ * Gains {Kp %/0.1C, Ki %/(0.1C*s), Kd %/(0.1C/s)}, tuned with Tools/pid_step_bench.c */
+#define HEATER_CONTROL_PERIOD_MS (500U)
+#define HEATER_PID_KP 2.0
+#define HEATER_PID_KI 0.02
+#define HEATER_PID_KD 0.0
+#define HEATER_PID_CONFIG {PID_CONTROLLER_GAIN(HEATER_PID_KP), PID_CONTROLLER_GAIN(HEATER_PID_KI), PID_CONTROLLER_GAIN(HEATER_PID_KD), \
+                           HEATER_CONTROL_PERIOD_MS, 0U, HIGH_HEATER_DUTY_PERCENT}
+
+/* Temperature sampling: STD_OFF scans both sensors every TEMP_SCAN_PERIOD_MS, STD_ON samples them
+ * continuously at TEMP_SAMPLE_RATE_HZ (Timer2A triggered) and processes TEMP_SAMPLE_BLOCK_SIZE scans at once */
+#define TEMP_CONTINUOUS_SAMPLING STD_OFF
+#define TEMP_SCAN_PERIOD_MS (500U)
+#define TEMP_SAMPLE_RATE_HZ (1000U)
+#define TEMP_SAMPLE_BLOCK_SIZE (16U)
+#define RUNTIME_MEASUREMENTS_TASK_PERIODICITY (1000U)
+#define DASHBOARD_REFRESH_PERIOD_MS (250U)
+
+/* Dashboard keys: dump the job statistics over UART0 (the dashboard returns on the next key), clear them,
+ * dump the stack use report, dump the kernel heap report, dump the EEPROM failure journal */
+#define DASHBOARD_JOBSTATS_DUMP_KEY ('h')
+#define DASHBOARD_JOBSTATS_RESET_KEY ('r')
+#define DASHBOARD_STACK_REPORT_KEY ('s')
+#define DASHBOARD_HEAP_REPORT_KEY ('m')
+#define DASHBOARD_FAILURE_LOG_KEY ('f')
+
+/* Sensor failures wait in a queue of FAILURE_LOG_QUEUE_LENGTH records for the failure log task, which
+ * writes them to the EEPROM journal (see Services/FailureLog.h). Its task notification value: bit 0 new
+ * records are queued, bit 1 dump the journal. A dump ends with a notification of the dashboard task, which
+ * does not use UART0 until then */
+#define FAILURE_LOG_QUEUE_LENGTH (8U)
+#define FAILURE_LOG_EVENT_RECORD (1UL << 0)
+#define FAILURE_LOG_EVENT_DUMP (1UL << 1)
+
+/* Task stack sizes in words, the stack report (see Services/StackMonitor.h) recommends sizes from the use seen */
+#define SEAT_BUTTON_TASK_STACK_SIZE (150U)
+#define CURRENT_TEMP_TASK_STACK_SIZE (150U)
+#define FAILURE_TASK_STACK_SIZE (150U)
+#define HEATER_MONITOR_TASK_STACK_SIZE (256U)
+#define HEATER_CONTROL_TASK_STACK_SIZE (100U)
+#define DISPLAY_TASK_STACK_SIZE (200U)
+#define RUNTIME_TASK_STACK_SIZE (256U)
+#define FAILURE_LOG_TASK_STACK_SIZE (128U)
+
+/* UART0 output: STD_OFF for the text dashboard, STD_ON for the binary telemetry stream */
+#define TELEMETRY_OUTPUT STD_OFF
+/* One record frame is TELEMETRY_MAX_FRAME_SIZE (113) bytes, 1130 bit times: every 200 ms that is 5650 bit/s,
+ * about 60% of UART0_BAUD_RATE 9600 (checked in main.c), 100 ms would need more than the line carries */
+#define TELEMETRY_PERIOD_MS (200U)
+
+/* Task tags used to index the runtime measurements (see FreeRTOSConfig.h), 0 is the idle task.
+ * The failure log task is counted with the failure task it writes for */
+#define SEAT_BUTTON_TASK_TAG (1U)
+#define CURRENT_TEMP_TASK_TAG (2U)
+#define FAILURE_TASK_TAG (3U)
+#define HEATER_MONITOR_TASK_TAG (4U)
+#define HEATER_CONTROL_TASK_TAG (5U)
+#define DISPLAY_TASK_TAG (6U)
+#define RUNTIME_TASK_TAG (7U)
 
 /* Enum defining different heating levels */
 typedef enum
@@ -33,22 +108,8 @@ typedef enum
 /* Struct to record failure details */
 typedef struct {
     char *failureMessage;  // Message describing the failure
-    uint32_t timestamp;    // Timestamp of when the failure occurred
+    uint64 timestamp;      // Timestamp of when the failure occurred, Timebase ticks
     HeatingLevel level;    // Heating level at the time of failure
 } FailureRecord;
 
-/* Struct defining task-specific information */
-typedef struct
-{
-    const uint8_t ucTaskID;            // Task ID for identification
-    const uint8_t  ucSeatButton;       // Button associated with the seat
-    uint8_t ucSeatButtonPressesCount;  // Number of presses on the seat button
-    uint8_t ucSeatHeatingTemp;         // Current heating temperature setting
-} TaskInformation;
-
-/* Definitions for the event bits in the event group */
-#define SEAT_MONITOR_TASK_BIT ( 1UL << 0UL )               // Event bit 0
-#define SEAT_CURRENT_TEMP_TASK_BIT ( 1UL << 1UL )          // Event bit 1
-#define SEAT_HEATER_INTENSITY_TASK_BIT ( 1UL << 2UL )      // Event bit 2
-
 #endif /* FREERTOS_PROJECT_H_ */
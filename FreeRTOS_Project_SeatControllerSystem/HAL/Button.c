@@ -10,6 +10,30 @@
  ******************************************************************************/
 #include "Dio.h"
 #include "Button.h"
+#include "tm4c123gh6pm_registers.h"
+
+static volatile Button_EdgeCallbackType Button_EdgeCallback = NULL_PTR;
+
+static const uint8 Button_EdgeChannels[BUTTON_NUMBER_OF_EDGE_INPUTS] = BUTTON_EDGE_CHANNELS;
+static const uint8 Button_EdgePins[BUTTON_NUMBER_OF_EDGE_INPUTS] = BUTTON_EDGE_PINS;
+
+static const Dio_PortType Button_ScanPorts[BUTTON_NUMBER_OF_SCAN_PORTS] = BUTTON_SCAN_PORTS;
+static const Dio_PortLevelType Button_ScanPinMasks[BUTTON_NUMBER_OF_SCAN_PORTS] = BUTTON_SCAN_PIN_MASKS;
+
+/* Port F pin mask of a button channel, 0 if it has no edge interrupt */
+static uint8 Button_EdgePinMask(uint8 Button_PIN_NUM)
+{
+    uint8 ucInput;
+
+    for (ucInput = 0; ucInput < BUTTON_NUMBER_OF_EDGE_INPUTS; ucInput++)
+    {
+        if (Button_EdgeChannels[ucInput] == Button_PIN_NUM)
+        {
+            return (uint8)(1U << Button_EdgePins[ucInput]);
+        }
+    }
+    return 0;
+}
 
 /*******************************************************************************************************************/
 uint8 buttonCheckState(uint8 Button_PIN_NUM)
@@ -19,3 +43,93 @@ uint8 buttonCheckState(uint8 Button_PIN_NUM)
     return state;
 }
 /*******************************************************************************************************************/
+void buttonReadInputs(uint32 *pulInputs)
+{
+    Dio_PortLevelType ucPressed;
+    uint8 ucWord;
+    uint8 ucPort;
+
+    for (ucWord = 0; ucWord < BUTTON_SCAN_WORDS; ucWord++)
+    {
+        pulInputs[ucWord] = 0;
+    }
+    for (ucPort = 0; ucPort < BUTTON_NUMBER_OF_SCAN_PORTS; ucPort++)
+    {
+        ucPressed = Dio_ReadPort(Button_ScanPorts[ucPort]);
+#if (BUTTON_PRESSED == STD_LOW)
+        ucPressed = (Dio_PortLevelType)~ucPressed;
+#endif
+        ucPressed &= Button_ScanPinMasks[ucPort];
+        pulInputs[ucPort / 4U] |= (uint32)ucPressed << (8U * (ucPort % 4U));
+    }
+}
+/*******************************************************************************************************************/
+uint8 buttonGetLane(uint8 Button_PIN_NUM)
+{
+    uint8 ucPort;
+
+    for (ucPort = 0; ucPort < BUTTON_NUMBER_OF_SCAN_PORTS; ucPort++)
+    {
+        if (Button_ScanPorts[ucPort] == Dio_Configuration.Channels[Button_PIN_NUM].Port_Num)
+        {
+            return (uint8)((8U * ucPort) + Dio_Configuration.Channels[Button_PIN_NUM].Ch_Num);
+        }
+    }
+    return BUTTON_NO_LANE;
+}
+/*******************************************************************************************************************/
+void buttonInitEdgeInterrupts(Button_EdgeCallbackType pCallback)
+{
+    uint8 ucPins = 0;
+    uint8 ucInput;
+
+    for (ucInput = 0; ucInput < BUTTON_NUMBER_OF_EDGE_INPUTS; ucInput++)
+    {
+        ucPins |= (uint8)(1U << Button_EdgePins[ucInput]);
+    }
+    Button_EdgeCallback = pCallback;
+
+    /* Edge sensitive (IS = 0) on both edges (IBE = 1), masked until the button is armed */
+    GPIO_PORTF_IM_REG &= ~ucPins;
+    GPIO_PORTF_IS_REG &= ~ucPins;
+    GPIO_PORTF_IBE_REG |= ucPins;
+    GPIO_PORTF_ICR_REG = ucPins;
+
+    /* Set GPIO Port F interrupt priority (INTC field of PRI7, bits 23:21) and enable it in the NVIC */
+    NVIC_PRI7_REG = (NVIC_PRI7_REG & 0xFF1FFFFF) | (BUTTON_INTERRUPT_PRIORITY << 21);
+    NVIC_EN0_REG = (1UL << BUTTON_PORTF_INTERRUPT_NUMBER);
+}
+/*******************************************************************************************************************/
+void buttonEnableEdgeInterrupt(uint8 Button_PIN_NUM)
+{
+    uint8 ucPin = Button_EdgePinMask(Button_PIN_NUM);
+
+    /* IM is also written by the interrupt, keep it out while the register is modified */
+    NVIC_DIS0_REG = (1UL << BUTTON_PORTF_INTERRUPT_NUMBER);
+    GPIO_PORTF_ICR_REG = ucPin;
+    GPIO_PORTF_IM_REG |= ucPin;
+    NVIC_EN0_REG = (1UL << BUTTON_PORTF_INTERRUPT_NUMBER);
+}
+/*******************************************************************************************************************/
+void GPIOPortF_Handler(void)
+{
+    uint8 ucFired;
+    uint8 ucInput;
+
+    MCAL_ISR_ENTER();
+    ucFired = (uint8)GPIO_PORTF_MIS_REG;
+
+    /* Mask and acknowledge the buttons that fired, their bounce is left to the debounce timer */
+    GPIO_PORTF_IM_REG &= ~ucFired;
+    GPIO_PORTF_ICR_REG = ucFired;
+
+    for (ucInput = 0; ucInput < BUTTON_NUMBER_OF_EDGE_INPUTS; ucInput++)
+    {
+        if ((0U != (ucFired & (1U << Button_EdgePins[ucInput]))) && (NULL_PTR != Button_EdgeCallback))
+        {
+            Button_EdgeCallback(Button_EdgeChannels[ucInput]);
+        }
+    }
+    MCAL_ISR_EXIT();
+}
+/*******************************************************************************************************************/
@@ -11,9 +11,36 @@
 #ifndef BUTTON_H
 #define BUTTON_H
 
-#include "Std_Types.h"
+#include "std_types.h"
 #include "Button_Cfg.h"
 
+/* 32-bit words filled by buttonReadInputs */
+#define BUTTON_SCAN_WORDS ((BUTTON_NUMBER_OF_SCAN_PORTS + 3U) / 4U)
+
+/* Returned by buttonGetLane for a button on a port that is not scanned */
+#define BUTTON_NO_LANE 0xFFU
+
+/* GPIO Port F is interrupt 30 of the NVIC */
+#define BUTTON_PORTF_INTERRUPT_NUMBER 30U
+
+/* Called from the GPIO Port F interrupt with the channel of a button that saw an edge (press or release).
+ * The edge interrupt of that button stays masked, so contact bounce raises no further interrupts,
+ * until buttonEnableEdgeInterrupt re-arms it */
+typedef void (*Button_EdgeCallbackType)(uint8 Button_PIN_NUM);
+
 uint8 buttonCheckState(uint8 Button_PIN_NUM);
 
+/* Reads every BUTTON_SCAN_PORTS port with one Dio_ReadPort each into BUTTON_SCAN_WORDS words,
+ * 1 = pressed, pins that are not buttons read 0. Lane of port n pin p is 8 * n + p */
+void buttonReadInputs(uint32 *pulInputs);
+
+/* Debounce lane of a button in the buttonReadInputs words */
+uint8 buttonGetLane(uint8 Button_PIN_NUM);
+
+/* Configures both edges of every BUTTON_EDGE_CHANNELS button and enables the Port F interrupt, all masked */
+void buttonInitEdgeInterrupts(Button_EdgeCallbackType pCallback);
+
+/* Drops any edge latched while the button was masked and unmasks its edge interrupt */
+void buttonEnableEdgeInterrupt(uint8 Button_PIN_NUM);
+
 #endif /* BUTTON_H */
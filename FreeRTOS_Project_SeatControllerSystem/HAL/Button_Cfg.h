@@ -26,4 +26,18 @@
 #define SW2_BUTTON_PIN_NUM DioConf_SW2_CHANNEL_NUM
 #define SW2_BUTTON_PIN_NUM_INDEX DioConf_SW2_CHANNEL_ID_INDEX
 
+/* Ports sampled as a whole by buttonReadInputs, 8 debounce lanes per port in this order (4 ports per
+ * 32-bit word), and the button pins of each. Up to 8 ports, the size of a Debounce engine */
+#define BUTTON_SCAN_PORTS            {SW1_BUTTON_PORT}
+#define BUTTON_SCAN_PIN_MASKS        {(1U << SW1_BUTTON_PIN_NUM) | (1U << SW2_BUTTON_PIN_NUM)}
+#define BUTTON_NUMBER_OF_SCAN_PORTS  1U
+
+/* Buttons with an edge interrupt, all on GPIO Port F */
+#define BUTTON_EDGE_CHANNELS   {SW1_BUTTON_PIN_NUM_INDEX, SW2_BUTTON_PIN_NUM_INDEX}
+#define BUTTON_EDGE_PINS       {SW1_BUTTON_PIN_NUM, SW2_BUTTON_PIN_NUM}
+#define BUTTON_NUMBER_OF_EDGE_INPUTS 2U
+
+/* GPIO Port F interrupt priority, must not be above configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY */
+#define BUTTON_INTERRUPT_PRIORITY 6U
+
 #endif /* BUTTON_CFG_H */
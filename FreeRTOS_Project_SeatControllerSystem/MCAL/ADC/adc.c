@@ -14,10 +14,26 @@
 #include "tm4c123gh6pm_registers.h"
 
 /*******************************************************************************
- *                         Private Functions Definitions                       *
+ *                              Module Variables                               *
  *******************************************************************************/
 
+static volatile ADC0_CallbackType ADC0_Callback = NULL_PTR;
+static volatile ADC0_BlockCallbackType ADC0_BlockCallback = NULL_PTR;
+static uint16 ADC0_BlockSize = 0;
 
+/* Single producer (ADC0 interrupt) / single consumer (reading task) ring, the head is only
+ * written by the interrupt and the tail only by the reader, so neither side needs a lock.
+ * It stands in for a kernel stream buffer, stream_buffer.c is not part of FreeRTOS/Source
+ * here, so the two have not been built or measured against each other */
+static uint16 ADC0_SampleBuffer[ADC0_SAMPLE_BUFFER_SIZE][ADC0_NUMBER_OF_CHANNELS];
+static volatile uint32 ADC0_SampleHead = 0;
+static volatile uint32 ADC0_SampleTail = 0;
+static volatile uint32 ADC0_OverrunCount = 0;
+
+static const uint8 ADC0_ScanChannels[ADC0_NUMBER_OF_CHANNELS] = ADC0_SCAN_CHANNELS;
+
+/* Sequencer 0 runs the whole scan in one go */
+typedef char ADC0_ScanFitsSequencer0[((ADC0_NUMBER_OF_CHANNELS >= 1U) && (ADC0_NUMBER_OF_CHANNELS <= ADC_SS0_MAX_STEPS)) ? 1 : -1];
 
 /*******************************************************************************
  *                         Public Functions Definitions                        *
@@ -25,68 +41,148 @@
 
 void ADC0_Init(void)
 {
+    uint32 ulMux = 0;
+    uint8 ucStep;
+
     /* Enable clock for ADC */
     SYSCTL_RCGCADC_REG |= 0x01;
     /* Wait until ADC clock is activated and it is ready for access*/
     while(!(SYSCTL_PRADC_REG & 0x01));
+    /*Disable Sequencer 0 while it is configured*/
+    ADC0_ADCACTSS_REG&=~0x01;
     /*the trigger source for Sample Sequencer 0 is Processor (default)*/
     ADC0_ADCEMUX_REG|=(ADC_PROCESSOR<<ADC_EM0);
     /*Dither mode enabled*/
     ADC0_ADCCTL_REG|=(1<<ADC_DITHER);
     /*VDDA and GNDA are the voltage references for all ADC modules.*/
     ADC0_ADCCTL_REG&=~(1<<ADC_VREF);
-    /*AIN0 analog inputs is sampled for the analog-to-digital conversion.*/
-    ADC0_ADCSSMUX0_REG=0x00;
-     /*
-     Set bit 1 (IE - Interrupt Enable) to enable interrupt when the sample is completed.
-     Set bit 2 (END - End of Sequence) to indicate this is the last conversion in the sequence.
+    /*Hardware averaging of every step, one result per step still lands in the FIFO*/
+    ADC0_ADCSAC_REG=ADC0_SAMPLE_AVERAGING;
+    /*Step n samples the n-th entry of ADC0_SCAN_CHANNELS*/
+    for (ucStep = 0; ucStep < ADC0_NUMBER_OF_CHANNELS; ucStep++)
+    {
+        ulMux |= ((uint32)ADC0_ScanChannels[ucStep] << (ADC_SSCTL_STEP_BITS*ucStep));
+    }
+    ADC0_ADCSSMUX0_REG=ulMux;
+    /*
+     The last step ends the sequence (END) and raises the interrupt (IE)
+     once every result is in the FIFO.
      */
-    ADC0_ADCSSCTL0_REG |= (1<<1) | (1<<2);
+    ADC0_ADCSSCTL0_REG=((ADC_SSCTL_END | ADC_SSCTL_IE)<<(ADC_SSCTL_STEP_BITS*(ADC0_NUMBER_OF_CHANNELS-1U)));
+    /*Clear any stale completion and unmask the Sequencer 0 interrupt*/
+    ADC0_ADCISC_REG=0x01;
+    ADC0_ADCIM_REG|=0x01;
+
+    /* Set ADC0 SS0 interrupt priority (INTC field of PRI3, bits 23:21) and enable it in the NVIC */
+    NVIC_PRI3_REG = (NVIC_PRI3_REG & 0xFF1FFFFF) | (ADC0_INTERRUPT_PRIORITY << 21);
+    NVIC_EN0_REG = (1UL << ADC0_SS0_INTERRUPT_NUMBER);
+
     /*Enable Sequencer 0*/
     ADC0_ADCACTSS_REG|=0x01;
+}
 
+void ADC0_SetCallback(ADC0_CallbackType pCallback)
+{
+    ADC0_Callback = pCallback;
 }
-uint16 ADC0_ReadChannel()
+
+void ADC0_StartConversion(void)
 {
-    uint16 digitalData = 0;
     /*SS0 bit is set*/
-    ADC0_ADCPSSI_REG|=0x01;
-    /* Check if the raw interrupt status is set */
-    while(!(ADC0_ADCRIS_REG & 0x01));
-    /* Get the 12-bit result */
-    digitalData = ADC0_ADCSSFIFO0_REG;
-    /* Clear the flag by writing a 1 to the ISC register */
-    ADC0_ADCISC_REG|=0x01;
-    return digitalData;
+    ADC0_ADCPSSI_REG=0x01;
+}
+
+void ADC0_StartContinuous(uint16 usBlockSize, ADC0_BlockCallbackType pCallback)
+{
+    /*Disable Sequencer 0 while the trigger source is changed*/
+    ADC0_ADCACTSS_REG&=~0x01;
+    ADC0_SampleHead = 0;
+    ADC0_SampleTail = 0;
+    ADC0_OverrunCount = 0;
+    ADC0_BlockSize = usBlockSize;
+    ADC0_BlockCallback = pCallback;
+    /*the trigger source for Sample Sequencer 0 is the GPTM time-out*/
+    ADC0_ADCEMUX_REG=(ADC0_ADCEMUX_REG & ~(ADC_EM0_MASK<<ADC_EM0)) | (ADC_TIMER<<ADC_EM0);
+    /*Enable Sequencer 0*/
+    ADC0_ADCACTSS_REG|=0x01;
 }
-void ADC1_Init(void) {
-    /* Enable clock for ADC1 */
-    SYSCTL_RCGCADC_REG |= 0x02;
-    /* Wait until ADC1 clock is activated and it is ready for access */
-    while(!(SYSCTL_PRADC_REG & 0x02));
-    /* Configure the trigger source for Sample Sequencer 0 as Processor (default) */
-    ADC1_ADCEMUX_REG |= (ADC_PROCESSOR << ADC_EM0);
-    /* Dither mode enabled */
-    ADC1_ADCCTL_REG |= (1 << ADC_DITHER);
-    /* Use default VDDA and GNDA as the voltage references */
-    ADC1_ADCCTL_REG &= ~(1 << ADC_VREF);
-    /* AIN1 analog input is sampled for the analog-to-digital conversion */
-    ADC1_ADCSSMUX0_REG = 0x01;
-    /* Enable interrupt and mark as end of sequence */
-    ADC1_ADCSSCTL0_REG |= (1 << 1) | (1 << 2);
-    /* Enable Sequencer 0 */
-    ADC1_ADCACTSS_REG |= 0x01;
+
+uint32 ADC0_GetSampleCount(void)
+{
+    return ADC0_SampleHead - ADC0_SampleTail;
+}
+
+uint32 ADC0_ReadSamples(uint16 *pSamples, uint32 ulMaxScans)
+{
+    uint32 ulTail = ADC0_SampleTail;
+    uint32 ulCount = 0;
+    uint8 ucStep;
+
+    while ((ulCount < ulMaxScans) && (ulTail != ADC0_SampleHead))
+    {
+        for (ucStep = 0; ucStep < ADC0_NUMBER_OF_CHANNELS; ucStep++)
+        {
+            *pSamples++ = ADC0_SampleBuffer[ulTail & (ADC0_SAMPLE_BUFFER_SIZE - 1U)][ucStep];
+        }
+        ulCount++;
+        ulTail++;
+    }
+    /* Publish the consumed entries only after they have been copied out */
+    ADC0_SampleTail = ulTail;
+
+    return ulCount;
 }
 
-uint16 ADC1_ReadChannel() {
-    uint16 digitalData = 0;
-    /* Start SS0 conversion */
-    ADC1_ADCPSSI_REG |= 0x01;
-    /* Wait for conversion to complete */
-    while(!(ADC1_ADCRIS_REG & 0x01));
-    /* Read the 12-bit result */
-    digitalData = ADC1_ADCSSFIFO0_REG & 0xFFF; // Mask to 12 bits
-    /* Clear the interrupt flag */
-    ADC1_ADCISC_REG |= 0x01;
-    return digitalData;
+uint32 ADC0_GetOverrunCount(void)
+{
+    return ADC0_OverrunCount;
+}
+
+void ADC0_Seq0_Handler(void)
+{
+    uint16 aScan[ADC0_NUMBER_OF_CHANNELS];
+    uint32 ulHead;
+    uint8 ucStep;
+
+    MCAL_ISR_ENTER();
+    /* Clear the flag by writing a 1 to the ISC register */
+    ADC0_ADCISC_REG=0x01;
+    /* The FIFO holds exactly one result per step, in step order */
+    for (ucStep = 0; ucStep < ADC0_NUMBER_OF_CHANNELS; ucStep++)
+    {
+        aScan[ucStep] = ADC0_ADCSSFIFO0_REG & ADC_RESULT_MASK;
+    }
+
+    if (NULL_PTR != ADC0_BlockCallback)
+    {
+        ulHead = ADC0_SampleHead;
+        if ((ulHead - ADC0_SampleTail) >= ADC0_SAMPLE_BUFFER_SIZE)
+        {
+            /* Reader fell behind, drop the newest scan and count it */
+            ADC0_OverrunCount++;
+        }
+        else
+        {
+            for (ucStep = 0; ucStep < ADC0_NUMBER_OF_CHANNELS; ucStep++)
+            {
+                ADC0_SampleBuffer[ulHead & (ADC0_SAMPLE_BUFFER_SIZE - 1U)][ucStep] = aScan[ucStep];
+            }
+            ADC0_SampleHead = ++ulHead;
+            /* Signal once when a block completes, the reader drains whole blocks so the fill level
+             * always drops below the block size again before the next one is signalled */
+            if ((ulHead - ADC0_SampleTail) == ADC0_BlockSize)
+            {
+                ADC0_BlockCallback();
+            }
+        }
+    }
+    else if (NULL_PTR != ADC0_Callback)
+    {
+        ADC0_Callback(aScan);
+    }
+    else
+    {
+        /* No consumer registered, the scan is discarded */
+    }
+    MCAL_ISR_EXIT();
 }
@@ -14,15 +14,39 @@
 #define ADC0_H_
 
 #include "std_types.h"
+
+/*******************************************************************************
+ *                              Configurations                                 *
+ *******************************************************************************/
+/* Hardware oversampling of every step, the ADCSAC value n averages 2^n samples (0 .. 6) */
+#define ADC0_SAMPLE_AVERAGING     4U
+
+/* ADC0 sequencer 0 interrupt priority, must not be above configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY */
+#define ADC0_INTERRUPT_PRIORITY   6U
+
+/* Continuous mode sample ring, one entry per scan (all channels), must be a power of two */
+#define ADC0_SAMPLE_BUFFER_SIZE   64U
+
+/* Analog inputs converted by one sequencer 0 scan, in step order. The sequencer has 8 steps */
+#define ADC0_SCAN_CHANNELS        {ADC_AIN0, ADC_AIN1}
+#define ADC0_NUMBER_OF_CHANNELS   2U
+
 /*******************************************************************************
  *                              Module Data Types                              *
  *******************************************************************************/
 /* Enumeration for Port_PinDirectionType used by the PORT APIs */
 typedef enum
 {
-    ADC_PROCESSOR,ADC_ANALOG_COMPARATOR0,ADC_ANALOG_COMPARATOR1,ADC_GPIO_PINS,ADC_TIMER,
-    ADC_PWM_GENERATOR1,ADC_PWM_GENERATOR2,ADC_PWM_GENERATOR3
+    ADC_PROCESSOR,ADC_ANALOG_COMPARATOR0,ADC_ANALOG_COMPARATOR1,ADC_EMUX_RESERVED,ADC_GPIO_PINS,ADC_TIMER,
+    ADC_PWM_GENERATOR0,ADC_PWM_GENERATOR1,ADC_PWM_GENERATOR2,ADC_PWM_GENERATOR3
 }ADC_EventMultiplexerSelect;
+
+/* Called from the ADC0 sequencer 0 interrupt with the ADC0_NUMBER_OF_CHANNELS results of a scan, in step order */
+typedef void (*ADC0_CallbackType)(const uint16 *pSamples);
+
+/* Called from the ADC0 sequencer 0 interrupt in continuous mode once a block of samples is ready */
+typedef void (*ADC0_BlockCallbackType)(void);
+
 /*******************************************************************************
  *                             Preprocessor Macros                             *
  *******************************************************************************/
@@ -34,13 +58,56 @@ typedef enum
 #define ADC_DITHER 6
 #define ADC_VREF 0
 #define ADC_AIN0 0
+#define ADC_AIN1 1
+#define ADC_AIN2 2
+#define ADC_AIN3 3
+#define ADC_AIN4 4
+#define ADC_AIN5 5
+#define ADC_AIN6 6
+#define ADC_AIN7 7
+#define ADC_AIN8 8
+#define ADC_AIN9 9
+#define ADC_AIN10 10
+#define ADC_AIN11 11
+#define ADC_SS0_MAX_STEPS 8
+
+/* ADCSSCTLn nibble bits, one nibble per sequence step: D (bit 0), END (bit 1), IE (bit 2), TS (bit 3) */
+#define ADC_SSCTL_END 0x2
+#define ADC_SSCTL_IE  0x4
+#define ADC_SSCTL_STEP_BITS 4
+
+#define ADC_RESULT_MASK 0x0FFF
+#define ADC_EM0_MASK 0x0000000F
+
+#define ADC0_SS0_INTERRUPT_NUMBER 14U
 
 /*******************************************************************************
  *                            Functions Prototypes                             *
  *******************************************************************************/
 
+/* Configure ADC0 sequencer 0 to convert the ADC0_SCAN_CHANNELS and interrupt on completion */
 extern void ADC0_Init(void);
-extern uint16 ADC0_ReadChannel();
-extern void ADC1_Init(void);
-extern uint16 ADC1_ReadChannel();
+
+/* Register the function receiving each completed scan */
+extern void ADC0_SetCallback(ADC0_CallbackType pCallback);
+
+/* Trigger one scan of all channels, the result is delivered to the callback */
+extern void ADC0_StartConversion(void);
+
+/* Switch sequencer 0 to the timer trigger (see GPTM_Timer2AStartAdcTrigger). Every scan is pushed into
+ * the sample ring and pCallback runs each time the ring fill level reaches usBlockSize */
+extern void ADC0_StartContinuous(uint16 usBlockSize, ADC0_BlockCallbackType pCallback);
+
+/* Number of scans waiting in the sample ring */
+extern uint32 ADC0_GetSampleCount(void);
+
+/* Copy up to ulMaxScans scans out of the sample ring, returns the number copied. Each scan takes
+ * ADC0_NUMBER_OF_CHANNELS entries of pSamples, in step order */
+extern uint32 ADC0_ReadSamples(uint16 *pSamples, uint32 ulMaxScans);
+
+/* Number of scans dropped because the sample ring was full */
+extern uint32 ADC0_GetOverrunCount(void);
+
+/* ADC0 sequencer 0 interrupt handler, placed in the vector table */
+extern void ADC0_Seq0_Handler(void);
 #endif
@@ -218,6 +218,74 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
     return output;
 }
 
+/************************************************************************************
+ * Service Name: Dio_ReadPort
+ * Service ID[hex]: 0x02
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): PortId - ID of DIO Port.
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Dio_PortLevelType
+ * Description: Function to return the level of all channels of that port, one
+ *              bit per pin, with a single read of the port data register.
+ ************************************************************************************/
+Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
+{
+    Dio_PortLevelType output = 0;
+    boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (DIO_NOT_INITIALIZED == Dio_Status)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+                        DIO_READ_PORT_SID, DIO_E_UNINIT);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    /* Check if the used port is within the valid range */
+    if (DIO_NUMBER_OF_PORTS <= PortId)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+                        DIO_READ_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        switch(PortId)
+        {
+        case 0:    output = (Dio_PortLevelType)GPIO_PORTA_DATA_REG;
+        break;
+        case 1:    output = (Dio_PortLevelType)GPIO_PORTB_DATA_REG;
+        break;
+        case 2:    output = (Dio_PortLevelType)GPIO_PORTC_DATA_REG;
+        break;
+        case 3:    output = (Dio_PortLevelType)GPIO_PORTD_DATA_REG;
+        break;
+        case 4:    output = (Dio_PortLevelType)GPIO_PORTE_DATA_REG;
+        break;
+        case 5:    output = (Dio_PortLevelType)GPIO_PORTF_DATA_REG;
+        break;
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return output;
+}
+
 /************************************************************************************
  * Service Name: Dio_GetVersionInfo
  * Service ID[hex]: 0x12
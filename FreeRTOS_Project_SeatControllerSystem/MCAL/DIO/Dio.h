@@ -43,7 +43,7 @@
 #define DIO_NOT_INITIALIZED            (0U)
 
 /* Standard AUTOSAR types */
-#include "Std_Types.h"
+#include "std_types.h"
 
 /* AUTOSAR checking between Std Types and Dio Modules */
 #if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != DIO_AR_RELEASE_MAJOR_VERSION)\
@@ -128,6 +128,9 @@
  * error code (Not exist in AUTOSAR 4.0.3 DIO SWS Document.
  */
 #define DIO_E_UNINIT                   (uint8)0xF0
+
+/* GPIO ports A to F, a Dio_PortType is the port letter index */
+#define DIO_NUMBER_OF_PORTS            (6U)
 /*******************************************************************************
  *                              Module Data Types                              *
  *******************************************************************************/
@@ -0,0 +1,99 @@
+ /******************************************************************************
+ *
+ * Module: EEPROM
+ *
+ * File Name: Eeprom.c
+ *
+ * Description: Source file for the TM4C123GH6PM on-chip EEPROM driver, the
+ *              start-up sequence is the one of the datasheet (EEPROM
+ *              Initialization and Configuration). Not reentrant, a single task
+ *              owns the EEPROM after Eeprom_Init.
+ *
+ * Author: Mohamed Hassan
+ *
+ *******************************************************************************/
+
+#include "Eeprom.h"
+#include "tm4c123gh6pm_registers.h"
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+/* EEDONE: an operation is in progress, the write was refused (protection or an invalid
+ * block) or the power was too low for it */
+#define EEPROM_EEDONE_WORKING          (1UL << 0)
+#define EEPROM_EEDONE_NOPERM           (1UL << 4)
+#define EEPROM_EEDONE_INVPL            (1UL << 8)
+
+/* EESUPP: an erase or a copy failed and has to be retried */
+#define EEPROM_EESUPP_ERETRY           (1UL << 2)
+#define EEPROM_EESUPP_PRETRY           (1UL << 3)
+
+/*******************************************************************************
+ *                         Private Functions Definitions                       *
+ *******************************************************************************/
+
+static void Eeprom_WaitDone(void)
+{
+    while (EEPROM_EEDONE_REG & EEPROM_EEDONE_WORKING);
+}
+
+static boolean Eeprom_RetryPending(void)
+{
+    return (boolean)(0UL != (EEPROM_EESUPP_REG & (EEPROM_EESUPP_ERETRY | EEPROM_EESUPP_PRETRY)));
+}
+
+static void Eeprom_Select(uint16 usAddress)
+{
+    EEPROM_EEBLOCK_REG = (uint32)(usAddress / EEPROM_WORDS_PER_BLOCK);
+    EEPROM_EEOFFSET_REG = (uint32)(usAddress % EEPROM_WORDS_PER_BLOCK);
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+Std_ReturnType Eeprom_Init(void)
+{
+    SYSCTL_RCGCEEPROM_REG |= (1UL << 0);                    /* Clock the EEPROM */
+    while(!(SYSCTL_PREEPROM_REG & (1UL << 0)));
+
+    /* An operation cut short by the last reset is completed first */
+    Eeprom_WaitDone();
+    if (TRUE == Eeprom_RetryPending())
+    {
+        return E_NOT_OK;
+    }
+
+    /* Reset the module so it starts from the recovered state */
+    SYSCTL_SREEPROM_REG |= (1UL << 0);
+    SYSCTL_SREEPROM_REG &= ~(1UL << 0);
+    while(!(SYSCTL_PREEPROM_REG & (1UL << 0)));
+
+    Eeprom_WaitDone();
+    if (TRUE == Eeprom_RetryPending())
+    {
+        return E_NOT_OK;
+    }
+    return E_OK;
+}
+
+void Eeprom_ReadWords(uint16 usAddress, uint32 *pData, uint16 usCount)
+{
+    uint16 usIndex;
+
+    for (usIndex = 0; usIndex < usCount; usIndex++)
+    {
+        Eeprom_Select(usAddress + usIndex);
+        pData[usIndex] = EEPROM_EERDWR_REG;
+    }
+}
+
+Std_ReturnType Eeprom_WriteWord(uint16 usAddress, uint32 ulData)
+{
+    Eeprom_Select(usAddress);
+    EEPROM_EERDWR_REG = ulData;                             /* Starts the write */
+    Eeprom_WaitDone();
+
+    return (0UL != (EEPROM_EEDONE_REG & (EEPROM_EEDONE_NOPERM | EEPROM_EEDONE_INVPL))) ? E_NOT_OK : E_OK;
+}
@@ -0,0 +1,44 @@
+ /******************************************************************************
+ *
+ * Module: EEPROM
+ *
+ * File Name: Eeprom.h
+ *
+ * Description: Header file for the TM4C123GH6PM on-chip EEPROM driver. The
+ *              2 KB EEPROM is 32 blocks of 16 32-bit words, addressed here by
+ *              word (block * 16 + offset). A word write takes the CPU until the
+ *              EEPROM is done, which is about 110 us and up to tens of ms when
+ *              the EEPROM has to erase a copy buffer, so writes belong in a task
+ *              that can afford to wait. Erased words read 0xFFFFFFFF.
+ *
+ * Author: Mohamed Hassan
+ *
+ *******************************************************************************/
+
+#ifndef EEPROM_H_
+#define EEPROM_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+#define EEPROM_SIZE_WORDS        (512U)
+#define EEPROM_WORDS_PER_BLOCK   (16U)
+#define EEPROM_ERASED_WORD       (0xFFFFFFFFUL)
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/* Enable the EEPROM and recover an operation a reset interrupted, before any access.
+ * E_NOT_OK when the EEPROM reports a failed erase or copy, it must not be used then */
+extern Std_ReturnType Eeprom_Init(void);
+
+/* Read usCount words from the word address usAddress on */
+extern void Eeprom_ReadWords(uint16 usAddress, uint32 *pData, uint16 usCount);
+
+/* Write one word and wait until it is stored. E_NOT_OK when the EEPROM refused the write */
+extern Std_ReturnType Eeprom_WriteWord(uint16 usAddress, uint32 ulData);
+
+#endif /* EEPROM_H_ */
@@ -12,19 +12,110 @@
 #include "GPTM.h"
 #include "tm4c123gh6pm_registers.h"
 
-void GPTM_WTimer0Init(void)
+static volatile GPTM_CallbackType GPTM_WTimer0Callback = NULL_PTR;
+static volatile GPTM_CallbackType GPTM_WTimer1Callback = NULL_PTR;
+
+void GPTM_WTimer0Init(uint16 usPrescaler, GPTM_CallbackType pOverflowCallback)
 {
-    /* Configure one shot down 32bit timer with tick time = 0.1msec */
+    /* Configure periodic down 32bit timer that wraps from 0 to 0xFFFFFFFF forever */
     SYSCTL_RCGCWTIMER_REG |= (1<<0);  /* Enable clock WTimer0 in run mode */
+    while(!(SYSCTL_PRWTIMER_REG & (1<<0)));
     WTIMER0_CTL_REG = 0;              /* Disable WTimer0 output */
     WTIMER0_CFG_REG = 0x04;           /* Select 32-bit configuration option */
-    WTIMER0_TAMR_REG = 0x01;          /* Select one-shot down counter mode of WTimer0A */
-    WTIMER0_TAPR_REG = 1600 -1;       /* Set the prescaler for WTimer0A */
+    WTIMER0_TAMR_REG = 0x02;          /* Select periodic down counter mode of WTimer0A */
+    WTIMER0_TAILR_REG = 0xFFFFFFFF;   /* Full 32-bit period */
+    WTIMER0_TAPR_REG = usPrescaler;   /* Set the prescaler for WTimer0A */
+    GPTM_WTimer0Callback = pOverflowCallback;
+    WTIMER0_ICR_REG = (1<<0);         /* Clear any stale time-out */
+    WTIMER0_IMR_REG = (1<<0);         /* Time-out interrupt */
+
+    /* Set WTimer0A interrupt priority (INTC field of PRI23, bits 23:21) and enable it in the NVIC */
+    NVIC_PRI23_REG = (NVIC_PRI23_REG & 0xFF1FFFFF) | (GPTM_WTIMER0A_INTERRUPT_PRIORITY << 21);
+    NVIC_EN2_REG = (1UL << (GPTM_WTIMER0A_INTERRUPT_NUMBER - 64U));
+
     WTIMER0_CTL_REG |= (0x01);        /* Enable WTimer0A module */
 }
 
 uint32 GPTM_WTimer0Read(void)
 {
-    return (uint32) (0xFFFFFFFFUL - WTIMER0_TAR_REG);
+    /* Counting down from 0xFFFFFFFF, the count 0 raises the time-out and reads as the wrap to 0 */
+    return (uint32) (0UL - WTIMER0_TAR_REG);
+}
+
+boolean GPTM_WTimer0OverflowPending(void)
+{
+    return (boolean)(0U != (WTIMER0_RIS_REG & (1<<0)));
+}
+
+/* Not traced: at priority 0 it runs above configMAX_SYSCALL_INTERRUPT_PRIORITY, the BASEPRI mask that
+ * keeps the trace recorder consistent does not hold it off, so MCAL_ISR_ENTER/EXIT could tear an event */
+void WTimer0A_Handler(void)
+{
+    WTIMER0_ICR_REG = (1<<0);         /* Clear the time-out before it is counted */
+    if (NULL_PTR != GPTM_WTimer0Callback)
+    {
+        GPTM_WTimer0Callback();
+    }
+}
+
+void GPTM_WTimer1Init(GPTM_CallbackType pTimeoutCallback)
+{
+    /* Configure one-shot down 32bit timer, started for every sleep */
+    SYSCTL_RCGCWTIMER_REG |= (1<<1);  /* Enable clock WTimer1 in run mode */
+    while(!(SYSCTL_PRWTIMER_REG & (1<<1)));
+    WTIMER1_CTL_REG = 0;              /* Disable WTimer1 output */
+    WTIMER1_CFG_REG = 0x04;           /* Select 32-bit configuration option */
+    WTIMER1_TAMR_REG = 0x01;          /* Select one-shot down counter mode of WTimer1A */
+    WTIMER1_TAPR_REG = 0;             /* No prescaler, one count every system clock */
+    GPTM_WTimer1Callback = pTimeoutCallback;
+    WTIMER1_ICR_REG = (1<<0);         /* Clear any stale time-out */
+    WTIMER1_IMR_REG = (1<<0);         /* Time-out interrupt */
+
+    /* Set WTimer1A interrupt priority (INTA field of PRI24, bits 7:5) and enable it in the NVIC */
+    NVIC_PRI24_REG = (NVIC_PRI24_REG & 0xFFFFFF1F) | (GPTM_WTIMER1A_INTERRUPT_PRIORITY << 5);
+    NVIC_EN3_REG = (1UL << (GPTM_WTIMER1A_INTERRUPT_NUMBER - 96U));
+}
+
+void GPTM_WTimer1StartOneShot(uint32 ulCounts)
+{
+    WTIMER1_CTL_REG = 0;              /* Disabled, the count is loaded again when enabled */
+    WTIMER1_TAILR_REG = ulCounts;
+    WTIMER1_ICR_REG = (1<<0);
+    WTIMER1_CTL_REG = (0x01);         /* Count down once, the timer disables itself at the time-out */
+}
+
+void GPTM_WTimer1Stop(void)
+{
+    WTIMER1_CTL_REG = 0;
+    WTIMER1_ICR_REG = (1<<0);
+}
+
+void WTimer1A_Handler(void)
+{
+    MCAL_ISR_ENTER();
+    WTIMER1_ICR_REG = (1<<0);
+    if (NULL_PTR != GPTM_WTimer1Callback)
+    {
+        GPTM_WTimer1Callback();
+    }
+    MCAL_ISR_EXIT();
 }
 
+
+void GPTM_Timer2AStartAdcTrigger(uint32 ulPeriodTicks)
+{
+    /* Configure periodic down 32bit timer whose time-out starts an ADC sequence */
+    SYSCTL_RCGCTIMER_REG |= (1<<2);   /* Enable clock Timer2 in run mode */
+    while(!(SYSCTL_PRTIMER_REG & (1<<2)));
+    TIMER2_CTL_REG = 0;               /* Disable Timer2 while it is configured */
+    TIMER2_CFG_REG = 0x00;            /* Select 32-bit configuration option */
+    TIMER2_TAMR_REG = 0x02;           /* Select periodic down counter mode of Timer2A */
+    TIMER2_TAILR_REG = ulPeriodTicks - 1;
+    TIMER2_IMR_REG = 0;               /* No timer interrupt, the ADC completion interrupt is used */
+    TIMER2_CTL_REG = (1<<5) | (0x01); /* TAOTE: time-out triggers the ADC, enable Timer2A */
+}
+
+void GPTM_Timer2AStop(void)
+{
+    TIMER2_CTL_REG = 0;
+}
@@ -15,8 +15,39 @@
 
 #include "std_types.h"
 
-void GPTM_WTimer0Init(void);
+/* Wide Timer 0A time-out, IRQ 94 (EN2 bit 30, INTC field of PRI23) */
+#define GPTM_WTIMER0A_INTERRUPT_NUMBER    (94U)
+/* Highest priority, nothing reading the counter can preempt the handler. It makes no FreeRTOS call */
+#define GPTM_WTIMER0A_INTERRUPT_PRIORITY  (0U)
+
+typedef void (*GPTM_CallbackType)(void);
+
+/* Free running periodic 32-bit down counter WTimer0A, one count every (usPrescaler + 1) system clocks.
+ * pOverflowCallback runs in the time-out interrupt each time the count wraps */
+void GPTM_WTimer0Init(uint16 usPrescaler, GPTM_CallbackType pOverflowCallback);
+/* Counts since the last wrap, the wrap to 0 and the time-out flag happen on the same count */
 uint32 GPTM_WTimer0Read(void);
+/* TRUE once the count wrapped until the time-out interrupt has handled it */
+boolean GPTM_WTimer0OverflowPending(void);
+void WTimer0A_Handler(void);
+
+/* Wide Timer 1A time-out, IRQ 96 (EN3 bit 0, INTA field of PRI24) */
+#define GPTM_WTIMER1A_INTERRUPT_NUMBER    (96U)
+/* Lowest priority, it only wakes the CPU from the tickless idle sleep. It makes no FreeRTOS call */
+#define GPTM_WTIMER1A_INTERRUPT_PRIORITY  (7U)
+
+/* One-shot 32-bit down counter WTimer1A, one count every system clock, stopped until started.
+ * pTimeoutCallback runs in the time-out interrupt */
+void GPTM_WTimer1Init(GPTM_CallbackType pTimeoutCallback);
+/* Time out after ulCounts system clocks (at least 1), a running count starts over */
+void GPTM_WTimer1StartOneShot(uint32 ulCounts);
+/* Stop the count, a time-out that has not interrupted yet is dropped */
+void GPTM_WTimer1Stop(void);
+void WTimer1A_Handler(void);
+
+/* Periodic 32-bit Timer2A that only triggers the ADC (no interrupt), ulPeriodTicks in system clock ticks */
+void GPTM_Timer2AStartAdcTrigger(uint32 ulPeriodTicks);
+void GPTM_Timer2AStop(void);
 
 
 #endif /* GPTM_H_ */
@@ -75,17 +75,17 @@ void Port_Init(const Port_ConfigType * ConfigPtr )
       }
     switch(PortNumber)
     {
-        case  0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
+        case  0: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTA_BASE_ADDRESS); /* PORTA Base Address */
 		 break;
-	case  1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
+	case  1: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTB_BASE_ADDRESS); /* PORTB Base Address */
 		 break;
-	case  2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
+	case  2: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTC_BASE_ADDRESS); /* PORTC Base Address */
 		 break;
-	case  3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
+	case  3: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTD_BASE_ADDRESS); /* PORTD Base Address */
 		 break;
-        case  4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
+        case  4: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTE_BASE_ADDRESS); /* PORTE Base Address */
 		 break;
-        case  5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
+        case  5: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTF_BASE_ADDRESS); /* PORTF Base Address */
 		 break;
     }
     
@@ -241,17 +241,17 @@ void Port_SetPinDirection
       }
     switch(PortNumber)
     {
-        case  0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
+        case  0: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTA_BASE_ADDRESS); /* PORTA Base Address */
 		 break;
-	case  1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
+	case  1: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTB_BASE_ADDRESS); /* PORTB Base Address */
 		 break;
-	case  2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
+	case  2: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTC_BASE_ADDRESS); /* PORTC Base Address */
 		 break;
-	case  3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
+	case  3: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTD_BASE_ADDRESS); /* PORTD Base Address */
 		 break;
-        case  4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
+        case  4: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTE_BASE_ADDRESS); /* PORTE Base Address */
 		 break;
-        case  5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
+        case  5: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTF_BASE_ADDRESS); /* PORTF Base Address */
 		 break;
     }
     
@@ -349,17 +349,17 @@ void Port_RefreshPortDirection( void )
       }
     switch(PortNumber)
     {
-        case  0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
+        case  0: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTA_BASE_ADDRESS); /* PORTA Base Address */
 		 break;
-	case  1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
+	case  1: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTB_BASE_ADDRESS); /* PORTB Base Address */
 		 break;
-	case  2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
+	case  2: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTC_BASE_ADDRESS); /* PORTC Base Address */
 		 break;
-	case  3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
+	case  3: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTD_BASE_ADDRESS); /* PORTD Base Address */
 		 break;
-        case  4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
+        case  4: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTE_BASE_ADDRESS); /* PORTE Base Address */
 		 break;
-        case  5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
+        case  5: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTF_BASE_ADDRESS); /* PORTF Base Address */
 		 break;
     }
     
@@ -462,17 +462,17 @@ Port_PinModeType Mode
       }
     switch(PortNumber)
     {
-        case  0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
+        case  0: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTA_BASE_ADDRESS); /* PORTA Base Address */
 		 break;
-	case  1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
+	case  1: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTB_BASE_ADDRESS); /* PORTB Base Address */
 		 break;
-	case  2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
+	case  2: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTC_BASE_ADDRESS); /* PORTC Base Address */
 		 break;
-	case  3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
+	case  3: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTD_BASE_ADDRESS); /* PORTD Base Address */
 		 break;
-        case  4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
+        case  4: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTE_BASE_ADDRESS); /* PORTE Base Address */
 		 break;
-        case  5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
+        case  5: PortGpio_Ptr = HW_ADDRESS(GPIO_PORTF_BASE_ADDRESS); /* PORTF Base Address */
 		 break;
     }
     
@@ -58,7 +58,7 @@ const Port_ConfigType Port_Configuration =
    {PORT_PIN_B3_ID,PORT_PIN_IN,PORT_PIN_MODE_DIO,PORT_PIN_INTERNAL_RESISTOR_OFF,PORT_PIN_LEVEL_LOW,STD_OFF,STD_OFF},
    {PORT_PIN_B4_ID,PORT_PIN_IN,PORT_PIN_MODE_DIO,PORT_PIN_INTERNAL_RESISTOR_OFF,PORT_PIN_LEVEL_LOW,STD_OFF,STD_OFF},
    {PORT_PIN_B5_ID,PORT_PIN_IN,PORT_PIN_MODE_DIO,PORT_PIN_INTERNAL_RESISTOR_OFF,PORT_PIN_LEVEL_LOW,STD_OFF,STD_OFF},
-   {PORT_PIN_B6_ID,PORT_PIN_OUT,PORT_PIN_MODE_DIO,PORT_PIN_INTERNAL_RESISTOR_OFF,PORT_PIN_LEVEL_LOW,STD_OFF,STD_OFF},
+   {PORT_PIN_B6_ID,PORT_PIN_OUT,PORT_PIN_MODE_ALTERNATE_7,PORT_PIN_INTERNAL_RESISTOR_OFF,PORT_PIN_LEVEL_LOW,STD_OFF,STD_OFF},
    {PORT_PIN_B7_ID,PORT_PIN_IN,PORT_PIN_MODE_DIO,PORT_PIN_INTERNAL_RESISTOR_OFF,PORT_PIN_LEVEL_LOW,STD_OFF,STD_OFF},
    {PORT_PIN_C0_ID,PORT_PIN_IN,PORT_PIN_MODE_DIO,PORT_PIN_INTERNAL_RESISTOR_OFF,PORT_PIN_LEVEL_LOW,STD_OFF,STD_OFF},
    {PORT_PIN_C1_ID,PORT_PIN_IN,PORT_PIN_MODE_DIO,PORT_PIN_INTERNAL_RESISTOR_OFF,PORT_PIN_LEVEL_LOW,STD_OFF,STD_OFF},
@@ -85,7 +85,7 @@ const Port_ConfigType Port_Configuration =
    {PORT_PIN_F0_ID,PORT_PIN_IN,PORT_PIN_MODE_DIO,PORT_PIN_INTERNAL_RESISTOR_PULL_UP,PORT_PIN_LEVEL_LOW,STD_OFF,STD_OFF},    
    {PORT_PIN_F1_ID,PORT_PIN_OUT,PORT_PIN_MODE_DIO,PORT_PIN_INTERNAL_RESISTOR_OFF,PORT_PIN_LEVEL_LOW,STD_OFF,STD_OFF},
    {PORT_PIN_F2_ID,PORT_PIN_OUT,PORT_PIN_MODE_DIO,PORT_PIN_INTERNAL_RESISTOR_OFF,PORT_PIN_LEVEL_LOW,STD_OFF,STD_OFF},
-   {PORT_PIN_F3_ID,PORT_PIN_OUT,PORT_PIN_MODE_DIO,PORT_PIN_INTERNAL_RESISTOR_OFF,PORT_PIN_LEVEL_LOW,STD_OFF,STD_OFF},
+   {PORT_PIN_F3_ID,PORT_PIN_OUT,PORT_PIN_MODE_ALTERNATE_7,PORT_PIN_INTERNAL_RESISTOR_OFF,PORT_PIN_LEVEL_LOW,STD_OFF,STD_OFF},
    {PORT_PIN_F4_ID,PORT_PIN_IN,PORT_PIN_MODE_DIO,PORT_PIN_INTERNAL_RESISTOR_PULL_UP,PORT_PIN_LEVEL_LOW,STD_OFF,STD_OFF}
   }
                                                                                                                    
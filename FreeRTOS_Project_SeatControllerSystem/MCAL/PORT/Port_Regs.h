@@ -13,6 +13,7 @@
 #define PORT_REGS_H
 
 #include "std_types.h"
+#include "hw_access.h"
 
 /* GPIO Registers base addresses */
 #define GPIO_PORTA_BASE_ADDRESS           0x40004000
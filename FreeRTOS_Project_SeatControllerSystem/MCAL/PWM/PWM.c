@@ -0,0 +1,116 @@
+ /******************************************************************************
+ *
+ * Module: PWM
+ *
+ * File Name: PWM.c
+ *
+ * Description: Source file for the TM4C123GH6PM PWM output driver built on the
+ *              16-bit GPTM timers in PWM mode.
+ *
+ * Author: Mohamed Hassan
+ *
+ *******************************************************************************/
+
+#include "PWM.h"
+#include "tm4c123gh6pm_registers.h"
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+#define PWM_TIMER0_BASE          0x40030000UL
+#define PWM_TIMER1_BASE          0x40031000UL
+
+/* Timer A register offsets, the timer B register follows each one 4 bytes later */
+#define PWM_CFG_OFFSET           0x000
+#define PWM_TNMR_OFFSET          0x004
+#define PWM_CTL_OFFSET           0x00C
+#define PWM_TNILR_OFFSET         0x028
+#define PWM_TNMATCHR_OFFSET      0x030
+#define PWM_TNPR_OFFSET          0x038
+#define PWM_TIMER_B_OFFSET       0x004
+
+#define PWM_CFG_16_BIT           0x04
+#define PWM_TNMR_PWM_MODE        0x0A    /* TnAMS = 1 (PWM), TnCMR = 0 (edge count), TnMR = 2 (periodic) */
+#define PWM_CTL_TNEN             0x01    /* TAEN, TBEN is the same bit shifted by 8 */
+#define PWM_CTL_TIMER_B_SHIFT    8
+
+/* The timer counts down from the load value, the output is high from the load
+ * until the match value, so the match sets the high time */
+#define PWM_LOAD_VALUE           (PWM_PERIOD_TICKS - 1UL)
+
+typedef char PWM_PeriodCheck[(PWM_LOAD_VALUE <= 0xFFFFUL) ? 1 : -1];
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+typedef struct
+{
+    uint32  ulTimerBase;
+    uint8   ucClockGateBit;  /* RCGCTIMER / PRTIMER bit */
+    boolean bTimerB;
+} PWM_ChannelConfigType;
+
+/*******************************************************************************
+ *                              Module Variables                               *
+ *******************************************************************************/
+/* Indexed by PWM_ChannelType */
+static const PWM_ChannelConfigType PWM_Channels[PWM_NUMBER_OF_CHANNELS] =
+{
+    { PWM_TIMER0_BASE, 0, FALSE },   /* PWM_TIMER0A_PB6 */
+    { PWM_TIMER1_BASE, 1, TRUE  }    /* PWM_TIMER1B_PF3 */
+};
+
+/*******************************************************************************
+ *                         Private Functions Definitions                       *
+ *******************************************************************************/
+
+/* Address of a timer A register of the channel, moved to timer B when the channel uses it */
+static uint32 PWM_RegisterAddress(const PWM_ChannelConfigType *pChannel, uint32 ulOffset)
+{
+    return pChannel->ulTimerBase + ulOffset + ((TRUE == pChannel->bTimerB) ? PWM_TIMER_B_OFFSET : 0U);
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void PWM_Init(void)
+{
+    const PWM_ChannelConfigType *pChannel;
+    uint32 ulEnableBit;
+    uint8 ucChannel;
+
+    for (ucChannel = 0; ucChannel < PWM_NUMBER_OF_CHANNELS; ucChannel++)
+    {
+        pChannel = &PWM_Channels[ucChannel];
+        ulEnableBit = (uint32)PWM_CTL_TNEN << ((TRUE == pChannel->bTimerB) ? PWM_CTL_TIMER_B_SHIFT : 0U);
+
+        /* Enable the timer clock and wait until it is ready for access */
+        SYSCTL_RCGCTIMER_REG |= (1UL << pChannel->ucClockGateBit);
+        while(!(SYSCTL_PRTIMER_REG & (1UL << pChannel->ucClockGateBit)));
+
+        HW_REG(pChannel->ulTimerBase + PWM_CTL_OFFSET) &= ~ulEnableBit;                  /* Disable the sub-timer while it is configured */
+        HW_REG(pChannel->ulTimerBase + PWM_CFG_OFFSET) = PWM_CFG_16_BIT;                 /* Split 16-bit timers, required for PWM mode */
+        HW_REG(PWM_RegisterAddress(pChannel, PWM_TNMR_OFFSET)) = PWM_TNMR_PWM_MODE;
+        HW_REG(PWM_RegisterAddress(pChannel, PWM_TNPR_OFFSET)) = 0;
+        HW_REG(PWM_RegisterAddress(pChannel, PWM_TNILR_OFFSET)) = PWM_LOAD_VALUE;
+        HW_REG(PWM_RegisterAddress(pChannel, PWM_TNMATCHR_OFFSET)) = PWM_LOAD_VALUE;  /* 0% duty */
+        HW_REG(pChannel->ulTimerBase + PWM_CTL_OFFSET) |= ulEnableBit;
+    }
+}
+
+void PWM_SetDutyCycle(PWM_ChannelType Channel, uint8 ucDutyPercent)
+{
+    if (Channel >= PWM_NUMBER_OF_CHANNELS)
+    {
+        return;
+    }
+    if (ucDutyPercent > PWM_MAX_DUTY_PERCENT)
+    {
+        ucDutyPercent = PWM_MAX_DUTY_PERCENT;
+    }
+
+    /* Match = load gives 0% (high for no tick), match = 0 gives 100% */
+    HW_REG(PWM_RegisterAddress(&PWM_Channels[Channel], PWM_TNMATCHR_OFFSET)) =
+            PWM_LOAD_VALUE - ((PWM_LOAD_VALUE * ucDutyPercent) / PWM_MAX_DUTY_PERCENT);
+}
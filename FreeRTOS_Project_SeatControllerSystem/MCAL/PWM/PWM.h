@@ -0,0 +1,56 @@
+ /******************************************************************************
+ *
+ * Module: PWM
+ *
+ * File Name: PWM.h
+ *
+ * Description: Header file for the TM4C123GH6PM PWM output driver built on the
+ *              16-bit GPTM timers in PWM mode. Once a duty cycle is written the
+ *              waveform is generated by the timer hardware, no CPU time is used.
+ *
+ * Author: Mohamed Hassan
+ *
+ *******************************************************************************/
+
+#ifndef PWM_H_
+#define PWM_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                              Configurations                                 *
+ *******************************************************************************/
+/* System clock feeding the GPTM timers */
+#define PWM_SYSTEM_CLOCK_HZ      16000000UL
+
+/* PWM output frequency, one period must fit the 16-bit timer (no prescaler used) */
+#define PWM_FREQUENCY_HZ         1000UL
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+/* PWM capable pins, the pin has to be muxed to its CCP function (alternate 7) in Port_PBcfg.c */
+typedef enum
+{
+    PWM_TIMER0A_PB6,    /* T0CCP0 */
+    PWM_TIMER1B_PF3,    /* T1CCP1 */
+    PWM_NUMBER_OF_CHANNELS
+} PWM_ChannelType;
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+#define PWM_PERIOD_TICKS         (PWM_SYSTEM_CLOCK_HZ / PWM_FREQUENCY_HZ)
+#define PWM_MAX_DUTY_PERCENT     (100U)
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/* Configure every PWM channel at PWM_FREQUENCY_HZ with a 0% duty cycle and start it */
+extern void PWM_Init(void);
+
+/* Set the duty cycle of a channel in percent (0 .. 100), takes effect at the next period */
+extern void PWM_SetDutyCycle(PWM_ChannelType Channel, uint8 ucDutyPercent);
+
+#endif /* PWM_H_ */
@@ -4,7 +4,14 @@
  *
  * File Name: uart0.c
  *
- * Description: Source file for the TM4C123GH6PM UART0 driver
+ * Description: Source file for the TM4C123GH6PM UART0 driver.
+ *              Transmission is interrupt driven: the send functions copy the data
+ *              into a software ring buffer and the UART0 interrupt refills the
+ *              16-byte hardware FIFO from it, so a caller only waits while the
+ *              ring is full.
+ *              The ring has a single producer: a mutex lets one sending task
+ *              at a time into it, so every call is queued whole and at most
+ *              one task waits for free space.
  *
  * Author: Edges for Training Team
  *
@@ -12,13 +19,112 @@
 
 #include "uart0.h"
 #include "tm4c123gh6pm_registers.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
 
+#define UART0_TX_BUFFER_MASK     (UART0_TX_BUFFER_SIZE - 1U)
+
+#if ((UART0_TX_BUFFER_SIZE & UART0_TX_BUFFER_MASK) != 0U)
+#error "UART0_TX_BUFFER_SIZE must be a power of two"
+#endif
+
+#if (configUSE_MUTEXES != 1)
+#error "UART0 serialises its senders with a mutex, configUSE_MUTEXES must be 1"
+#endif
+
+/*******************************************************************************
+ *                              Module Variables                               *
+ *******************************************************************************/
+static uint8 UART0_TxBuffer[UART0_TX_BUFFER_SIZE];
+static volatile uint16 UART0_TxHead = 0;   /* Written by the sending task only */
+static volatile uint16 UART0_TxTail = 0;   /* Written by the FIFO refill only */
+static volatile TaskHandle_t UART0_TxWaitingTask = NULL;
+static SemaphoreHandle_t UART0_TxMutex = NULL;    /* Held by the task queuing a call */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+static StaticSemaphore_t UART0_TxMutexBuffer;
+#endif
+
+/*******************************************************************************
+ *                         Private Functions Definitions                       *
+ *******************************************************************************/
+
+/* Move bytes from the ring buffer into the hardware FIFO until one of them is full/empty */
+static void UART0_TxFillFifo(void)
+{
+    uint16 tail = UART0_TxTail;
+
+    while ((tail != UART0_TxHead) && !(UART0_FR_REG & UART_FR_TXFF_MASK))
+    {
+        UART0_DR_REG = UART0_TxBuffer[tail];
+        tail = (tail + 1U) & UART0_TX_BUFFER_MASK;
+    }
+    UART0_TxTail = tail;
+}
+
+/* Start the transmission of newly queued bytes. The TX interrupt only fires when
+ * the FIFO level drops below the trigger, so the FIFO is primed here with the
+ * UART0 TX interrupt masked to keep the refill single-threaded */
+static void UART0_TxKick(void)
+{
+    UART0_IM_REG &= ~UART_IM_TXIM_MASK;
+    UART0_TxFillFifo();
+    UART0_IM_REG |= UART_IM_TXIM_MASK;
+}
+
+/* Let one sending task at a time into the ring. Before the scheduler runs (or
+ * while it is suspended) there is only one thread of execution and no lock */
+static void UART0_TxLock(void)
+{
+    if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+    {
+        (void)xSemaphoreTake(UART0_TxMutex, portMAX_DELAY);
+    }
+}
+
+static void UART0_TxUnlock(void)
+{
+    if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+    {
+        (void)xSemaphoreGive(UART0_TxMutex);
+    }
+}
+
+/* Append one byte to the ring buffer, waiting for free space if it is full */
+static void UART0_TxPut(uint8 data)
+{
+    uint16 nextHead = (UART0_TxHead + 1U) & UART0_TX_BUFFER_MASK;
+
+    while (nextHead == UART0_TxTail)
+    {
+        if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+        {
+            /* Register for the wake-up from the interrupt, then re-check so space
+             * freed in between is not missed. The notification is latched anyway */
+            UART0_TxWaitingTask = xTaskGetCurrentTaskHandle();
+            UART0_TxKick();
+            if (nextHead == UART0_TxTail)
+            {
+                ulTaskNotifyTakeIndexed(UART0_TX_NOTIFY_INDEX, pdTRUE, portMAX_DELAY);
+            }
+            UART0_TxWaitingTask = NULL;
+        }
+        else
+        {
+            /* No scheduler yet (or it is suspended): drain the FIFO by polling */
+            UART0_TxKick();
+        }
+    }
+
+    UART0_TxBuffer[UART0_TxHead] = data;
+    UART0_TxHead = nextHead;
+}
 
 /*******************************************************************************
  *                         Public Functions Definitions                        *
  *******************************************************************************/
 
-void UART0_Init(void) /* UART0 configuration: 1 start, 8 bits data, No Parity, 1 stop bit and 9600BPS */
+void UART0_Init(void) /* UART0 configuration: 1 start, 8 bits data, No Parity, 1 stop bit and UART0_BAUD_RATE */
 {
     
     SYSCTL_RCGCUART_REG |= 0x01;          /* Enable clock for UART0 */
@@ -28,20 +134,29 @@ void UART0_Init(void) /* UART0 configuration: 1 start, 8 bits data, No Parity, 1
 
     UART0_CC_REG  = 0;                    /* Use System Clock*/
     
-    /* To Configure UART0 with Baud Rate 9600 */
-    UART0_IBRD_REG = 104;
-    UART0_FBRD_REG = 11;
+    /* To Configure UART0 with Baud Rate UART0_BAUD_RATE */
+    UART0_IBRD_REG = UART0_IBRD_VALUE;
+    UART0_FBRD_REG = UART0_FBRD_VALUE;
     
     /* UART Line Control Register Settings
      * BRK = 0 Normal Use
      * PEN = 0 Disable Parity
      * EPS = 0 No affect as the parity is disabled
      * STP2 = 0 1-stop bit at end of the frame
-     * FEN = 0 FIFOs are disabled
+     * FEN = 1 FIFOs are enabled
      * WLEN = 0x3 8-bits data frame
      * SPS = 0 no stick parity
      */
-    UART0_LCRH_REG = (UART_DATA_8BITS << UART_LCRH_WLEN_BITS_POS);
+    UART0_LCRH_REG = (UART_DATA_8BITS << UART_LCRH_WLEN_BITS_POS) | UART_LCRH_FEN_MASK;
+
+    /* Raise the TX interrupt when the transmit FIFO drops to half full (8 bytes) */
+    UART0_IFLS_REG = UART_IFLS_TX4_8;
+    UART0_ICR_REG = UART_ICR_TXIC_MASK;
+    UART0_IM_REG = UART_IM_TXIM_MASK;
+
+    /* Set UART0 interrupt priority (INTB field of PRI1, bits 15:13) and enable it in the NVIC */
+    NVIC_PRI1_REG = (NVIC_PRI1_REG & 0xFFFF1FFF) | (UART0_INTERRUPT_PRIORITY << 13);
+    NVIC_EN0_REG = (1UL << UART0_INTERRUPT_NUMBER);
     
     /* UART Control Register Settings
      * RXE = 1 Enable UART Receive
@@ -50,12 +165,22 @@ void UART0_Init(void) /* UART0 configuration: 1 start, 8 bits data, No Parity, 1
      * UARTEN = 1 Enable UART
      */
     UART0_CTL_REG = UART_CTL_UARTEN_MASK | UART_CTL_TXE_MASK | UART_CTL_RXE_MASK;
+
+    /* Serialises the sending tasks once the scheduler runs */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    UART0_TxMutex = xSemaphoreCreateMutexStatic(&UART0_TxMutexBuffer);
+#else
+    UART0_TxMutex = xSemaphoreCreateMutex();
+#endif
+    configASSERT(UART0_TxMutex != NULL);
 }
        
 void UART0_SendByte(uint8 data)
 {
-    while(!(UART0_FR_REG & UART_FR_TXFE_MASK)); /* Wait until the transmit FIFO is empty */
-    UART0_DR_REG = data; /* Send the byte */
+    UART0_TxLock();
+    UART0_TxPut(data); /* Queue the byte */
+    UART0_TxKick();    /* Start the transmission if the FIFO has room */
+    UART0_TxUnlock();
 }
 
 uint8 UART0_ReceiveByte(void)
@@ -64,15 +189,47 @@ uint8 UART0_ReceiveByte(void)
     return UART0_DR_REG; /* Read the byte */
 }
 
+boolean UART0_TryReceiveByte(uint8 *pData)
+{
+    if (UART0_FR_REG & UART_FR_RXFE_MASK)
+    {
+        return FALSE; /* Receive FIFO empty */
+    }
+    *pData = (uint8)UART0_DR_REG;
+    return TRUE;
+}
+
 void UART0_SendString(const uint8 *pData)
 {
     uint32 uCounter =0;
-	/* Transmit the whole string */
+    UART0_TxLock();
+	/* Queue the whole string */
     while(pData[uCounter] != '\0')
     {
-        UART0_SendByte(pData[uCounter]); /* Send the byte */
+        UART0_TxPut(pData[uCounter]); /* Queue the byte */
         uCounter++; /* increment the counter to the next byte */
     }
+    UART0_TxKick();
+    UART0_TxUnlock();
+}
+
+void UART0_SendBuffer(const uint8 *pData, uint32 uLength)
+{
+    uint32 uCounter;
+    UART0_TxLock();
+    /* Queue the whole buffer, it may contain 0x00 bytes */
+    for (uCounter = 0; uCounter < uLength; uCounter++)
+    {
+        UART0_TxPut(pData[uCounter]); /* Queue the byte */
+    }
+    UART0_TxKick();
+    UART0_TxUnlock();
+}
+
+uint32 UART0_GetTxFreeSpace(void)
+{
+    /* One slot stays empty to tell a full ring from an empty one */
+    return (uint32)((UART0_TxTail - UART0_TxHead - 1U) & UART0_TX_BUFFER_MASK);
 }
 
 void UART0_SendInteger(sint64 sNumber)
@@ -81,10 +238,12 @@ void UART0_SendInteger(sint64 sNumber)
     uint8 uDigits[20];
     sint8 uCounter = 0;
 
+    UART0_TxLock();
+
     /* Send the negative sign in case of negative numbers */
     if (sNumber < 0)
     {
-        UART0_SendByte('-');
+        UART0_TxPut('-');
         sNumber *= -1;
     }
 
@@ -99,6 +258,27 @@ void UART0_SendInteger(sint64 sNumber)
     /* Send the array of characters in a reverse order as the digits were converted from right to left */
     for( uCounter--; uCounter>= 0; uCounter--)
     {
-        UART0_SendByte(uDigits[uCounter]);
+        UART0_TxPut(uDigits[uCounter]);
+    }
+    UART0_TxKick();
+    UART0_TxUnlock();
+}
+
+void UART0_Handler(void)
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    TaskHandle_t xWaitingTask;
+
+    UART0_ICR_REG = UART_ICR_TXIC_MASK; /* Clear the TX interrupt flag */
+    UART0_TxFillFifo();                 /* Refill the FIFO from the ring buffer */
+
+    /* Space was freed in the ring, release a task waiting for it */
+    xWaitingTask = UART0_TxWaitingTask;
+    if (xWaitingTask != NULL)
+    {
+        UART0_TxWaitingTask = NULL;
+        vTaskNotifyGiveIndexedFromISR(xWaitingTask, UART0_TX_NOTIFY_INDEX, &xHigherPriorityTaskWoken);
     }
+
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 }
@@ -15,6 +15,26 @@
 
 #include "std_types.h"
 
+/*******************************************************************************
+ *                              Configurations                                 *
+ *******************************************************************************/
+/* System clock feeding UART0 (UARTCC = System Clock) */
+#define UART0_SYSTEM_CLOCK_HZ    16000000UL
+
+/* UART0 baud rate, the divisors are calculated at compile time from it */
+#define UART0_BAUD_RATE          9600UL
+
+/* Size of the software transmit ring buffer, must be a power of two.
+ * Callers of the send functions only block while this ring is full */
+#define UART0_TX_BUFFER_SIZE     256U
+
+/* Task notification index used to wake a task blocked on a full transmit ring,
+ * index 0 is left free for the application signalling */
+#define UART0_TX_NOTIFY_INDEX    1U
+
+/* UART0 interrupt priority, must not be above configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY */
+#define UART0_INTERRUPT_PRIORITY 6U
+
 /*******************************************************************************
  *                             Preprocessor Macros                             *
  *******************************************************************************/
@@ -23,24 +43,52 @@
 #define UART_DATA_7BITS          0x2
 #define UART_DATA_8BITS          0x3
 #define UART_LCRH_WLEN_BITS_POS  5
+#define UART_LCRH_FEN_MASK       0x00000010
 #define UART_CTL_UARTEN_MASK     0x00000001
 #define UART_CTL_TXE_MASK        0x00000100
 #define UART_CTL_RXE_MASK        0x00000200
+#define UART_FR_TXFF_MASK        0x00000020
 #define UART_FR_TXFE_MASK        0x00000080
 #define UART_FR_RXFE_MASK        0x00000010
+#define UART_IFLS_TX4_8          0x00000002
+#define UART_IM_TXIM_MASK        0x00000020
+#define UART_ICR_TXIC_MASK       0x00000020
+#define UART0_INTERRUPT_NUMBER   5U
+
+/* Integer and fractional baud rate divisors: BRD = UARTSysClk / (16 * Baud Rate),
+ * FBRD = round(fraction(BRD) * 64) */
+#define UART0_IBRD_VALUE         (UART0_SYSTEM_CLOCK_HZ / (16UL * UART0_BAUD_RATE))
+#define UART0_FBRD_VALUE         ((((UART0_SYSTEM_CLOCK_HZ * 8UL) / UART0_BAUD_RATE) - (UART0_IBRD_VALUE * 128UL) + 1UL) / 2UL)
 
 /*******************************************************************************
  *                            Functions Prototypes                             *
  *******************************************************************************/
 
+/* Creates the transmit mutex, so it is called before the scheduler starts */
 extern void UART0_Init(void);
 
+/* The send functions may be called from any task, never from an interrupt.
+ * Each call is queued whole: a mutex holds other senders back until it is,
+ * so the lines of two tasks do not mix within a call. A report made of
+ * several calls is only kept together by the tasks taking turns on UART0 */
+
 extern void UART0_SendByte(uint8 data);
 
 extern uint8 UART0_ReceiveByte(void);
 
+/* Read a received byte if there is one, returns FALSE without waiting otherwise */
+extern boolean UART0_TryReceiveByte(uint8 *pData);
+
 extern void UART0_SendString(const uint8 *pData);
 
+extern void UART0_SendBuffer(const uint8 *pData, uint32 uLength);
+
 extern void UART0_SendInteger(sint64 sNumber);
 
+/* Bytes that can be queued without blocking the sender */
+extern uint32 UART0_GetTxFreeSpace(void);
+
+/* UART0 Rx/Tx interrupt handler, placed in the vector table */
+extern void UART0_Handler(void);
+
 #endif
@@ -0,0 +1,76 @@
+ /******************************************************************************
+ *
+ * Module: Common - MCAL
+ *
+ * File Name: hw_access.h
+ *
+ * Description: Memory-mapped register access macros used by all MCAL register
+ *              definitions. On the target every register is a fixed address in
+ *              the TM4C123GH6PM memory map. Building with TM4C_HOST_SIM defined
+ *              redirects every access into the emulated peripheral block of the
+ *              Linux host simulation (see hw_sim.c), and the core instructions
+ *              below into the simulated board (Tools/firmware_sim.c).
+ *
+ * Author: Mohamed Hassan
+ *
+ *******************************************************************************/
+
+#ifndef HW_ACCESS_H_
+#define HW_ACCESS_H_
+
+#include "std_types.h"
+
+#ifdef TM4C_HOST_SIM
+
+/* Returns the emulated storage backing the peripheral register at the given address */
+extern volatile uint32 * Sim_PeripheralAddress(uint32 address);
+
+#define HW_ADDRESS(address)       (Sim_PeripheralAddress((uint32)(address)))
+
+/* PRIMASK and the sleep of the emulated core, the board wakes it at its next event */
+extern void Sim_DisableInterrupts(void);
+extern void Sim_EnableInterrupts(void);
+extern void Sim_WaitForInterrupt(void);
+
+#define HW_DISABLE_INTERRUPTS()   Sim_DisableInterrupts()
+#define HW_ENABLE_INTERRUPTS()    Sim_EnableInterrupts()
+#define HW_WAIT_FOR_INTERRUPT()   Sim_WaitForInterrupt()
+#define HW_DSB()                  ((void)0)
+#define HW_ISB()                  ((void)0)
+
+#else
+
+#define HW_ADDRESS(address)       ((volatile uint32 *)(address))
+
+/* Set and clear PRIMASK, sleep until an interrupt, data and instruction synchronisation barriers */
+#define HW_DISABLE_INTERRUPTS()   __asm("	cpsid i")
+#define HW_ENABLE_INTERRUPTS()    __asm("	cpsie i")
+#define HW_WAIT_FOR_INTERRUPT()   __asm("	wfi")
+#define HW_DSB()                  __asm("	dsb")
+#define HW_ISB()                  __asm("	isb")
+
+#endif /* TM4C_HOST_SIM */
+
+/* 32-bit peripheral register located at the given address */
+#define HW_REG(address)           (*HW_ADDRESS(address))
+
+/* Interrupt entry and exit events of the MCAL handlers for the kernel trace recorder
+ * (Services/Trace.h). Must be STD_ON exactly when TRACE_OUTPUT is, Services/Trace.c checks it */
+#define MCAL_ISR_TRACE            STD_OFF
+
+#if (MCAL_ISR_TRACE == STD_ON)
+
+extern void Trace_IsrEnter(void);
+extern void Trace_IsrExit(void);
+
+#define MCAL_ISR_ENTER()          Trace_IsrEnter()
+#define MCAL_ISR_EXIT()           Trace_IsrExit()
+
+#else
+
+#define MCAL_ISR_ENTER()
+#define MCAL_ISR_EXIT()
+
+#endif /* MCAL_ISR_TRACE */
+
+#endif /* HW_ACCESS_H_ */
@@ -0,0 +1,115 @@
+ /******************************************************************************
+ *
+ * Module: Common - MCAL
+ *
+ * File Name: hw_sim.c
+ *
+ * Description: Emulated TM4C123GH6PM peripheral block for the Linux host
+ *              simulation. Only compiled into the firmware image when
+ *              TM4C_HOST_SIM is defined, otherwise this file is empty.
+ *
+ *              Every 4 KB peripheral page touched by the MCAL drivers is
+ *              backed by a RAM page allocated on first access, so the drivers
+ *              run unmodified on top of HW_REG(). The clock-gating "peripheral
+ *              ready" registers read back as ready and the UART reports an
+ *              empty transmit FIFO, so driver initialisation never spins.
+ *              The pages hold still, Tools/firmware_sim.c puts a board with
+ *              a virtual clock in front of them to run the whole firmware.
+ *
+ * Author: Mohamed Hassan
+ *
+ *******************************************************************************/
+
+#ifdef TM4C_HOST_SIM
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "hw_access.h"
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+#define SIM_PAGE_SIZE_BYTES        (0x1000U)
+#define SIM_PAGE_SIZE_WORDS        (SIM_PAGE_SIZE_BYTES / 4U)
+#define SIM_MAX_PAGES              (32U)
+
+#define SIM_SYSCTL_PAGE            (0x400FE000U)
+#define SIM_SYSCTL_PR_FIRST        (0xA00U)    /* PRWD offset, first "peripheral ready" register  */
+#define SIM_SYSCTL_PR_LAST         (0xA6CU)    /* PRWTIMER .. PREEPROM block ends here            */
+
+#define SIM_UART0_PAGE             (0x4000C000U)
+#define SIM_UART_FR_OFFSET         (0x018U)
+#define SIM_UART_FR_RESET_VALUE    (0x00000090U) /* TXFE | RXFE */
+
+/* Registers are 32 bits wide for the byte offsets of the drivers to match the target,
+ * Platform_Types.h keeps uint32 at 32 bits on 64-bit hosts */
+typedef char Sim_Uint32SizeCheck[(sizeof(uint32) == 4U) ? 1 : -1];
+
+/*******************************************************************************
+ *                              Module Variables                               *
+ *******************************************************************************/
+static uint32 Sim_PageBase[SIM_MAX_PAGES];
+static uint32 Sim_PageData[SIM_MAX_PAGES][SIM_PAGE_SIZE_WORDS];
+static uint8  Sim_PageCount = 0;
+
+/*******************************************************************************
+ *                         Private Functions Definitions                       *
+ *******************************************************************************/
+
+/* Apply the reset values the drivers rely on to a freshly allocated page */
+static void Sim_PageReset(uint32 base, uint32 *data)
+{
+    uint32 offset;
+
+    if (SIM_SYSCTL_PAGE == base)
+    {
+        for (offset = SIM_SYSCTL_PR_FIRST; offset <= SIM_SYSCTL_PR_LAST; offset += 4U)
+        {
+            data[offset / 4U] = 0xFFFFFFFFUL;
+        }
+    }
+    else if (SIM_UART0_PAGE == base)
+    {
+        data[SIM_UART_FR_OFFSET / 4U] = SIM_UART_FR_RESET_VALUE;
+    }
+    else
+    {
+        /* All other registers reset to zero */
+    }
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+volatile uint32 * Sim_PeripheralAddress(uint32 address)
+{
+    uint32 base = address & ~(SIM_PAGE_SIZE_BYTES - 1U);
+    uint32 offset = address & (SIM_PAGE_SIZE_BYTES - 1U);
+    uint8 page;
+
+    for (page = 0; page < Sim_PageCount; page++)
+    {
+        if (Sim_PageBase[page] == base)
+        {
+            return &Sim_PageData[page][offset / 4U];
+        }
+    }
+
+    /* First access to this peripheral, map a new page for it.
+     * Running out of pages means a new peripheral was added: raise SIM_MAX_PAGES */
+    if (Sim_PageCount >= SIM_MAX_PAGES)
+    {
+        fprintf(stderr, "hw_sim: no page left for the peripheral at 0x%08lX, raise SIM_MAX_PAGES (%u)\n",
+                (unsigned long)base, (unsigned)SIM_MAX_PAGES);
+        abort();
+    }
+    page = Sim_PageCount++;
+    Sim_PageBase[page] = base;
+    Sim_PageReset(base, Sim_PageData[page]);
+
+    return &Sim_PageData[page][offset / 4U];
+}
+
+#endif /* TM4C_HOST_SIM */
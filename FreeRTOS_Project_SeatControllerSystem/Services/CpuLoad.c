@@ -0,0 +1,228 @@
+/******************************************************************************
+ *
+ * Module: CpuLoad
+ *
+ * File Name: CpuLoad.c
+ *
+ * Description: Source file for the sliding-window CPU utilisation service.
+ *              Every window keeps running sums of the samples it covers: the
+ *              newest sample is added and the one leaving the window subtracted,
+ *              so an update costs the same for a 1 s and a 60 s window.
+ *              Tools/cpu_load_sim.c compares the windows with the old average
+ *              since boot on a load spike.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include "CpuLoad.h"
+#include "SeqLock.h"
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+/* A sample delayed past twice its period (the caller was starved) is scaled down to this length */
+#define CPULOAD_MAX_SAMPLE_TICKS         (2UL * CPULOAD_SAMPLE_PERIOD_MS * TIMEBASE_TICKS_PER_MS)
+
+/* 0.1 % units */
+#define CPULOAD_FULL_SCALE               (1000U)
+
+/* The window sums are 32-bit */
+typedef char CpuLoad_WindowSumsFit[((CPULOAD_LONG_WINDOW_SAMPLES * (uint64)CPULOAD_MAX_SAMPLE_TICKS) <= 0xFFFFFFFFUL) ? 1 : -1];
+
+/* Each window lies within the history */
+typedef char CpuLoad_WindowsFitHistory[((CPULOAD_SHORT_WINDOW_SAMPLES >= 1U) &&
+                                        (CPULOAD_SHORT_WINDOW_SAMPLES <= CPULOAD_MEDIUM_WINDOW_SAMPLES) &&
+                                        (CPULOAD_MEDIUM_WINDOW_SAMPLES <= CPULOAD_LONG_WINDOW_SAMPLES) &&
+                                        (CPULOAD_LONG_WINDOW_SAMPLES <= 255U)) ? 1 : -1];
+
+/*******************************************************************************
+ *                              Module Variables                               *
+ *******************************************************************************/
+/* Indexed by CpuLoad_WindowType */
+static const uint8 CpuLoad_WindowSamples[CPULOAD_NUMBER_OF_WINDOWS] =
+{
+    CPULOAD_SHORT_WINDOW_SAMPLES,
+    CPULOAD_MEDIUM_WINDOW_SAMPLES,
+    CPULOAD_LONG_WINDOW_SAMPLES
+};
+
+/* Only used by CpuLoad_Init and CpuLoad_Update, both run in one task */
+static uint32 CpuLoad_TaskHistory[CPULOAD_LONG_WINDOW_SAMPLES][CPULOAD_NUMBER_OF_TASKS];  /* Ticks run per sample */
+static uint32 CpuLoad_ElapsedHistory[CPULOAD_LONG_WINDOW_SAMPLES];                       /* Length of every sample */
+static uint32 CpuLoad_TaskSums[CPULOAD_NUMBER_OF_WINDOWS][CPULOAD_NUMBER_OF_TASKS];
+static uint32 CpuLoad_ElapsedSums[CPULOAD_NUMBER_OF_WINDOWS];
+static uint64 CpuLoad_LastTotals[CPULOAD_NUMBER_OF_TASKS];
+static Timebase_TicksType CpuLoad_LastTime;
+static uint8 CpuLoad_NextSample;                   /* History slot the next sample goes to */
+static uint8 CpuLoad_SampleCount;                  /* Samples in the history, up to the long window */
+
+/* Published results, read through CpuLoad_Lock */
+static CpuLoad_WindowStatsType CpuLoad_Stats[CPULOAD_NUMBER_OF_WINDOWS];
+static SeqLock_Type CpuLoad_Lock;
+
+/*******************************************************************************
+ *                         Private Functions Definitions                       *
+ *******************************************************************************/
+
+/* Part of ulElapsed taken by ulTime, rounded to 0.1 % */
+static uint16 CpuLoad_Share(uint32 ulTime, uint32 ulElapsed)
+{
+    uint32 ulShare;
+
+    if (0U == ulElapsed)
+    {
+        return 0U;
+    }
+    ulShare = (uint32)((((uint64)ulTime * CPULOAD_FULL_SCALE) + (ulElapsed / 2U)) / ulElapsed);
+
+    /* A task running across a sample boundary counts in the next sample as a whole */
+    return (uint16)((ulShare > CPULOAD_FULL_SCALE) ? CPULOAD_FULL_SCALE : ulShare);
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void CpuLoad_Init(const uint64 *pTaskTotals, Timebase_TicksType ullNow)
+{
+    uint8 ucWindow;
+    uint8 ucTask;
+    uint8 ucSample;
+
+    for (ucTask = 0; ucTask < CPULOAD_NUMBER_OF_TASKS; ucTask++)
+    {
+        CpuLoad_LastTotals[ucTask] = pTaskTotals[ucTask];
+        for (ucSample = 0; ucSample < CPULOAD_LONG_WINDOW_SAMPLES; ucSample++)
+        {
+            CpuLoad_TaskHistory[ucSample][ucTask] = 0;
+        }
+    }
+    for (ucSample = 0; ucSample < CPULOAD_LONG_WINDOW_SAMPLES; ucSample++)
+    {
+        CpuLoad_ElapsedHistory[ucSample] = 0;
+    }
+    for (ucWindow = 0; ucWindow < CPULOAD_NUMBER_OF_WINDOWS; ucWindow++)
+    {
+        CpuLoad_ElapsedSums[ucWindow] = 0;
+        CpuLoad_Stats[ucWindow].usLoad = 0;
+        CpuLoad_Stats[ucWindow].usPeakLoad = 0;
+        CpuLoad_Stats[ucWindow].ullPeakTime = 0;
+        for (ucTask = 0; ucTask < CPULOAD_NUMBER_OF_TASKS; ucTask++)
+        {
+            CpuLoad_TaskSums[ucWindow][ucTask] = 0;
+            CpuLoad_Stats[ucWindow].usTaskShare[ucTask] = 0;
+        }
+    }
+    CpuLoad_LastTime = ullNow;
+    CpuLoad_NextSample = 0;
+    CpuLoad_SampleCount = 0;
+    SeqLock_Init(&CpuLoad_Lock);
+}
+
+void CpuLoad_Update(const uint64 *pTaskTotals, Timebase_TicksType ullNow)
+{
+    CpuLoad_WindowStatsType xStats[CPULOAD_NUMBER_OF_WINDOWS];
+    uint64 ullTaskTime[CPULOAD_NUMBER_OF_TASKS];
+    uint64 ullElapsed;
+    uint32 ulOldest;
+    uint8 ucWindow;
+    uint8 ucTask;
+
+    ullElapsed = ullNow - CpuLoad_LastTime;
+    CpuLoad_LastTime = ullNow;
+    for (ucTask = 0; ucTask < CPULOAD_NUMBER_OF_TASKS; ucTask++)
+    {
+        ullTaskTime[ucTask] = pTaskTotals[ucTask] - CpuLoad_LastTotals[ucTask];
+        CpuLoad_LastTotals[ucTask] = pTaskTotals[ucTask];
+    }
+
+    /* Keep the shares of an overlong sample, but not its length */
+    if (ullElapsed > CPULOAD_MAX_SAMPLE_TICKS)
+    {
+        for (ucTask = 0; ucTask < CPULOAD_NUMBER_OF_TASKS; ucTask++)
+        {
+            ullTaskTime[ucTask] = (ullTaskTime[ucTask] * CPULOAD_MAX_SAMPLE_TICKS) / ullElapsed;
+        }
+        ullElapsed = CPULOAD_MAX_SAMPLE_TICKS;
+    }
+    for (ucTask = 0; ucTask < CPULOAD_NUMBER_OF_TASKS; ucTask++)
+    {
+        if (ullTaskTime[ucTask] > ullElapsed)
+        {
+            ullTaskTime[ucTask] = ullElapsed;
+        }
+    }
+
+    /* Slide every window by one sample. The oldest sample of the long window is the one
+     * about to be overwritten, so it leaves the sums first */
+    for (ucWindow = 0; ucWindow < CPULOAD_NUMBER_OF_WINDOWS; ucWindow++)
+    {
+        if (CpuLoad_SampleCount >= CpuLoad_WindowSamples[ucWindow])
+        {
+            ulOldest = ((uint32)CpuLoad_NextSample + CPULOAD_LONG_WINDOW_SAMPLES - CpuLoad_WindowSamples[ucWindow]) % CPULOAD_LONG_WINDOW_SAMPLES;
+            CpuLoad_ElapsedSums[ucWindow] -= CpuLoad_ElapsedHistory[ulOldest];
+            for (ucTask = 0; ucTask < CPULOAD_NUMBER_OF_TASKS; ucTask++)
+            {
+                CpuLoad_TaskSums[ucWindow][ucTask] -= CpuLoad_TaskHistory[ulOldest][ucTask];
+            }
+        }
+    }
+
+    CpuLoad_ElapsedHistory[CpuLoad_NextSample] = (uint32)ullElapsed;
+    for (ucTask = 0; ucTask < CPULOAD_NUMBER_OF_TASKS; ucTask++)
+    {
+        CpuLoad_TaskHistory[CpuLoad_NextSample][ucTask] = (uint32)ullTaskTime[ucTask];
+    }
+    CpuLoad_NextSample = (uint8)((CpuLoad_NextSample + 1U) % CPULOAD_LONG_WINDOW_SAMPLES);
+    if (CpuLoad_SampleCount < CPULOAD_LONG_WINDOW_SAMPLES)
+    {
+        CpuLoad_SampleCount++;
+    }
+
+    /* A window not filled yet covers the samples taken so far */
+    for (ucWindow = 0; ucWindow < CPULOAD_NUMBER_OF_WINDOWS; ucWindow++)
+    {
+        CpuLoad_ElapsedSums[ucWindow] += (uint32)ullElapsed;
+        for (ucTask = 0; ucTask < CPULOAD_NUMBER_OF_TASKS; ucTask++)
+        {
+            CpuLoad_TaskSums[ucWindow][ucTask] += (uint32)ullTaskTime[ucTask];
+            xStats[ucWindow].usTaskShare[ucTask] = CpuLoad_Share(CpuLoad_TaskSums[ucWindow][ucTask], CpuLoad_ElapsedSums[ucWindow]);
+        }
+        xStats[ucWindow].usLoad = CPULOAD_FULL_SCALE - xStats[ucWindow].usTaskShare[CPULOAD_IDLE_TASK];
+
+        /* Only full windows count for the peak, a partial one is a shorter window */
+        xStats[ucWindow].usPeakLoad = CpuLoad_Stats[ucWindow].usPeakLoad;
+        xStats[ucWindow].ullPeakTime = CpuLoad_Stats[ucWindow].ullPeakTime;
+        if ((CpuLoad_SampleCount >= CpuLoad_WindowSamples[ucWindow]) && (xStats[ucWindow].usLoad > xStats[ucWindow].usPeakLoad))
+        {
+            xStats[ucWindow].usPeakLoad = xStats[ucWindow].usLoad;
+            xStats[ucWindow].ullPeakTime = ullNow;
+        }
+    }
+
+    SeqLock_WriteBegin(&CpuLoad_Lock);
+    for (ucWindow = 0; ucWindow < CPULOAD_NUMBER_OF_WINDOWS; ucWindow++)
+    {
+        CpuLoad_Stats[ucWindow] = xStats[ucWindow];
+    }
+    SeqLock_WriteEnd(&CpuLoad_Lock);
+}
+
+void CpuLoad_GetWindow(CpuLoad_WindowType Window, CpuLoad_WindowStatsType *pStats)
+{
+    uint32 ulSequence;
+
+    do
+    {
+        ulSequence = SeqLock_ReadBegin(&CpuLoad_Lock);
+        *pStats = CpuLoad_Stats[Window];
+    }
+    while (TRUE == SeqLock_ReadRetry(&CpuLoad_Lock, ulSequence));
+}
+
+uint16 CpuLoad_GetLoad(CpuLoad_WindowType Window)
+{
+    CpuLoad_WindowStatsType xStats;
+
+    CpuLoad_GetWindow(Window, &xStats);
+    return xStats.usLoad;
+}
@@ -0,0 +1,76 @@
+/******************************************************************************
+ *
+ * Module: CpuLoad
+ *
+ * File Name: CpuLoad.h
+ *
+ * Description: Header file for the sliding-window CPU utilisation service.
+ *              Every sample period the run time of each task tag is turned into
+ *              the time it ran during that period and kept in a history of the
+ *              last samples. The load and the share of every task are computed
+ *              over a short, a medium and a long window of that history, so a
+ *              spike shows up instead of vanishing in the average since boot.
+ *              The load is derived from the idle task: whatever did not run in
+ *              the idle task kept the CPU busy (interrupts included).
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#ifndef CPULOAD_H
+#define CPULOAD_H
+
+#include "std_types.h"
+#include "Timebase.h"
+
+/*******************************************************************************
+ *                              Configurations                                 *
+ *******************************************************************************/
+/* Run time slots, one per task tag, checked against NUMBER_OF_TASK_TAGS in main.c */
+#define CPULOAD_NUMBER_OF_TASKS          (8U)
+#define CPULOAD_IDLE_TASK                (0U)
+
+/* CpuLoad_Update period, checked against RUNTIME_MEASUREMENTS_TASK_PERIODICITY in main.c */
+#define CPULOAD_SAMPLE_PERIOD_MS         (1000U)
+
+/* Window lengths in samples, the long window sets the history size */
+#define CPULOAD_SHORT_WINDOW_SAMPLES     (1U)
+#define CPULOAD_MEDIUM_WINDOW_SAMPLES    (10U)
+#define CPULOAD_LONG_WINDOW_SAMPLES      (60U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+typedef enum
+{
+    CPULOAD_SHORT_WINDOW,
+    CPULOAD_MEDIUM_WINDOW,
+    CPULOAD_LONG_WINDOW,
+    CPULOAD_NUMBER_OF_WINDOWS
+} CpuLoad_WindowType;
+
+/* Utilisation over one window, all values in 0.1 % */
+typedef struct
+{
+    uint16 usLoad;                                  /* Time not spent in the idle task */
+    uint16 usPeakLoad;                              /* Highest usLoad of a full window since start-up */
+    Timebase_TicksType ullPeakTime;                 /* End of the window that had usPeakLoad */
+    uint16 usTaskShare[CPULOAD_NUMBER_OF_TASKS];    /* Run time of every task tag */
+} CpuLoad_WindowStatsType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/* Start the history from the current run time totals (Timebase ticks per task tag) */
+void CpuLoad_Init(const uint64 *pTaskTotals, Timebase_TicksType ullNow);
+
+/* Add the sample ending now and recompute every window, called every CPULOAD_SAMPLE_PERIOD_MS
+ * with totals and a timestamp taken together */
+void CpuLoad_Update(const uint64 *pTaskTotals, Timebase_TicksType ullNow);
+
+/* Consistent copy of one window, from any task */
+void CpuLoad_GetWindow(CpuLoad_WindowType Window, CpuLoad_WindowStatsType *pStats);
+
+/* Load of one window in 0.1 %, from any task */
+uint16 CpuLoad_GetLoad(CpuLoad_WindowType Window);
+
+#endif /* CPULOAD_H */
@@ -0,0 +1,358 @@
+/******************************************************************************
+ *
+ * Module: Dashboard
+ *
+ * File Name: Dashboard.c
+ *
+ * Description: Source file for the UART dashboard screen-model renderer.
+ *              The static labels are drawn once. Every value field keeps a shadow
+ *              copy of the characters last sent, and an update only transmits a
+ *              cursor move plus the span of characters that differ from it.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include "Dashboard.h"
+#include "uart0.h"
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+typedef struct
+{
+    uint8 ucRow;
+    uint8 ucColumn;
+    const uint8 *pText;
+} Dashboard_LabelType;
+
+typedef struct
+{
+    uint8 ucRow;
+    uint8 ucColumn;
+    uint8 ucWidth;
+} Dashboard_FieldLayoutType;
+
+/*******************************************************************************
+ *                              Screen Layout                                  *
+ *******************************************************************************/
+static const Dashboard_LabelType Dashboard_Labels[] =
+{
+    { 3,  1, (const uint8 *)"HEATER STATE:" },
+    { 5,  1, (const uint8 *)"Required Temp:" },
+    { 7,  1, (const uint8 *)"Current Temp:" },
+    { 9,  1, (const uint8 *)"IdleTask execution time is" },
+    {10,  1, (const uint8 *)"SeatButtonTask execution time is" },
+    {11,  1, (const uint8 *)"HeaterMonitorTask execution time is" },
+    {12,  1, (const uint8 *)"HeaterControlTask execution time is" },
+    {13,  1, (const uint8 *)"GetCurrentTempTask execution time is" },
+    {14,  1, (const uint8 *)"DashboardDisplayTask execution time is" },
+    {15,  1, (const uint8 *)"FailureHandleTask execution time is" },
+    {16,  1, (const uint8 *)"RunTimeMeasurementsTask execution time is" },
+    { 9, 61, (const uint8 *)"msec" },
+    {10, 61, (const uint8 *)"msec" },
+    {11, 61, (const uint8 *)"msec" },
+    {12, 61, (const uint8 *)"msec" },
+    {13, 61, (const uint8 *)"msec" },
+    {14, 61, (const uint8 *)"msec" },
+    {15, 61, (const uint8 *)"msec" },
+    {16, 61, (const uint8 *)"msec" },
+    { 8, 66, (const uint8 *)"10 s share" },       /* CPULOAD_MEDIUM_WINDOW */
+    { 9, 72, (const uint8 *)"%" },
+    {10, 72, (const uint8 *)"%" },
+    {11, 72, (const uint8 *)"%" },
+    {12, 72, (const uint8 *)"%" },
+    {13, 72, (const uint8 *)"%" },
+    {14, 72, (const uint8 *)"%" },
+    {15, 72, (const uint8 *)"%" },
+    {16, 72, (const uint8 *)"%" },
+    {18,  1, (const uint8 *)"CPU Load (1 s / 10 s / 60 s):" },
+    {18, 38, (const uint8 *)"%" },
+    {18, 46, (const uint8 *)"%" },
+    {18, 54, (const uint8 *)"%" },
+    {19,  1, (const uint8 *)"Peak Load (1 s / 10 s / 60 s):" },
+    {19, 38, (const uint8 *)"%" },
+    {19, 46, (const uint8 *)"%" },
+    {19, 54, (const uint8 *)"%" },
+    {20,  1, (const uint8 *)"Stacks near overflow:" },
+    {20, 38, (const uint8 *)"('s' for the stack report)" },
+    {21,  1, (const uint8 *)"Tick interrupts saved:" },
+    {21, 38, (const uint8 *)"% (tickless idle)" },
+    {22,  1, (const uint8 *)"Bytes sent by the last frame:" }
+};
+
+/* Indexed by Dashboard_FieldType up to DASHBOARD_FIRST_SEAT_FIELD */
+static const Dashboard_FieldLayoutType Dashboard_Fields[DASHBOARD_FIRST_SEAT_FIELD] =
+{
+    { 9, 50, 10 },   /* DASHBOARD_IDLE_TASK_TIME            */
+    {10, 50, 10 },   /* DASHBOARD_SEAT_BUTTON_TASK_TIME     */
+    {11, 50, 10 },   /* DASHBOARD_HEATER_MONITOR_TASK_TIME  */
+    {12, 50, 10 },   /* DASHBOARD_HEATER_CONTROL_TASK_TIME  */
+    {13, 50, 10 },   /* DASHBOARD_CURRENT_TEMP_TASK_TIME    */
+    {14, 50, 10 },   /* DASHBOARD_DISPLAY_TASK_TIME         */
+    {15, 50, 10 },   /* DASHBOARD_FAILURE_TASK_TIME         */
+    {16, 50, 10 },   /* DASHBOARD_RUNTIME_TASK_TIME         */
+    { 9, 66,  5 },   /* DASHBOARD_IDLE_TASK_SHARE           */
+    {10, 66,  5 },   /* DASHBOARD_SEAT_BUTTON_TASK_SHARE    */
+    {11, 66,  5 },   /* DASHBOARD_HEATER_MONITOR_TASK_SHARE */
+    {12, 66,  5 },   /* DASHBOARD_HEATER_CONTROL_TASK_SHARE */
+    {13, 66,  5 },   /* DASHBOARD_CURRENT_TEMP_TASK_SHARE   */
+    {14, 66,  5 },   /* DASHBOARD_DISPLAY_TASK_SHARE        */
+    {15, 66,  5 },   /* DASHBOARD_FAILURE_TASK_SHARE        */
+    {16, 66,  5 },   /* DASHBOARD_RUNTIME_TASK_SHARE        */
+    {18, 32,  5 },   /* DASHBOARD_CPU_LOAD_FIELD(0)         */
+    {18, 40,  5 },   /* DASHBOARD_CPU_LOAD_FIELD(1)         */
+    {18, 48,  5 },   /* DASHBOARD_CPU_LOAD_FIELD(2)         */
+    {19, 32,  5 },   /* DASHBOARD_CPU_PEAK_LOAD_FIELD(0)    */
+    {19, 40,  5 },   /* DASHBOARD_CPU_PEAK_LOAD_FIELD(1)    */
+    {19, 48,  5 },   /* DASHBOARD_CPU_PEAK_LOAD_FIELD(2)    */
+    {20, 32,  5 },   /* DASHBOARD_STACK_WARNINGS            */
+    {21, 32,  5 },   /* DASHBOARD_TICKS_SUPPRESSED          */
+    {22, 32,  5 }    /* DASHBOARD_LAST_FRAME_BYTES          */
+};
+
+/* Indexed by Dashboard_SeatFieldType, the column is that of the first seat and moves
+ * right by DASHBOARD_SEAT_COLUMN_WIDTH for every following seat */
+static const Dashboard_FieldLayoutType Dashboard_SeatFields[DASHBOARD_FIELDS_PER_SEAT] =
+{
+    { 1, 17, 16 },   /* DASHBOARD_SEAT_NAME                 */
+    { 3, 20,  6 },   /* DASHBOARD_SEAT_HEATER_STATE         */
+    { 5, 20,  4 },   /* DASHBOARD_SEAT_REQUIRED_TEMP        */
+    { 7, 20,  5 }    /* DASHBOARD_SEAT_CURRENT_TEMP         */
+};
+
+/* The layout above has a load and a peak load field for three windows */
+typedef char Dashboard_LoadFieldsLaidOut[(DASHBOARD_NUMBER_OF_LOAD_WINDOWS == 3U) ? 1 : -1];
+
+/* The widest seat field must still end before the next seat column */
+typedef char Dashboard_SeatFieldsFitColumn[(DASHBOARD_SEAT_COLUMN_WIDTH >= 16U + 3U) ? 1 : -1];
+
+#define DASHBOARD_NUMBER_OF_LABELS   (sizeof(Dashboard_Labels) / sizeof(Dashboard_Labels[0]))
+
+/* "\033[" + row + ";" + column + "H" */
+#define DASHBOARD_CURSOR_MOVE_MAX    (10U)
+
+/*******************************************************************************
+ *                              Module Variables                               *
+ *******************************************************************************/
+/* Characters last sent for every field, a 0 byte never matches so it marks a stale field */
+static uint8 Dashboard_Shadow[DASHBOARD_NUMBER_OF_FIELDS][DASHBOARD_MAX_FIELD_WIDTH];
+static uint32 Dashboard_FrameBytes = 0;
+static uint32 Dashboard_LastFrameBytes = 0;
+static uint32 Dashboard_FrameCount = 0;
+
+/*******************************************************************************
+ *                         Private Functions Definitions                       *
+ *******************************************************************************/
+
+/* Append the decimal representation of Value to pBuffer, returns the new length */
+static uint8 Dashboard_AppendDecimal(uint8 *pBuffer, uint8 ucLength, uint32 Value)
+{
+    uint8 uDigits[10];
+    sint8 uCounter = 0;
+
+    do
+    {
+        uDigits[uCounter++] = (uint8)(Value % 10U) + '0';
+        Value /= 10U;
+    }
+    while (Value != 0U);
+
+    for (uCounter--; uCounter >= 0; uCounter--)
+    {
+        pBuffer[ucLength++] = uDigits[uCounter];
+    }
+    return ucLength;
+}
+
+/* Append the ANSI cursor position sequence for (Row, Column) to pBuffer */
+static uint8 Dashboard_AppendCursorMove(uint8 *pBuffer, uint8 ucLength, uint8 Row, uint8 Column)
+{
+    pBuffer[ucLength++] = '\033';
+    pBuffer[ucLength++] = '[';
+    ucLength = Dashboard_AppendDecimal(pBuffer, ucLength, Row);
+    pBuffer[ucLength++] = ';';
+    ucLength = Dashboard_AppendDecimal(pBuffer, ucLength, Column);
+    pBuffer[ucLength++] = 'H';
+    return ucLength;
+}
+
+/* Position and width of a field */
+static Dashboard_FieldLayoutType Dashboard_GetLayout(uint32 ulField)
+{
+    Dashboard_FieldLayoutType xLayout;
+    uint32 ulSeat;
+
+    if (ulField < (uint32)DASHBOARD_FIRST_SEAT_FIELD)
+    {
+        return Dashboard_Fields[ulField];
+    }
+    ulField -= (uint32)DASHBOARD_FIRST_SEAT_FIELD;
+    ulSeat = ulField / DASHBOARD_FIELDS_PER_SEAT;
+    xLayout = Dashboard_SeatFields[ulField % DASHBOARD_FIELDS_PER_SEAT];
+    xLayout.ucColumn += (uint8)(ulSeat * DASHBOARD_SEAT_COLUMN_WIDTH);
+    return xLayout;
+}
+
+/* Send a NUL terminated buffer of known length and account for it in the frame */
+static void Dashboard_Send(uint8 *pBuffer, uint8 ucLength)
+{
+    pBuffer[ucLength] = '\0';
+    UART0_SendString(pBuffer);
+    Dashboard_FrameBytes += ucLength;
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void Dashboard_Init(void)
+{
+    uint8 aBuffer[DASHBOARD_CURSOR_MOVE_MAX + 1U];
+    uint8 ucLength;
+    uint8 ucLabel;
+
+    /* Clear the entire screen and hide the cursor */
+    ucLength = 0;
+    aBuffer[ucLength++] = '\033'; aBuffer[ucLength++] = '['; aBuffer[ucLength++] = '2'; aBuffer[ucLength++] = 'J';
+    aBuffer[ucLength++] = '\033'; aBuffer[ucLength++] = '['; aBuffer[ucLength++] = '?';
+    aBuffer[ucLength++] = '2'; aBuffer[ucLength++] = '5'; aBuffer[ucLength++] = 'l';
+    Dashboard_Send(aBuffer, ucLength);
+
+    for (ucLabel = 0; ucLabel < DASHBOARD_NUMBER_OF_LABELS; ucLabel++)
+    {
+        ucLength = Dashboard_AppendCursorMove(aBuffer, 0, Dashboard_Labels[ucLabel].ucRow, Dashboard_Labels[ucLabel].ucColumn);
+        Dashboard_Send(aBuffer, ucLength);
+        UART0_SendString(Dashboard_Labels[ucLabel].pText);
+        for (ucLength = 0; Dashboard_Labels[ucLabel].pText[ucLength] != '\0'; ucLength++)
+        {
+            Dashboard_FrameBytes++;
+        }
+    }
+
+    Dashboard_Invalidate();
+}
+
+void Dashboard_Invalidate(void)
+{
+    uint32 ulField;
+    uint8 ucIndex;
+
+    for (ulField = 0; ulField < DASHBOARD_NUMBER_OF_FIELDS; ulField++)
+    {
+        for (ucIndex = 0; ucIndex < DASHBOARD_MAX_FIELD_WIDTH; ucIndex++)
+        {
+            Dashboard_Shadow[ulField][ucIndex] = 0;
+        }
+    }
+}
+
+void Dashboard_BeginFrame(void)
+{
+    Dashboard_FrameBytes = 0;
+
+#if (DASHBOARD_FULL_REDRAW_FRAMES != 0U)
+    if (Dashboard_FrameCount >= DASHBOARD_FULL_REDRAW_FRAMES)
+    {
+        Dashboard_FrameCount = 0;
+        Dashboard_Init();
+    }
+#endif
+    Dashboard_FrameCount++;
+}
+
+void Dashboard_SetText(Dashboard_FieldType Field, const uint8 *pText)
+{
+    uint8 aNew[DASHBOARD_MAX_FIELD_WIDTH];
+    uint8 aBuffer[DASHBOARD_CURSOR_MOVE_MAX + DASHBOARD_MAX_FIELD_WIDTH + 1U];
+    Dashboard_FieldLayoutType xLayout;
+    uint8 *pShadow;
+    uint8 ucWidth;
+    uint8 ucIndex;
+    sint8 sFirst = -1;
+    sint8 sLast = -1;
+    uint8 ucLength;
+    boolean bEndOfText = FALSE;
+
+    if ((uint32)Field >= DASHBOARD_NUMBER_OF_FIELDS)
+    {
+        return;
+    }
+    pShadow = Dashboard_Shadow[Field];
+    xLayout = Dashboard_GetLayout((uint32)Field);
+    ucWidth = xLayout.ucWidth;
+
+    /* Left align the new value in the field and pad it with spaces, while finding
+     * the span of characters that differ from what the terminal already shows */
+    for (ucIndex = 0; ucIndex < ucWidth; ucIndex++)
+    {
+        if ((FALSE == bEndOfText) && (pText[ucIndex] == '\0'))
+        {
+            bEndOfText = TRUE;
+        }
+        aNew[ucIndex] = (TRUE == bEndOfText) ? ' ' : pText[ucIndex];
+
+        if (aNew[ucIndex] != pShadow[ucIndex])
+        {
+            if (sFirst < 0)
+            {
+                sFirst = (sint8)ucIndex;
+            }
+            sLast = (sint8)ucIndex;
+        }
+    }
+
+    if (sFirst < 0)
+    {
+        return; /* Nothing changed, nothing to send */
+    }
+
+    ucLength = Dashboard_AppendCursorMove(aBuffer, 0, xLayout.ucRow, xLayout.ucColumn + (uint8)sFirst);
+    for (ucIndex = (uint8)sFirst; ucIndex <= (uint8)sLast; ucIndex++)
+    {
+        aBuffer[ucLength++] = aNew[ucIndex];
+        pShadow[ucIndex] = aNew[ucIndex];
+    }
+    Dashboard_Send(aBuffer, ucLength);
+}
+
+void Dashboard_SetInteger(Dashboard_FieldType Field, sint32 Value)
+{
+    uint8 aText[12];
+    uint8 ucLength = 0;
+
+    if (Value < 0)
+    {
+        aText[ucLength++] = '-';
+        Value = -Value;
+    }
+    ucLength = Dashboard_AppendDecimal(aText, ucLength, (uint32)Value);
+    aText[ucLength] = '\0';
+    Dashboard_SetText(Field, aText);
+}
+
+void Dashboard_SetDeciValue(Dashboard_FieldType Field, sint32 Value)
+{
+    uint8 aText[13];
+    uint8 ucLength = 0;
+
+    if (Value < 0)
+    {
+        aText[ucLength++] = '-';
+        Value = -Value;
+    }
+    ucLength = Dashboard_AppendDecimal(aText, ucLength, (uint32)Value / 10U);
+    aText[ucLength++] = '.';
+    aText[ucLength++] = (uint8)((uint32)Value % 10U) + '0';
+    aText[ucLength] = '\0';
+    Dashboard_SetText(Field, aText);
+}
+
+uint32 Dashboard_EndFrame(void)
+{
+    Dashboard_LastFrameBytes = Dashboard_FrameBytes;
+    return Dashboard_LastFrameBytes;
+}
+
+uint32 Dashboard_GetLastFrameBytes(void)
+{
+    return Dashboard_LastFrameBytes;
+}
@@ -0,0 +1,121 @@
+/******************************************************************************
+ *
+ * Module: Dashboard
+ *
+ * File Name: Dashboard.h
+ *
+ * Description: Header file for the UART dashboard screen-model renderer.
+ *              The renderer keeps the last frame sent to the terminal and only
+ *              retransmits the characters of the fields that changed.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#ifndef DASHBOARD_H
+#define DASHBOARD_H
+
+#include "std_types.h"
+#include "FreeRTOS_Project.h"
+
+/*******************************************************************************
+ *                              Configurations                                 *
+ *******************************************************************************/
+/* Number of frames after which the whole screen is redrawn, so a terminal that
+ * was attached (or garbled) after start-up recovers. 0 disables the redraw */
+#define DASHBOARD_FULL_REDRAW_FRAMES     (120U)
+
+/* Widest value field on the screen */
+#define DASHBOARD_MAX_FIELD_WIDTH        (16U)
+
+/* Seats are shown side by side, one column each */
+#define DASHBOARD_NUMBER_OF_SEATS        (NUMBER_OF_SEATS)
+#define DASHBOARD_SEAT_COLUMN_WIDTH      (20U)
+
+/* CPU load and peak load columns, one per CpuLoad window */
+#define DASHBOARD_NUMBER_OF_LOAD_WINDOWS (3U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+/* Dynamic fields of the dashboard screen. The load fields of every window follow DASHBOARD_FIRST_CPU_LOAD_FIELD
+ * and DASHBOARD_FIRST_CPU_PEAK_LOAD_FIELD, the per-seat fields DASHBOARD_FIRST_SEAT_FIELD, use
+ * DASHBOARD_CPU_LOAD_FIELD(), DASHBOARD_CPU_PEAK_LOAD_FIELD() and DASHBOARD_SEAT_FIELD() to address them */
+typedef enum
+{
+    DASHBOARD_IDLE_TASK_TIME,
+    DASHBOARD_SEAT_BUTTON_TASK_TIME,
+    DASHBOARD_HEATER_MONITOR_TASK_TIME,
+    DASHBOARD_HEATER_CONTROL_TASK_TIME,
+    DASHBOARD_CURRENT_TEMP_TASK_TIME,
+    DASHBOARD_DISPLAY_TASK_TIME,
+    DASHBOARD_FAILURE_TASK_TIME,
+    DASHBOARD_RUNTIME_TASK_TIME,
+    DASHBOARD_IDLE_TASK_SHARE,
+    DASHBOARD_SEAT_BUTTON_TASK_SHARE,
+    DASHBOARD_HEATER_MONITOR_TASK_SHARE,
+    DASHBOARD_HEATER_CONTROL_TASK_SHARE,
+    DASHBOARD_CURRENT_TEMP_TASK_SHARE,
+    DASHBOARD_DISPLAY_TASK_SHARE,
+    DASHBOARD_FAILURE_TASK_SHARE,
+    DASHBOARD_RUNTIME_TASK_SHARE,
+    DASHBOARD_FIRST_CPU_LOAD_FIELD,
+    DASHBOARD_FIRST_CPU_PEAK_LOAD_FIELD = DASHBOARD_FIRST_CPU_LOAD_FIELD + DASHBOARD_NUMBER_OF_LOAD_WINDOWS,
+    DASHBOARD_STACK_WARNINGS = DASHBOARD_FIRST_CPU_PEAK_LOAD_FIELD + DASHBOARD_NUMBER_OF_LOAD_WINDOWS,
+    DASHBOARD_TICKS_SUPPRESSED,
+    DASHBOARD_LAST_FRAME_BYTES,
+    DASHBOARD_FIRST_SEAT_FIELD
+} Dashboard_FieldType;
+
+/* Fields repeated in every seat column */
+typedef enum
+{
+    DASHBOARD_SEAT_NAME,
+    DASHBOARD_SEAT_HEATER_STATE,
+    DASHBOARD_SEAT_REQUIRED_TEMP,
+    DASHBOARD_SEAT_CURRENT_TEMP,
+    DASHBOARD_FIELDS_PER_SEAT
+} Dashboard_SeatFieldType;
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+#define DASHBOARD_CPU_LOAD_FIELD(window) \
+    ((Dashboard_FieldType)((uint32)DASHBOARD_FIRST_CPU_LOAD_FIELD + (uint32)(window)))
+
+#define DASHBOARD_CPU_PEAK_LOAD_FIELD(window) \
+    ((Dashboard_FieldType)((uint32)DASHBOARD_FIRST_CPU_PEAK_LOAD_FIELD + (uint32)(window)))
+
+#define DASHBOARD_SEAT_FIELD(seat, field) \
+    ((Dashboard_FieldType)((uint32)DASHBOARD_FIRST_SEAT_FIELD + ((uint32)(seat) * DASHBOARD_FIELDS_PER_SEAT) + (uint32)(field)))
+
+#define DASHBOARD_NUMBER_OF_FIELDS \
+    ((uint32)DASHBOARD_FIRST_SEAT_FIELD + (DASHBOARD_NUMBER_OF_SEATS * DASHBOARD_FIELDS_PER_SEAT))
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/* Clear the terminal, draw the static labels and forget the last frame */
+void Dashboard_Init(void);
+
+/* Force every field to be retransmitted in the next frame */
+void Dashboard_Invalidate(void);
+
+/* Start a new frame, resets the frame byte counter */
+void Dashboard_BeginFrame(void);
+
+/* Update a field with a text value, only the changed characters are sent */
+void Dashboard_SetText(Dashboard_FieldType Field, const uint8 *pText);
+
+/* Update a field with a decimal value, only the changed characters are sent */
+void Dashboard_SetInteger(Dashboard_FieldType Field, sint32 Value);
+
+/* Update a field with a value in tenths, shown with one decimal ("22.5") */
+void Dashboard_SetDeciValue(Dashboard_FieldType Field, sint32 Value);
+
+/* Finish the frame and return the number of bytes it sent over UART0 */
+uint32 Dashboard_EndFrame(void);
+
+/* Number of bytes sent by the last completed frame, shown in DASHBOARD_LAST_FRAME_BYTES */
+uint32 Dashboard_GetLastFrameBytes(void);
+
+#endif /* DASHBOARD_H */
@@ -0,0 +1,97 @@
+/******************************************************************************
+ *
+ * Module: Debounce
+ *
+ * File Name: Debounce.c
+ *
+ * Description: Source file for the bit-sliced input debounce engine.
+ *              Tools/debounce_bench.c measures the cost per scan.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include "Debounce.h"
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void Debounce_Init(Debounce_StateType *pState, uint8 ucWords, uint8 ucLongPressScans)
+{
+    uint8 ucWord;
+    uint8 ucPlane;
+
+    pState->ucWords = (ucWords > DEBOUNCE_MAX_WORDS) ? DEBOUNCE_MAX_WORDS : ucWords;
+    pState->ucLongPressScans = ucLongPressScans;
+    for (ucWord = 0; ucWord < DEBOUNCE_MAX_WORDS; ucWord++)
+    {
+        pState->aulState[ucWord] = 0;
+        pState->aulCount0[ucWord] = 0;
+        pState->aulCount1[ucWord] = 0;
+        pState->aulLongSent[ucWord] = 0;
+        for (ucPlane = 0; ucPlane < DEBOUNCE_HOLD_PLANES; ucPlane++)
+        {
+            pState->aulHold[ucPlane][ucWord] = 0;
+        }
+    }
+}
+
+void Debounce_Scan(Debounce_StateType *pState, const uint32 *pulSamples, Debounce_EventsType *pEvents)
+{
+    uint32 ulDelta;
+    uint32 ulToggle;
+    uint32 ulState;
+    uint32 ulCarry;
+    uint32 ulMatch;
+    uint32 ulPlane;
+    uint8 ucWord;
+    uint8 ucPlane;
+
+    for (ucWord = 0; ucWord < pState->ucWords; ucWord++)
+    {
+        /* Lanes disagreeing with their state count up, the others restart from 0.
+         * A lane still disagreeing with its counter at 3 flips, and the counter wraps to 0 */
+        ulDelta = pulSamples[ucWord] ^ pState->aulState[ucWord];
+        ulToggle = ulDelta & pState->aulCount0[ucWord] & pState->aulCount1[ucWord];
+        pState->aulCount1[ucWord] = (pState->aulCount1[ucWord] ^ pState->aulCount0[ucWord]) & ulDelta;
+        pState->aulCount0[ucWord] = ~pState->aulCount0[ucWord] & ulDelta;
+        ulState = pState->aulState[ucWord] ^ ulToggle;
+        pState->aulState[ucWord] = ulState;
+
+        pEvents->aulPressed[ucWord] = ulToggle & ulState;
+        pEvents->aulReleased[ucWord] = ulToggle & ~ulState;
+
+        /* Hold counter: released lanes are cleared, held lanes still waiting for their long press count up */
+        ulCarry = ulState & ~pState->aulLongSent[ucWord];
+        ulMatch = ulCarry;
+        for (ucPlane = 0; ucPlane < DEBOUNCE_HOLD_PLANES; ucPlane++)
+        {
+            ulPlane = pState->aulHold[ucPlane][ucWord] & ulState;
+            pState->aulHold[ucPlane][ucWord] = ulPlane ^ ulCarry;
+            ulCarry &= ulPlane;
+            ulMatch &= (0U != (pState->ucLongPressScans & (1U << ucPlane))) ? pState->aulHold[ucPlane][ucWord]
+                                                                           : ~pState->aulHold[ucPlane][ucWord];
+        }
+        if (0U == pState->ucLongPressScans)
+        {
+            ulMatch = 0;
+        }
+        pEvents->aulLongPressed[ucWord] = ulMatch;
+        pState->aulLongSent[ucWord] = (pState->aulLongSent[ucWord] | ulMatch) & ulState;
+    }
+}
+
+boolean Debounce_IsIdle(const Debounce_StateType *pState, const uint32 *pulSamples)
+{
+    uint32 ulBusy = 0;
+    uint8 ucWord;
+
+    for (ucWord = 0; ucWord < pState->ucWords; ucWord++)
+    {
+        ulBusy |= pState->aulCount0[ucWord] | pState->aulCount1[ucWord] | (pulSamples[ucWord] ^ pState->aulState[ucWord]);
+        if (0U != pState->ucLongPressScans)
+        {
+            ulBusy |= pState->aulState[ucWord] & ~pState->aulLongSent[ucWord];
+        }
+    }
+    return (boolean)(0U == ulBusy);
+}
@@ -0,0 +1,80 @@
+/******************************************************************************
+ *
+ * Module: Debounce
+ *
+ * File Name: Debounce.h
+ *
+ * Description: Header file for the bit-sliced input debounce engine.
+ *              Every input is one bit lane of a 32-bit word and all lanes are
+ *              debounced at once with vertical counters: counter bit n of
+ *              every lane lives in its own word (a bit plane), so one scan is
+ *              a fixed handful of logic operations per 32 inputs whatever the
+ *              number of pins in use. An input changes state after
+ *              DEBOUNCE_STABLE_SCANS scans in a row disagree with it. Each
+ *              scan publishes press, release and long-press events per lane.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#ifndef DEBOUNCE_H
+#define DEBOUNCE_H
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                              Configurations                                 *
+ *******************************************************************************/
+/* Words of 32 inputs an engine can hold */
+#define DEBOUNCE_MAX_WORDS      (2U)
+
+/* Bit planes of the hold counter, a long press can be at most 2^DEBOUNCE_HOLD_PLANES - 1 scans */
+#define DEBOUNCE_HOLD_PLANES    (8U)
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+/* The 2-bit vertical counter flips a lane on the 4th scan in a row that disagrees with it */
+#define DEBOUNCE_STABLE_SCANS   (4U)
+
+#define DEBOUNCE_LANES_PER_WORD (32U)
+
+/* Word and bit of a lane in the sample and event arrays */
+#define DEBOUNCE_LANE_WORD(lane)  ((lane) / DEBOUNCE_LANES_PER_WORD)
+#define DEBOUNCE_LANE_MASK(lane)  (1UL << ((lane) % DEBOUNCE_LANES_PER_WORD))
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+typedef struct
+{
+    uint32 aulState[DEBOUNCE_MAX_WORDS];                         /* Debounced level, 1 = active */
+    uint32 aulCount0[DEBOUNCE_MAX_WORDS];                        /* Disagreeing scans, low bit plane */
+    uint32 aulCount1[DEBOUNCE_MAX_WORDS];                        /* Disagreeing scans, high bit plane */
+    uint32 aulHold[DEBOUNCE_HOLD_PLANES][DEBOUNCE_MAX_WORDS];    /* Scans since the press, one word per bit plane */
+    uint32 aulLongSent[DEBOUNCE_MAX_WORDS];                      /* Long press already published for this press */
+    uint8  ucWords;                                              /* Words in use */
+    uint8  ucLongPressScans;                                     /* Scans held before a long press, 0 disables it */
+} Debounce_StateType;
+
+/* One bit per lane, set for the scan in which the event happened */
+typedef struct
+{
+    uint32 aulPressed[DEBOUNCE_MAX_WORDS];
+    uint32 aulReleased[DEBOUNCE_MAX_WORDS];
+    uint32 aulLongPressed[DEBOUNCE_MAX_WORDS];
+} Debounce_EventsType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/* Reset an engine of ucWords words (at most DEBOUNCE_MAX_WORDS), every input released */
+void Debounce_Init(Debounce_StateType *pState, uint8 ucWords, uint8 ucLongPressScans);
+
+/* Feed one raw sample of every input (ucWords words, 1 = active) and get the events of this scan */
+void Debounce_Scan(Debounce_StateType *pState, const uint32 *pulSamples, Debounce_EventsType *pEvents);
+
+/* TRUE when further scans cannot publish anything until an input changes: no counter is running,
+ * no held input is waiting for its long press and pulSamples agrees with the debounced state */
+boolean Debounce_IsIdle(const Debounce_StateType *pState, const uint32 *pulSamples);
+
+#endif /* DEBOUNCE_H */
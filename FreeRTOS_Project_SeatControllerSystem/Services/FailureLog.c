@@ -0,0 +1,239 @@
+/******************************************************************************
+ *
+ * Module: FailureLog
+ *
+ * File Name: FailureLog.c
+ *
+ * Description: Source file for the failure journal in the on-chip EEPROM. Only
+ *              the next sequence number and the record count are kept in RAM,
+ *              the records are read back from the EEPROM when asked for.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include "FailureLog.h"
+#include "Eeprom.h"
+#include "uart0.h"
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+#define FAILURELOG_FIRST_WORD            (FAILURELOG_FIRST_BLOCK * EEPROM_WORDS_PER_BLOCK)
+
+/* Fields of word 3 */
+#define FAILURELOG_SEAT_SHIFT            (28U)
+#define FAILURELOG_CODE_SHIFT            (24U)
+#define FAILURELOG_LEVEL_SHIFT           (20U)
+#define FAILURELOG_ADC_SHIFT             (8U)
+#define FAILURELOG_FIELD_MASK            (0xFUL)
+#define FAILURELOG_ADC_MASK              (0xFFFUL)
+#define FAILURELOG_CRC_MASK              (0xFFUL)
+
+/* CRC-8, x^8 + x^2 + x + 1 */
+#define FAILURELOG_CRC_POLYNOMIAL        (0x07U)
+
+/* The slot of a record is its sequence modulo the record count, a power of two keeps that
+ * true across the wrap of the 32-bit sequence. The journal fits the EEPROM */
+typedef char FailureLog_RecordsPowerOfTwo[((FAILURELOG_NUMBER_OF_RECORDS & (FAILURELOG_NUMBER_OF_RECORDS - 1U)) == 0U) ? 1 : -1];
+typedef char FailureLog_FitsEeprom[((FAILURELOG_FIRST_BLOCK + FAILURELOG_NUMBER_OF_BLOCKS) * EEPROM_WORDS_PER_BLOCK <= EEPROM_SIZE_WORDS) ? 1 : -1];
+
+/*******************************************************************************
+ *                              Module Variables                               *
+ *******************************************************************************/
+static uint32 FailureLog_NextSequence = 0;
+static uint32 FailureLog_Count = 0;
+
+/*******************************************************************************
+ *                         Private Functions Definitions                       *
+ *******************************************************************************/
+
+static uint8 FailureLog_Crc(const uint32 *pWords)
+{
+    uint8 ucCrc = 0;
+    uint8 ucByte;
+    uint8 ucBit;
+
+    /* Words 0 to 2 and the top three bytes of word 3 */
+    for (ucByte = 0; ucByte < 15U; ucByte++)
+    {
+        ucCrc ^= (uint8)(pWords[ucByte / 4U] >> ((3U - (ucByte % 4U)) * 8U));
+        for (ucBit = 0; ucBit < 8U; ucBit++)
+        {
+            ucCrc = (0U != (ucCrc & 0x80U)) ? (uint8)((ucCrc << 1) ^ FAILURELOG_CRC_POLYNOMIAL) : (uint8)(ucCrc << 1);
+        }
+    }
+    return ucCrc;
+}
+
+static uint16 FailureLog_SlotAddress(uint32 ulSlot)
+{
+    return (uint16)(FAILURELOG_FIRST_WORD + (ulSlot * FAILURELOG_WORDS_PER_RECORD));
+}
+
+/* Read the record of a slot. FALSE when it is erased, broken or belongs to another slot. The sequence
+ * never reaches the erased word, the EEPROM endurance runs out long before */
+static boolean FailureLog_ReadSlot(uint32 ulSlot, FailureLog_RecordType *pRecord)
+{
+    uint32 aWords[FAILURELOG_WORDS_PER_RECORD];
+
+    Eeprom_ReadWords(FailureLog_SlotAddress(ulSlot), aWords, FAILURELOG_WORDS_PER_RECORD);
+    if ((EEPROM_ERASED_WORD == aWords[0]) || ((aWords[0] % FAILURELOG_NUMBER_OF_RECORDS) != ulSlot) ||
+        ((aWords[3] & FAILURELOG_CRC_MASK) != FailureLog_Crc(aWords)))
+    {
+        return FALSE;
+    }
+
+    pRecord->ulSequence = aWords[0];
+    pRecord->ullTimestamp = ((uint64)aWords[2] << 32) | aWords[1];
+    pRecord->ucSeat = (uint8)((aWords[3] >> FAILURELOG_SEAT_SHIFT) & FAILURELOG_FIELD_MASK);
+    pRecord->ucCode = (uint8)((aWords[3] >> FAILURELOG_CODE_SHIFT) & FAILURELOG_FIELD_MASK);
+    pRecord->ucLevel = (uint8)((aWords[3] >> FAILURELOG_LEVEL_SHIFT) & FAILURELOG_FIELD_MASK);
+    pRecord->usAdcValue = (uint16)((aWords[3] >> FAILURELOG_ADC_SHIFT) & FAILURELOG_ADC_MASK);
+    return TRUE;
+}
+
+/* Slot ulSlot holds the record ulSlot places after the one of slot 0 */
+static boolean FailureLog_InCurrentLap(uint32 ulSlot, uint32 ulFirstSequence)
+{
+    FailureLog_RecordType xRecord;
+
+    return (boolean)((TRUE == FailureLog_ReadSlot(ulSlot, &xRecord)) && (xRecord.ulSequence == (ulFirstSequence + ulSlot)));
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void FailureLog_Init(void)
+{
+    FailureLog_RecordType xRecord;
+    uint32 ulFirstSequence;
+    uint32 ulLow;
+    uint32 ulHigh;
+    uint32 ulMiddle;
+
+    if (FALSE == FailureLog_ReadSlot(0, &xRecord))
+    {
+        /* Slot 0 was being written when the last lap ended, or nothing was ever logged */
+        if (TRUE == FailureLog_ReadSlot(FAILURELOG_NUMBER_OF_RECORDS - 1U, &xRecord))
+        {
+            FailureLog_NextSequence = xRecord.ulSequence + 1UL;
+            FailureLog_Count = FAILURELOG_NUMBER_OF_RECORDS;
+        }
+        else
+        {
+            FailureLog_NextSequence = 0;
+            FailureLog_Count = 0;
+        }
+        return;
+    }
+
+    /* The newest record is the last slot of the current lap, slot ulLow is in it and ulHigh is not */
+    ulFirstSequence = xRecord.ulSequence;
+    ulLow = 0;
+    ulHigh = FAILURELOG_NUMBER_OF_RECORDS;
+    while ((ulHigh - ulLow) > 1UL)
+    {
+        ulMiddle = ulLow + ((ulHigh - ulLow) / 2UL);
+        if (TRUE == FailureLog_InCurrentLap(ulMiddle, ulFirstSequence))
+        {
+            ulLow = ulMiddle;
+        }
+        else
+        {
+            ulHigh = ulMiddle;
+        }
+    }
+
+    FailureLog_NextSequence = ulFirstSequence + ulLow + 1UL;
+    FailureLog_Count = (ulFirstSequence >= FAILURELOG_NUMBER_OF_RECORDS) ? FAILURELOG_NUMBER_OF_RECORDS : (ulLow + 1UL);
+}
+
+Std_ReturnType FailureLog_Append(FailureLog_RecordType *pRecord)
+{
+    uint32 aWords[FAILURELOG_WORDS_PER_RECORD];
+    uint16 usAddress = FailureLog_SlotAddress(FailureLog_NextSequence % FAILURELOG_NUMBER_OF_RECORDS);
+    uint8 ucWord;
+
+    pRecord->ulSequence = FailureLog_NextSequence;
+    aWords[0] = pRecord->ulSequence;
+    aWords[1] = (uint32)pRecord->ullTimestamp;
+    aWords[2] = (uint32)(pRecord->ullTimestamp >> 32);
+    aWords[3] = (((uint32)pRecord->ucSeat & FAILURELOG_FIELD_MASK) << FAILURELOG_SEAT_SHIFT) |
+                (((uint32)pRecord->ucCode & FAILURELOG_FIELD_MASK) << FAILURELOG_CODE_SHIFT) |
+                (((uint32)pRecord->ucLevel & FAILURELOG_FIELD_MASK) << FAILURELOG_LEVEL_SHIFT) |
+                (((uint32)pRecord->usAdcValue & FAILURELOG_ADC_MASK) << FAILURELOG_ADC_SHIFT);
+    aWords[3] |= FailureLog_Crc(aWords);
+
+    /* The sequence last, the record only counts once it is all there. A failed write leaves the
+     * slot broken and the next record is written to it again */
+    for (ucWord = 1; ucWord <= FAILURELOG_WORDS_PER_RECORD; ucWord++)
+    {
+        if (E_OK != Eeprom_WriteWord(usAddress + (ucWord % FAILURELOG_WORDS_PER_RECORD), aWords[ucWord % FAILURELOG_WORDS_PER_RECORD]))
+        {
+            return E_NOT_OK;
+        }
+    }
+
+    FailureLog_NextSequence++;
+    if (FailureLog_Count < FAILURELOG_NUMBER_OF_RECORDS)
+    {
+        FailureLog_Count++;
+    }
+    return E_OK;
+}
+
+uint32 FailureLog_GetCount(void)
+{
+    return FailureLog_Count;
+}
+
+Std_ReturnType FailureLog_Read(uint32 ulIndex, FailureLog_RecordType *pRecord)
+{
+    uint32 ulSequence = FailureLog_NextSequence - 1UL - ulIndex;
+
+    if ((ulIndex >= FailureLog_Count) ||
+        (FALSE == FailureLog_ReadSlot(ulSequence % FAILURELOG_NUMBER_OF_RECORDS, pRecord)) ||
+        (pRecord->ulSequence != ulSequence))
+    {
+        return E_NOT_OK;
+    }
+    return E_OK;
+}
+
+void FailureLog_Dump(void)
+{
+    FailureLog_RecordType xRecord;
+    uint32 ulIndex;
+
+    UART0_SendString((const uint8 *)"\r\nfailure_log,records,capacity,next_sequence\r\neeprom,");
+    UART0_SendInteger(FailureLog_Count);
+    UART0_SendString((const uint8 *)",");
+    UART0_SendInteger(FAILURELOG_NUMBER_OF_RECORDS);
+    UART0_SendString((const uint8 *)",");
+    UART0_SendInteger(FailureLog_NextSequence);
+
+    UART0_SendString((const uint8 *)"\r\n\r\nsequence,seat,code,level,adc,time_us (newest first)\r\n");
+    for (ulIndex = 0; ulIndex < FailureLog_Count; ulIndex++)
+    {
+        if (E_OK == FailureLog_Read(ulIndex, &xRecord))
+        {
+            UART0_SendInteger(xRecord.ulSequence);
+            UART0_SendString((const uint8 *)",");
+            UART0_SendInteger(xRecord.ucSeat);
+            UART0_SendString((const uint8 *)",");
+            UART0_SendInteger(xRecord.ucCode);
+            UART0_SendString((const uint8 *)",");
+            UART0_SendInteger(xRecord.ucLevel);
+            UART0_SendString((const uint8 *)",");
+            UART0_SendInteger(xRecord.usAdcValue);
+            UART0_SendString((const uint8 *)",");
+            UART0_SendInteger((sint64)xRecord.ullTimestamp);
+        }
+        else
+        {
+            UART0_SendInteger(FailureLog_NextSequence - 1UL - ulIndex);
+            UART0_SendString((const uint8 *)",broken");
+        }
+        UART0_SendString((const uint8 *)"\r\n");
+    }
+}
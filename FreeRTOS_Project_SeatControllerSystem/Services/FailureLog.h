@@ -0,0 +1,90 @@
+/******************************************************************************
+ *
+ * Module: FailureLog
+ *
+ * File Name: FailureLog.h
+ *
+ * Description: Header file for the failure journal kept in the on-chip EEPROM.
+ *              Every sensor failure is one fixed-size record of four words:
+ *
+ *              word 0  sequence number, written last
+ *              word 1  timestamp in us, low word
+ *              word 2  timestamp in us, high word
+ *              word 3  seat (31:28), code (27:24), heater level (23:20),
+ *                      ADC counts (19:8) and a CRC-8 (7:0) over the rest of
+ *                      the record, sequence included
+ *
+ *              Record n goes to slot n % FAILURELOG_NUMBER_OF_RECORDS, round
+ *              robin over the FAILURELOG_NUMBER_OF_BLOCKS blocks: every word is
+ *              written once per lap of the journal, so the wear is even and the
+ *              oldest record is the one overwritten. A record that a reset cut
+ *              short fails its CRC (the sequence is written last) and is
+ *              overwritten by the next one.
+ *
+ *              At start-up the newest record is found by a binary search on the
+ *              slots: slot i holds a record of the current lap (sequence of slot
+ *              0 plus i) up to the newest one, and an older lap, an erased or a
+ *              broken record after it. That takes about log2 of the record
+ *              count reads instead of one per slot.
+ *
+ *              Not reentrant: after FailureLog_Init only one task, the writer,
+ *              calls the functions below.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#ifndef FAILURELOG_H
+#define FAILURELOG_H
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                              Configurations                                 *
+ *******************************************************************************/
+/* EEPROM blocks of the journal, 4 records each. The record count must be a power of two */
+#define FAILURELOG_FIRST_BLOCK           (0U)
+#define FAILURELOG_NUMBER_OF_BLOCKS      (32U)
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+#define FAILURELOG_WORDS_PER_RECORD      (4U)
+#define FAILURELOG_NUMBER_OF_RECORDS     ((FAILURELOG_NUMBER_OF_BLOCKS * 16U) / FAILURELOG_WORDS_PER_RECORD)
+
+/* Failure codes, 4 bits */
+#define FAILURELOG_CODE_SENSOR_LOW       (1U)   /* Sensor below MIN_VALID_TEMP */
+#define FAILURELOG_CODE_SENSOR_HIGH      (2U)   /* Sensor above MAX_VALID_TEMP */
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+typedef struct
+{
+    uint32 ulSequence;                  /* Set by FailureLog_Append, counts every record ever logged */
+    uint64 ullTimestamp;                /* us since start-up */
+    uint16 usAdcValue;                  /* Filtered sensor ADC counts, 12 bits */
+    uint8 ucSeat;                       /* Seat_Configuration index, 4 bits */
+    uint8 ucCode;                       /* FAILURELOG_CODE_..., 4 bits */
+    uint8 ucLevel;                      /* HeatingLevel when the sensor failed, 4 bits */
+} FailureLog_RecordType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/* Find the newest record in the EEPROM, after Eeprom_Init */
+void FailureLog_Init(void);
+
+/* Store pRecord as the newest record, overwriting the oldest once the journal is full. Waits for the
+ * EEPROM, up to four word writes. Sets pRecord->ulSequence. E_NOT_OK when the EEPROM refused a write */
+Std_ReturnType FailureLog_Append(FailureLog_RecordType *pRecord);
+
+/* Records in the journal, up to FAILURELOG_NUMBER_OF_RECORDS */
+uint32 FailureLog_GetCount(void);
+
+/* Record ulIndex, 0 is the newest. E_NOT_OK past the count or for a broken record */
+Std_ReturnType FailureLog_Read(uint32 ulIndex, FailureLog_RecordType *pRecord);
+
+/* Send the journal as text over UART0, newest first */
+void FailureLog_Dump(void);
+
+#endif /* FAILURELOG_H */
@@ -0,0 +1,354 @@
+/******************************************************************************
+ *
+ * Module: HeapMonitor
+ *
+ * File Name: HeapMonitor.c
+ *
+ * Description: Source file for the kernel heap instrumentation. The hooks run
+ *              inside pvPortMalloc and vPortFree with the scheduler suspended,
+ *              the queries suspend it as well to copy a consistent state. The
+ *              heap is never used from interrupts. Compiled to nothing in the
+ *              static allocation build, which has no heap.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "HeapMonitor.h"
+#include "uart0.h"
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+
+/* The owner of an allocation is its task tag, sizes are kept in 16 bits */
+#if (configUSE_APPLICATION_TASK_TAG != 1) || (INCLUDE_xTaskGetSchedulerState != 1)
+#error "HeapMonitor needs configUSE_APPLICATION_TASK_TAG and INCLUDE_xTaskGetSchedulerState"
+#endif
+typedef char HeapMonitor_SizeFitsRecord[(configTOTAL_HEAP_SIZE <= 0xFFFFUL) ? 1 : -1];
+typedef char HeapMonitor_RingIsPowerOfTwo[((HEAPMONITOR_RING_EVENTS & (HEAPMONITOR_RING_EVENTS - 1U)) == 0U) ? 1 : -1];
+
+/*******************************************************************************
+ *                              Module Variables                               *
+ *******************************************************************************/
+/* Tracked live allocations, an address of 0 marks a free slot */
+static HeapMonitor_RecordType HeapMonitor_Live[HEAPMONITOR_MAX_LIVE];
+static HeapMonitor_ClassType HeapMonitor_Classes[HEAPMONITOR_NUMBER_OF_CLASSES];
+static uint32 HeapMonitor_FailedAllocations = 0;
+static uint32 HeapMonitor_LiveAllocations = 0;
+static uint32 HeapMonitor_UntrackedAllocations = 0;
+
+#if (HEAPMONITOR_EVENT_RING == STD_ON)
+/* The oldest event is overwritten by the newest */
+static HeapMonitor_RecordType HeapMonitor_Ring[HEAPMONITOR_RING_EVENTS];
+static uint32 HeapMonitor_RingHead = 0;   /* Next slot written */
+static uint32 HeapMonitor_RingCount = 0;
+#endif
+
+/*******************************************************************************
+ *                         Private Functions Definitions                       *
+ *******************************************************************************/
+
+/* Size class of a block of ulSize bytes */
+static uint8 HeapMonitor_Class(uint32 ulSize)
+{
+    uint8 ucClass = 0;
+
+    ulSize >>= HEAPMONITOR_FIRST_CLASS_LOG2;
+    while ((0U != ulSize) && (ucClass < (HEAPMONITOR_NUMBER_OF_CLASSES - 1U)))
+    {
+        ulSize >>= 1;
+        ucClass++;
+    }
+    return ucClass;
+}
+
+/* Task tag of the caller, the kernel objects created in main() have none yet */
+static uint8 HeapMonitor_CurrentTag(void)
+{
+    if (taskSCHEDULER_NOT_STARTED == xTaskGetSchedulerState())
+    {
+        return HEAPMONITOR_STARTUP_TAG;
+    }
+    return (uint8)(portPOINTER_SIZE_TYPE)xTaskGetApplicationTaskTag(NULL);
+}
+
+static void HeapMonitor_Fill(HeapMonitor_RecordType *pRecord, void *pvAddress, size_t xSize, void *pvCallSite)
+{
+    pRecord->ulAddress = (uint32)(portPOINTER_SIZE_TYPE)pvAddress;
+    pRecord->ulCallSite = (uint32)(portPOINTER_SIZE_TYPE)pvCallSite;
+    pRecord->ulTick = (uint32)xTaskGetTickCount();
+    pRecord->usSize = (uint16)((xSize > 0xFFFFU) ? 0xFFFFU : xSize);
+    pRecord->ucTag = HeapMonitor_CurrentTag();
+    pRecord->ucFree = FALSE;
+}
+
+#if (HEAPMONITOR_EVENT_RING == STD_ON)
+static void HeapMonitor_RecordEvent(void *pvAddress, size_t xSize, void *pvCallSite, uint8 ucFree)
+{
+    HeapMonitor_Fill(&HeapMonitor_Ring[HeapMonitor_RingHead], pvAddress, xSize, pvCallSite);
+    HeapMonitor_Ring[HeapMonitor_RingHead].ucFree = ucFree;
+    HeapMonitor_RingHead = (HeapMonitor_RingHead + 1U) & (HEAPMONITOR_RING_EVENTS - 1U);
+    if (HeapMonitor_RingCount < HEAPMONITOR_RING_EVENTS)
+    {
+        HeapMonitor_RingCount++;
+    }
+}
+#endif
+
+static void HeapMonitor_SendField(sint64 Value)
+{
+    UART0_SendString((const uint8 *)",");
+    UART0_SendInteger(Value);
+}
+
+static void HeapMonitor_SendHexField(uint32 ulValue)
+{
+    uint8 aText[12];
+    uint8 ucDigit;
+
+    aText[0] = ',';
+    aText[1] = '0';
+    aText[2] = 'x';
+    for (ucDigit = 0; ucDigit < 8U; ucDigit++)
+    {
+        aText[3U + ucDigit] = (uint8)"0123456789abcdef"[(ulValue >> (28U - (4U * ucDigit))) & 0xFU];
+    }
+    aText[11] = '\0';
+    UART0_SendString(aText);
+}
+
+/* Age in ms, task tag, bytes, call site and address of one record, after the leading field */
+static void HeapMonitor_SendRecord(const HeapMonitor_RecordType *pRecord, TickType_t xNow)
+{
+    HeapMonitor_SendField((sint64)((xNow - (TickType_t)pRecord->ulTick) * portTICK_PERIOD_MS));
+    HeapMonitor_SendField(pRecord->ucTag);
+    HeapMonitor_SendField(pRecord->usSize);
+    HeapMonitor_SendHexField(pRecord->ulCallSite);
+    HeapMonitor_SendHexField(pRecord->ulAddress);
+    UART0_SendString((const uint8 *)"\r\n");
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void HeapMonitor_Malloc(void *pvAddress, size_t xSize, void *pvCallSite)
+{
+    HeapMonitor_ClassType *pClass;
+    uint8 ucSlot;
+
+    if (NULL_PTR == pvAddress)
+    {
+        HeapMonitor_FailedAllocations++;
+    }
+    else
+    {
+        pClass = &HeapMonitor_Classes[HeapMonitor_Class((uint32)xSize)];
+        pClass->usLive++;
+        pClass->ulTotal++;
+        if (pClass->usLive > pClass->usPeak)
+        {
+            pClass->usPeak = pClass->usLive;
+        }
+        HeapMonitor_LiveAllocations++;
+
+        for (ucSlot = 0; ucSlot < HEAPMONITOR_MAX_LIVE; ucSlot++)
+        {
+            if (0U == HeapMonitor_Live[ucSlot].ulAddress)
+            {
+                HeapMonitor_Fill(&HeapMonitor_Live[ucSlot], pvAddress, xSize, pvCallSite);
+                break;
+            }
+        }
+        if (HEAPMONITOR_MAX_LIVE == ucSlot)
+        {
+            HeapMonitor_UntrackedAllocations++;
+        }
+    }
+
+#if (HEAPMONITOR_EVENT_RING == STD_ON)
+    HeapMonitor_RecordEvent(pvAddress, xSize, pvCallSite, FALSE);
+#endif
+}
+
+void HeapMonitor_Free(void *pvAddress, size_t xSize, void *pvCallSite)
+{
+    HeapMonitor_ClassType *pClass;
+    uint32 ulSize = (uint32)xSize;
+    uint8 ucSlot;
+
+    for (ucSlot = 0; ucSlot < HEAPMONITOR_MAX_LIVE; ucSlot++)
+    {
+        if ((uint32)(portPOINTER_SIZE_TYPE)pvAddress == HeapMonitor_Live[ucSlot].ulAddress)
+        {
+            /* Counted in the class of the size it was allocated with, heap_2 reports the wanted bytes */
+            ulSize = HeapMonitor_Live[ucSlot].usSize;
+            HeapMonitor_Live[ucSlot].ulAddress = 0U;
+            break;
+        }
+    }
+    if ((HEAPMONITOR_MAX_LIVE == ucSlot) && (0U != HeapMonitor_UntrackedAllocations))
+    {
+        HeapMonitor_UntrackedAllocations--;
+    }
+
+    pClass = &HeapMonitor_Classes[HeapMonitor_Class(ulSize)];
+    if (0U != pClass->usLive)
+    {
+        pClass->usLive--;
+    }
+    if (0U != HeapMonitor_LiveAllocations)
+    {
+        HeapMonitor_LiveAllocations--;
+    }
+
+#if (HEAPMONITOR_EVENT_RING == STD_ON)
+    HeapMonitor_RecordEvent(pvAddress, xSize, pvCallSite, TRUE);
+#else
+    (void)pvCallSite;
+#endif
+}
+
+void HeapMonitor_GetStats(HeapMonitor_StatsType *pStats)
+{
+    HeapStats_t xHeapStats;
+
+    vPortGetHeapStats(&xHeapStats);
+
+    pStats->ulHeapSize = configTOTAL_HEAP_SIZE;
+    pStats->ulFreeBytes = (uint32)xHeapStats.xAvailableHeapSpaceInBytes;
+    pStats->ulMinimumEverFreeBytes = (uint32)xHeapStats.xMinimumEverFreeBytesRemaining;
+    pStats->ulLargestFreeBlock = (uint32)xHeapStats.xSizeOfLargestFreeBlockInBytes;
+    pStats->ulSmallestFreeBlock = (uint32)xHeapStats.xSizeOfSmallestFreeBlockInBytes;
+    pStats->ulFreeBlocks = (uint32)xHeapStats.xNumberOfFreeBlocks;
+    pStats->ulAllocations = (uint32)xHeapStats.xNumberOfSuccessfulAllocations;
+    pStats->ulFrees = (uint32)xHeapStats.xNumberOfSuccessfulFrees;
+    pStats->ulFragmentationPercent = (0U != pStats->ulFreeBytes) ?
+                                     (100U - ((pStats->ulLargestFreeBlock * 100U) / pStats->ulFreeBytes)) : 0U;
+
+    vTaskSuspendAll();
+    pStats->ulFailedAllocations = HeapMonitor_FailedAllocations;
+    pStats->ulLiveAllocations = HeapMonitor_LiveAllocations;
+    pStats->ulUntrackedAllocations = HeapMonitor_UntrackedAllocations;
+    (void)xTaskResumeAll();
+}
+
+void HeapMonitor_GetClass(uint8 ucClass, HeapMonitor_ClassType *pClass)
+{
+    vTaskSuspendAll();
+    *pClass = HeapMonitor_Classes[ucClass];
+    (void)xTaskResumeAll();
+}
+
+uint32 HeapMonitor_RecommendHeapSize(const HeapMonitor_StatsType *pStats)
+{
+    uint32 ulUsed = pStats->ulHeapSize - pStats->ulMinimumEverFreeBytes;
+    uint32 ulSize = ulUsed + (((ulUsed * HEAPMONITOR_MARGIN_PERCENT) + 99U) / 100U);
+
+    return (ulSize + portBYTE_ALIGNMENT_MASK) & ~(uint32)portBYTE_ALIGNMENT_MASK;
+}
+
+void HeapMonitor_Dump(void)
+{
+    HeapMonitor_RecordType aLive[HEAPMONITOR_MAX_LIVE];
+    HeapMonitor_RecordType xRecord;
+    HeapMonitor_StatsType xStats;
+    HeapMonitor_ClassType xClass;
+    TickType_t xNow;
+    uint8 ucCount = 0;
+    uint8 ucIndex;
+    uint8 ucSorted;
+#if (HEAPMONITOR_EVENT_RING == STD_ON)
+    HeapMonitor_RecordType aRing[HEAPMONITOR_RING_EVENTS];
+    uint32 ulRingCount;
+    uint32 ulTail;
+#endif
+
+    HeapMonitor_GetStats(&xStats);
+
+    /* Copy what is sent, the UART may block */
+    vTaskSuspendAll();
+    for (ucIndex = 0; ucIndex < HEAPMONITOR_MAX_LIVE; ucIndex++)
+    {
+        if (0U != HeapMonitor_Live[ucIndex].ulAddress)
+        {
+            aLive[ucCount++] = HeapMonitor_Live[ucIndex];
+        }
+    }
+#if (HEAPMONITOR_EVENT_RING == STD_ON)
+    ulRingCount = HeapMonitor_RingCount;
+    ulTail = (HeapMonitor_RingHead - HeapMonitor_RingCount) & (HEAPMONITOR_RING_EVENTS - 1U);
+    for (ucIndex = 0; ucIndex < ulRingCount; ucIndex++)
+    {
+        aRing[ucIndex] = HeapMonitor_Ring[(ulTail + ucIndex) & (HEAPMONITOR_RING_EVENTS - 1U)];
+    }
+#endif
+    xNow = xTaskGetTickCount();
+    (void)xTaskResumeAll();
+
+    /* Oldest first, by age so the tick count may have wrapped */
+    for (ucSorted = 1; ucSorted < ucCount; ucSorted++)
+    {
+        xRecord = aLive[ucSorted];
+        for (ucIndex = ucSorted; (ucIndex > 0U) &&
+             ((xNow - (TickType_t)aLive[ucIndex - 1U].ulTick) < (xNow - (TickType_t)xRecord.ulTick)); ucIndex--)
+        {
+            aLive[ucIndex] = aLive[ucIndex - 1U];
+        }
+        aLive[ucIndex] = xRecord;
+    }
+
+    UART0_SendString((const uint8 *)"\r\nheap,size,free,min_free,largest_free,smallest_free,free_blocks,fragmentation_percent,"
+                                    "allocations,frees,failed,live,untracked\r\nkernel");
+    HeapMonitor_SendField(xStats.ulHeapSize);
+    HeapMonitor_SendField(xStats.ulFreeBytes);
+    HeapMonitor_SendField(xStats.ulMinimumEverFreeBytes);
+    HeapMonitor_SendField(xStats.ulLargestFreeBlock);
+    HeapMonitor_SendField(xStats.ulSmallestFreeBlock);
+    HeapMonitor_SendField(xStats.ulFreeBlocks);
+    HeapMonitor_SendField(xStats.ulFragmentationPercent);
+    HeapMonitor_SendField(xStats.ulAllocations);
+    HeapMonitor_SendField(xStats.ulFrees);
+    HeapMonitor_SendField(xStats.ulFailedAllocations);
+    HeapMonitor_SendField(xStats.ulLiveAllocations);
+    HeapMonitor_SendField(xStats.ulUntrackedAllocations);
+    UART0_SendString((const uint8 *)"\r\nrecommended configTOTAL_HEAP_SIZE (margin ");
+    UART0_SendInteger(HEAPMONITOR_MARGIN_PERCENT);
+    UART0_SendString((const uint8 *)" %): ");
+    UART0_SendInteger(HeapMonitor_RecommendHeapSize(&xStats));
+
+    UART0_SendString((const uint8 *)"\r\n\r\nclass_from_bytes,live,peak,total\r\n");
+    for (ucIndex = 0; ucIndex < HEAPMONITOR_NUMBER_OF_CLASSES; ucIndex++)
+    {
+        HeapMonitor_GetClass(ucIndex, &xClass);
+        UART0_SendInteger((0U == ucIndex) ? 0 : (sint64)(1UL << (HEAPMONITOR_FIRST_CLASS_LOG2 + ucIndex - 1U)));
+        HeapMonitor_SendField(xClass.usLive);
+        HeapMonitor_SendField(xClass.usPeak);
+        HeapMonitor_SendField(xClass.ulTotal);
+        UART0_SendString((const uint8 *)"\r\n");
+    }
+
+    UART0_SendString((const uint8 *)"\r\nlive,age_ms,task_tag,bytes,call_site,address (oldest first)\r\n");
+    for (ucIndex = 0; ucIndex < ucCount; ucIndex++)
+    {
+        UART0_SendInteger(ucIndex);
+        HeapMonitor_SendRecord(&aLive[ucIndex], xNow);
+    }
+
+#if (HEAPMONITOR_EVENT_RING == STD_ON)
+    UART0_SendString((const uint8 *)"\r\nevent,age_ms,task_tag,bytes,call_site,address (oldest first)\r\n");
+    for (ucIndex = 0; ucIndex < ulRingCount; ucIndex++)
+    {
+        if (TRUE == aRing[ucIndex].ucFree)
+        {
+            UART0_SendString((const uint8 *)"free");
+        }
+        else
+        {
+            UART0_SendString((0U != aRing[ucIndex].ulAddress) ? (const uint8 *)"malloc" : (const uint8 *)"failed");
+        }
+        HeapMonitor_SendRecord(&aRing[ucIndex], xNow);
+    }
+#endif
+}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
@@ -0,0 +1,128 @@
+/******************************************************************************
+ *
+ * Module: HeapMonitor
+ *
+ * File Name: HeapMonitor.h
+ *
+ * Description: Header file for the kernel heap instrumentation. The
+ *              traceMALLOC/traceFREE hooks in FreeRTOSConfig.h report every
+ *              pvPortMalloc and vPortFree, with the scheduler suspended, the
+ *              heap itself (heap_2.c or heap_tlsf.c) reports its free blocks
+ *              through vPortGetHeapStats. Kept for queries and the UART0 report:
+ *              - free bytes, the least ever free, the largest and smallest free
+ *                block, the number of free blocks and the fragmentation
+ *              - allocations, frees and failed allocations
+ *              - per size class the live allocations, their peak and the
+ *                allocations since start-up
+ *              - up to HEAPMONITOR_MAX_LIVE live allocations with the task and
+ *                the call site that made them and their age, oldest first in
+ *                the report: an allocation that keeps getting older in a soak
+ *                test is a leak candidate
+ *              - with HEAPMONITOR_EVENT_RING STD_ON the last
+ *                HEAPMONITOR_RING_EVENTS allocations and frees
+ *              Sizes are the block sizes taken from the heap, header included.
+ *              The report also recommends configTOTAL_HEAP_SIZE from the least
+ *              free space seen, like StackMonitor does for the stacks.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#ifndef HEAPMONITOR_H
+#define HEAPMONITOR_H
+
+#include <stddef.h>
+#include "std_types.h"
+
+/*******************************************************************************
+ *                              Configurations                                 *
+ *******************************************************************************/
+/* Live allocations tracked with their owner, more are only counted. The
+ * kernel objects of the heap build take 24 (see main.c and the UART0 transmit mutex) */
+#define HEAPMONITOR_MAX_LIVE             (32U)
+
+/* Size classes by powers of two, the first holds blocks below 2^HEAPMONITOR_FIRST_CLASS_LOG2 bytes,
+ * the last every block from 2^(HEAPMONITOR_FIRST_CLASS_LOG2 + HEAPMONITOR_NUMBER_OF_CLASSES - 2) up */
+#define HEAPMONITOR_NUMBER_OF_CLASSES    (8U)
+#define HEAPMONITOR_FIRST_CLASS_LOG2     (5U)
+
+/* STD_ON records the recent allocations and frees, HEAPMONITOR_RING_EVENTS of them (a power of two) */
+#define HEAPMONITOR_EVENT_RING           STD_OFF
+#define HEAPMONITOR_RING_EVENTS          (32U)
+
+/* Head room added to the most heap ever used for the recommended configTOTAL_HEAP_SIZE */
+#define HEAPMONITOR_MARGIN_PERCENT       (25U)
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+/* Return address of pvPortMalloc/vPortFree when expanded in them, the call site. Only GCC-compatible
+ * compilers have it, the others record no call site */
+#if defined(__GNUC__)
+#define HEAPMONITOR_CALL_SITE()          __builtin_return_address(0)
+#else
+#define HEAPMONITOR_CALL_SITE()          NULL_PTR
+#endif
+
+/* Owner of the allocations made before the scheduler starts, instead of a task tag */
+#define HEAPMONITOR_STARTUP_TAG          (0xFFU)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+typedef struct
+{
+    uint32 ulHeapSize;                  /* configTOTAL_HEAP_SIZE */
+    uint32 ulFreeBytes;
+    uint32 ulMinimumEverFreeBytes;
+    uint32 ulLargestFreeBlock;
+    uint32 ulSmallestFreeBlock;
+    uint32 ulFreeBlocks;
+    uint32 ulFragmentationPercent;      /* 100 - largest free block / free bytes */
+    uint32 ulAllocations;               /* Successful ones */
+    uint32 ulFrees;
+    uint32 ulFailedAllocations;
+    uint32 ulLiveAllocations;
+    uint32 ulUntrackedAllocations;      /* Live ones found no room in the tracking table */
+} HeapMonitor_StatsType;
+
+typedef struct
+{
+    uint16 usLive;
+    uint16 usPeak;
+    uint32 ulTotal;                     /* Allocations since start-up */
+} HeapMonitor_ClassType;
+
+/* One tracked live allocation or ring event */
+typedef struct
+{
+    uint32 ulAddress;                   /* Of the bytes handed out, 0 for a failed allocation */
+    uint32 ulCallSite;
+    uint32 ulTick;                      /* Kernel tick count when made */
+    uint16 usSize;                      /* Block bytes, the wanted bytes for a failed allocation */
+    uint8 ucTag;                        /* Application task tag, HEAPMONITOR_STARTUP_TAG before the scheduler */
+    uint8 ucFree;                       /* Ring events: TRUE for a free */
+} HeapMonitor_RecordType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/* Account one allocation or failed allocation (pvAddress NULL), from traceMALLOC */
+void HeapMonitor_Malloc(void *pvAddress, size_t xSize, void *pvCallSite);
+
+/* Account one free, from traceFREE */
+void HeapMonitor_Free(void *pvAddress, size_t xSize, void *pvCallSite);
+
+/* Heap state and counters, from a task */
+void HeapMonitor_GetStats(HeapMonitor_StatsType *pStats);
+
+/* Live allocations of the size class ucClass, from a task */
+void HeapMonitor_GetClass(uint8 ucClass, HeapMonitor_ClassType *pClass);
+
+/* Recommended configTOTAL_HEAP_SIZE from the least free space seen */
+uint32 HeapMonitor_RecommendHeapSize(const HeapMonitor_StatsType *pStats);
+
+/* Send the report as text over UART0: the state, the size classes, the live allocations oldest first
+ * and the event ring, from a task */
+void HeapMonitor_Dump(void);
+
+#endif /* HEAPMONITOR_H */
@@ -0,0 +1,163 @@
+/******************************************************************************
+ *
+ * Module: JobStats
+ *
+ * File Name: JobStats.c
+ *
+ * Description: Source file for the per-task job statistics. The hooks in
+ *              JobStats.h only count, the summaries are worked out from a copy
+ *              of the histogram by the task asking for them.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "JobStats.h"
+#include "uart0.h"
+
+/* Bucket bounds are computed with 32-bit shifts */
+typedef char JobStats_BucketsFit[(JOBSTATS_NUMBER_OF_BUCKETS <= 32U) ? 1 : -1];
+
+/*******************************************************************************
+ *                              Module Variables                               *
+ *******************************************************************************/
+JobStats_TaskType JobStats_Tasks[JOBSTATS_NUMBER_OF_TASKS];
+
+static const uint8 *JobStats_KindNames[JOBSTATS_NUMBER_OF_KINDS] = { (const uint8 *)"exec", (const uint8 *)"wake" };
+
+/*******************************************************************************
+ *                         Private Functions Definitions                       *
+ *******************************************************************************/
+
+/* Largest duration counted in a bucket */
+static uint32 JobStats_BucketLimit(uint32 ulBucket)
+{
+    return (0U == ulBucket) ? 0U : (uint32)(0xFFFFFFFFUL >> (32U - ulBucket));
+}
+
+/* Count, min, average, p99 and max of a histogram copy */
+static void JobStats_Summarize(const JobStats_HistogramType *pHistogram, JobStats_SummaryType *pSummary)
+{
+    uint32 ulTarget;
+    uint32 ulCumulative = 0;
+    uint32 ulBucket;
+
+    pSummary->ulCount = pHistogram->ulCount;
+    if (0U == pHistogram->ulCount)
+    {
+        pSummary->ulMin = 0;
+        pSummary->ulAverage = 0;
+        pSummary->ulP99 = 0;
+        pSummary->ulMax = 0;
+        return;
+    }
+    pSummary->ulMin = pHistogram->ulMin;
+    pSummary->ulMax = pHistogram->ulMax;
+    pSummary->ulAverage = (uint32)(pHistogram->ullSum / pHistogram->ulCount);
+
+    /* First bucket holding the 99th percentile job, its bound (never above the max) is the p99 */
+    ulTarget = (uint32)((((uint64)pHistogram->ulCount * 99U) + 99U) / 100U);
+    for (ulBucket = 0; ulBucket < (JOBSTATS_NUMBER_OF_BUCKETS - 1U); ulBucket++)
+    {
+        ulCumulative += pHistogram->ulBuckets[ulBucket];
+        if (ulCumulative >= ulTarget)
+        {
+            break;
+        }
+    }
+    pSummary->ulP99 = (ulBucket == (JOBSTATS_NUMBER_OF_BUCKETS - 1U)) ? pHistogram->ulMax : JobStats_BucketLimit(ulBucket);
+    if (pSummary->ulP99 > pHistogram->ulMax)
+    {
+        pSummary->ulP99 = pHistogram->ulMax;
+    }
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void JobStats_Reset(void)
+{
+    JobStats_HistogramType *pHistogram;
+    uint8 ucTag;
+    uint8 ucKind;
+    uint8 ucBucket;
+
+    for (ucTag = 0; ucTag < JOBSTATS_NUMBER_OF_TASKS; ucTag++)
+    {
+        taskENTER_CRITICAL();
+        JobStats_Tasks[ucTag].bReady = FALSE;
+        JobStats_Tasks[ucTag].ullJobTime = 0;
+        for (ucKind = 0; ucKind < JOBSTATS_NUMBER_OF_KINDS; ucKind++)
+        {
+            pHistogram = &JobStats_Tasks[ucTag].Histograms[ucKind];
+            pHistogram->ulCount = 0;
+            pHistogram->ulMin = 0xFFFFFFFFUL;
+            pHistogram->ulMax = 0;
+            pHistogram->ullSum = 0;
+            for (ucBucket = 0; ucBucket < JOBSTATS_NUMBER_OF_BUCKETS; ucBucket++)
+            {
+                pHistogram->ulBuckets[ucBucket] = 0;
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+}
+
+void JobStats_GetHistogram(uint8 ucTag, JobStats_KindType Kind, JobStats_HistogramType *pHistogram)
+{
+    /* The hooks run in the context switch, which the critical section holds off */
+    taskENTER_CRITICAL();
+    *pHistogram = JobStats_Tasks[ucTag].Histograms[Kind];
+    taskEXIT_CRITICAL();
+}
+
+void JobStats_GetSummary(uint8 ucTag, JobStats_KindType Kind, JobStats_SummaryType *pSummary)
+{
+    JobStats_HistogramType xHistogram;
+
+    JobStats_GetHistogram(ucTag, Kind, &xHistogram);
+    JobStats_Summarize(&xHistogram, pSummary);
+}
+
+void JobStats_Dump(void)
+{
+    JobStats_HistogramType xHistogram;
+    JobStats_SummaryType xSummary;
+    uint8 ucTag;
+    uint8 ucKind;
+    uint8 ucBucket;
+
+    UART0_SendString((const uint8 *)"\r\ntag,kind,count,min_us,avg_us,p99_us,max_us,log2 buckets of ");
+    UART0_SendInteger((sint64)TIMEBASE_TICKS_PER_SECOND);
+    UART0_SendString((const uint8 *)" Hz ticks\r\n");
+
+    for (ucTag = 0; ucTag < JOBSTATS_NUMBER_OF_TASKS; ucTag++)
+    {
+        for (ucKind = 0; ucKind < JOBSTATS_NUMBER_OF_KINDS; ucKind++)
+        {
+            JobStats_GetHistogram(ucTag, (JobStats_KindType)ucKind, &xHistogram);
+            JobStats_Summarize(&xHistogram, &xSummary);
+
+            UART0_SendInteger(ucTag);
+            UART0_SendString((const uint8 *)",");
+            UART0_SendString(JobStats_KindNames[ucKind]);
+            UART0_SendString((const uint8 *)",");
+            UART0_SendInteger(xSummary.ulCount);
+            UART0_SendString((const uint8 *)",");
+            UART0_SendInteger((sint64)TIMEBASE_TO_US(xSummary.ulMin));
+            UART0_SendString((const uint8 *)",");
+            UART0_SendInteger((sint64)TIMEBASE_TO_US(xSummary.ulAverage));
+            UART0_SendString((const uint8 *)",");
+            UART0_SendInteger((sint64)TIMEBASE_TO_US(xSummary.ulP99));
+            UART0_SendString((const uint8 *)",");
+            UART0_SendInteger((sint64)TIMEBASE_TO_US(xSummary.ulMax));
+            for (ucBucket = 0; ucBucket < JOBSTATS_NUMBER_OF_BUCKETS; ucBucket++)
+            {
+                UART0_SendString((const uint8 *)",");
+                UART0_SendInteger(xHistogram.ulBuckets[ucBucket]);
+            }
+            UART0_SendString((const uint8 *)"\r\n");
+        }
+    }
+}
@@ -0,0 +1,158 @@
+/******************************************************************************
+ *
+ * Module: JobStats
+ *
+ * File Name: JobStats.h
+ *
+ * Description: Header file for the per-task job statistics. A job starts when
+ *              the kernel makes a task ready and ends when the task blocks
+ *              again. For every task tag two log2 histograms are kept:
+ *              - execution: run time of the job, preemptions excluded
+ *              - wake latency: from made ready to switched in
+ *              The recording hooks are called from the trace macros in
+ *              FreeRTOSConfig.h with the kernel locked and are inline: a few
+ *              compares, one count leading zeros and five stores per record.
+ *              Tasks sharing a tag are recorded as one task.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#ifndef JOBSTATS_H
+#define JOBSTATS_H
+
+#include "std_types.h"
+#include "Timebase.h"
+
+/*******************************************************************************
+ *                              Configurations                                 *
+ *******************************************************************************/
+/* One entry per task tag, checked against NUMBER_OF_TASK_TAGS in main.c */
+#define JOBSTATS_NUMBER_OF_TASKS         (8U)
+
+/* Bucket 0 counts 0 ticks, bucket b durations of 2^(b-1) to 2^b - 1 ticks and the
+ * last bucket everything longer. 24 buckets reach 0.52 s at 16 MHz ticks */
+#define JOBSTATS_NUMBER_OF_BUCKETS       (24U)
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+#if defined(__TI_ARM__)
+#define JOBSTATS_CLZ(Value)              __clz(Value)
+#else
+#define JOBSTATS_CLZ(Value)              ((0U == (Value)) ? 32U : (uint32)__builtin_clz((unsigned int)(Value)))
+#endif
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+typedef enum
+{
+    JOBSTATS_EXECUTION,
+    JOBSTATS_WAKE_LATENCY,
+    JOBSTATS_NUMBER_OF_KINDS
+} JobStats_KindType;
+
+/* Durations in Timebase ticks, saturated to 32 bits */
+typedef struct
+{
+    uint32 ulCount;
+    uint32 ulMin;
+    uint32 ulMax;
+    uint64 ullSum;
+    uint32 ulBuckets[JOBSTATS_NUMBER_OF_BUCKETS];
+} JobStats_HistogramType;
+
+/* Summary of one histogram in Timebase ticks, p99 is the upper bound of its bucket */
+typedef struct
+{
+    uint32 ulCount;
+    uint32 ulMin;
+    uint32 ulAverage;
+    uint32 ulP99;
+    uint32 ulMax;
+} JobStats_SummaryType;
+
+typedef struct
+{
+    Timebase_TicksType ullReadyTime;           /* When the pending job was released */
+    uint64 ullJobTime;                         /* Run time of the current job so far */
+    boolean bReady;                            /* Released and not switched in yet */
+    JobStats_HistogramType Histograms[JOBSTATS_NUMBER_OF_KINDS];
+} JobStats_TaskType;
+
+/*******************************************************************************
+ *                              Module Variables                               *
+ *******************************************************************************/
+/* Written by the hooks below only, read with the kernel locked (see JobStats.c) */
+extern JobStats_TaskType JobStats_Tasks[JOBSTATS_NUMBER_OF_TASKS];
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/* Empty every histogram, from a task */
+void JobStats_Reset(void);
+
+/* Consistent copy of one histogram, from a task */
+void JobStats_GetHistogram(uint8 ucTag, JobStats_KindType Kind, JobStats_HistogramType *pHistogram);
+
+/* Count, min, average, p99 and max of one histogram, from a task */
+void JobStats_GetSummary(uint8 ucTag, JobStats_KindType Kind, JobStats_SummaryType *pSummary);
+
+/* Send every histogram as text over UART0, one CSV line per tag and kind, from a task */
+void JobStats_Dump(void);
+
+/*******************************************************************************
+ *                        Kernel Hooks (FreeRTOSConfig.h)                      *
+ *******************************************************************************/
+
+/* Count one duration */
+LOCAL_INLINE void JobStats_Record(JobStats_HistogramType *pHistogram, uint64 ullTicks)
+{
+    uint32 ulValue = (ullTicks > 0xFFFFFFFFUL) ? 0xFFFFFFFFUL : (uint32)ullTicks;
+    uint32 ulBucket = 32U - JOBSTATS_CLZ(ulValue);
+
+    pHistogram->ulBuckets[(ulBucket < JOBSTATS_NUMBER_OF_BUCKETS) ? ulBucket : (JOBSTATS_NUMBER_OF_BUCKETS - 1U)]++;
+    pHistogram->ulCount++;
+    pHistogram->ullSum += ulValue;
+    if (ulValue < pHistogram->ulMin)
+    {
+        pHistogram->ulMin = ulValue;
+    }
+    if (ulValue > pHistogram->ulMax)
+    {
+        pHistogram->ulMax = ulValue;
+    }
+}
+
+/* The task was made ready, a job is released unless one is pending already */
+LOCAL_INLINE void JobStats_TaskReady(uint32 ulTag, Timebase_TicksType ullNow)
+{
+    if (FALSE == JobStats_Tasks[ulTag].bReady)
+    {
+        JobStats_Tasks[ulTag].bReady = TRUE;
+        JobStats_Tasks[ulTag].ullReadyTime = ullNow;
+    }
+}
+
+/* The task starts running, the first time after a release ends its wake latency */
+LOCAL_INLINE void JobStats_TaskSwitchedIn(uint32 ulTag, Timebase_TicksType ullNow)
+{
+    if (TRUE == JobStats_Tasks[ulTag].bReady)
+    {
+        JobStats_Tasks[ulTag].bReady = FALSE;
+        JobStats_Record(&JobStats_Tasks[ulTag].Histograms[JOBSTATS_WAKE_LATENCY], ullNow - JobStats_Tasks[ulTag].ullReadyTime);
+    }
+}
+
+/* The task stops running after ullRunTime ticks, its job is done if it left the ready list */
+LOCAL_INLINE void JobStats_TaskSwitchedOut(uint32 ulTag, uint64 ullRunTime, boolean bBlocked)
+{
+    JobStats_Tasks[ulTag].ullJobTime += ullRunTime;
+    if (TRUE == bBlocked)
+    {
+        JobStats_Record(&JobStats_Tasks[ulTag].Histograms[JOBSTATS_EXECUTION], JobStats_Tasks[ulTag].ullJobTime);
+        JobStats_Tasks[ulTag].ullJobTime = 0;
+    }
+}
+
+#endif /* JOBSTATS_H */
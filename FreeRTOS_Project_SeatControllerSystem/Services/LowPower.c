@@ -0,0 +1,213 @@
+/******************************************************************************
+ *
+ * Module: LowPower
+ *
+ * File Name: LowPower.c
+ *
+ * Description: Source file for the tickless idle sleep. Interrupts stay masked
+ *              (PRIMASK) from before the SysTick stops until it runs again,
+ *              except for a moment after waking that lets the waking interrupt
+ *              run. WFI still wakes on a masked interrupt. The sleep is the
+ *              Cortex-M4 sleep mode, every clock keeps running so the Timebase,
+ *              the UART and the PWM carry on.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "LowPower.h"
+#include "GPTM.h"
+#include "Timebase.h"
+#include "tm4c123gh6pm_registers.h"
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+/* SysTick counts, one every system clock, in one kernel tick and in one Timebase tick */
+#define LOWPOWER_COUNTS_PER_TICK            (configCPU_CLOCK_HZ / configTICK_RATE_HZ)
+#define LOWPOWER_COUNTS_PER_TIMEBASE_TICK   (configCPU_CLOCK_HZ / TIMEBASE_TICKS_PER_SECOND)
+
+/* Longest sleep, the wake timer and the measured sleep in counts stay within 32 bits */
+#define LOWPOWER_MAX_SLEEP_TICKS            ((0xFFFFFFFFUL / LOWPOWER_COUNTS_PER_TICK) - 1UL)
+
+/* SysTick control: the system clock, the tick interrupt and the enable */
+#define LOWPOWER_SYSTICK_CLOCK_SOURCE       (1UL << 2)
+#define LOWPOWER_SYSTICK_INTERRUPT          (1UL << 1)
+#define LOWPOWER_SYSTICK_ENABLE             (1UL << 0)
+
+/* Interrupt control and state: PENDSTSET and PENDSTCLR */
+#define LOWPOWER_SYSTICK_PENDING            (1UL << 26)
+#define LOWPOWER_SYSTICK_CLEAR_PENDING      (1UL << 25)
+
+#if (configUSE_TICKLESS_IDLE != 0)
+/* The SysTick runs from the system clock (configSYSTICK_CLOCK_HZ left undefined) like the Timebase */
+#ifdef configSYSTICK_CLOCK_HZ
+#error "LowPower expects the SysTick on the system clock"
+#endif
+typedef char LowPower_TickDividesClock[((configCPU_CLOCK_HZ % configTICK_RATE_HZ) == 0UL) ? 1 : -1];
+typedef char LowPower_TimebaseDividesClock[((configCPU_CLOCK_HZ % TIMEBASE_TICKS_PER_SECOND) == 0UL) ? 1 : -1];
+#endif
+
+/*******************************************************************************
+ *                              Module Variables                               *
+ *******************************************************************************/
+/* Only written with interrupts masked in the idle task, read in a critical section */
+static LowPower_StatsType LowPower_Stats;
+
+#if (configUSE_TICKLESS_IDLE != 0)
+static volatile boolean LowPower_WakeTimerExpired = FALSE;
+#endif
+
+/*******************************************************************************
+ *                         Private Functions Definitions                       *
+ *******************************************************************************/
+#if (configUSE_TICKLESS_IDLE != 0)
+
+static void LowPower_WakeTimerCallback(void)
+{
+    LowPower_WakeTimerExpired = TRUE;
+}
+
+/* Move on by ulCounts from a point *pLeft counts before the next tick, counting the ticks passed */
+static void LowPower_Advance(uint32 ulCounts, uint32 *pCompleted, uint32 *pLeft)
+{
+    if (ulCounts < *pLeft)
+    {
+        *pLeft -= ulCounts;
+    }
+    else
+    {
+        ulCounts -= *pLeft;
+        *pCompleted += 1UL + (ulCounts / LOWPOWER_COUNTS_PER_TICK);
+        *pLeft = LOWPOWER_COUNTS_PER_TICK - (ulCounts % LOWPOWER_COUNTS_PER_TICK);
+    }
+}
+
+#endif /* configUSE_TICKLESS_IDLE */
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void LowPower_Init(void)
+{
+#if (configUSE_TICKLESS_IDLE != 0)
+    GPTM_WTimer1Init(LowPower_WakeTimerCallback);
+#endif
+}
+
+#if (configUSE_TICKLESS_IDLE != 0)
+void LowPower_SuppressTicksAndSleep(uint32 ulExpectedIdleTicks)
+{
+    TickType_t xSleepTicks;
+    Timebase_TicksType xStart;
+    Timebase_TicksType xWake;
+    Timebase_TicksType xRestart;
+    uint32 ulCompleted = 0;                 /* Tick periods ended while the SysTick was stopped */
+    uint32 ulLeft;                          /* SysTick counts to the next tick */
+
+    if (ulExpectedIdleTicks > LOWPOWER_MAX_SLEEP_TICKS)
+    {
+        ulExpectedIdleTicks = LOWPOWER_MAX_SLEEP_TICKS;
+    }
+
+    /* Not taskENTER_CRITICAL, BASEPRI would keep the interrupts from waking the CPU */
+    HW_DISABLE_INTERRUPTS();
+    HW_DSB();
+    HW_ISB();
+
+    if (eAbortSleep == eTaskConfirmSleepModeStatus())
+    {
+        LowPower_Stats.ulAbortedSleeps++;
+        HW_ENABLE_INTERRUPTS();
+        return;
+    }
+
+    /* Stop the tick where it is in its period. The timestamp is read just before as it is just
+     * after the restart below, so the few clocks of both cancel out and the tick keeps its phase */
+    xStart = Timebase_Now();
+    SYSTICK_CTRL_REG = LOWPOWER_SYSTICK_CLOCK_SOURCE | LOWPOWER_SYSTICK_INTERRUPT;
+    ulLeft = SYSTICK_CURRENT_REG;
+    if (0UL == ulLeft)
+    {
+        ulLeft = LOWPOWER_COUNTS_PER_TICK;  /* The interrupt came on the way to 0, a whole period follows */
+    }
+    if (0UL != (NVIC_SYSTEM_INTCTRL & LOWPOWER_SYSTICK_PENDING))
+    {
+        /* A tick ended and has not interrupted yet, it is stepped with the others */
+        NVIC_SYSTEM_INTCTRL = LOWPOWER_SYSTICK_CLEAR_PENDING;
+        ulCompleted = 1UL;
+    }
+
+    /* Wake at the tick the next task is due, the expected idle time is at least 2 ticks */
+    LowPower_WakeTimerExpired = FALSE;
+    GPTM_WTimer1StartOneShot(ulLeft + (LOWPOWER_COUNTS_PER_TICK * (ulExpectedIdleTicks - 1UL - ulCompleted)));
+
+    xSleepTicks = (TickType_t)ulExpectedIdleTicks;
+    configPRE_SLEEP_PROCESSING(xSleepTicks);
+    if (xSleepTicks > 0U)
+    {
+        HW_DSB();
+        HW_WAIT_FOR_INTERRUPT();
+        HW_ISB();
+    }
+    configPOST_SLEEP_PROCESSING(xSleepTicks);
+
+    /* Let the interrupt that woke the CPU run, the SysTick stays stopped */
+    HW_ENABLE_INTERRUPTS();
+    HW_DSB();
+    HW_ISB();
+    HW_DISABLE_INTERRUPTS();
+    HW_DSB();
+    HW_ISB();
+
+    GPTM_WTimer1Stop();
+    xWake = Timebase_Now();
+    LowPower_Advance((uint32)(xWake - xStart) * LOWPOWER_COUNTS_PER_TIMEBASE_TICK, &ulCompleted, &ulLeft);
+
+    /* Restart the tick for the rest of the current period, counting what passed since waking */
+    xRestart = Timebase_Now();
+    LowPower_Advance((uint32)(xRestart - xWake) * LOWPOWER_COUNTS_PER_TIMEBASE_TICK, &ulCompleted, &ulLeft);
+    if (ulCompleted > ulExpectedIdleTicks)
+    {
+        /* More than a tick late, after sleep processing or a waking interrupt that overran: the
+         * tick count cannot pass the next unblock time, the overdue tick interrupts right away */
+        ulCompleted = ulExpectedIdleTicks;
+        ulLeft = 2UL;
+    }
+    else if (ulLeft < 2UL)
+    {
+        ulLeft = 2UL;                       /* A reload of 0 would stop the tick interrupt */
+    }
+    SYSTICK_RELOAD_REG = ulLeft - 1UL;
+    SYSTICK_CURRENT_REG = 0UL;              /* Loads the reload value on the next clock */
+    SYSTICK_CTRL_REG = LOWPOWER_SYSTICK_CLOCK_SOURCE | LOWPOWER_SYSTICK_INTERRUPT | LOWPOWER_SYSTICK_ENABLE;
+    SYSTICK_RELOAD_REG = LOWPOWER_COUNTS_PER_TICK - 1UL; /* Whole periods from the next reload */
+
+    if (0UL != ulCompleted)
+    {
+        vTaskStepTick((TickType_t)ulCompleted);
+    }
+
+    LowPower_Stats.ulSleeps++;
+    if (TRUE == LowPower_WakeTimerExpired)
+    {
+        LowPower_Stats.ulTimerWakeUps++;
+    }
+    else
+    {
+        LowPower_Stats.ulEarlyWakeUps++;
+    }
+    LowPower_Stats.ulSuppressedTicks += ulCompleted;
+    LowPower_Stats.ullTimeAsleep += xWake - xStart;
+
+    HW_ENABLE_INTERRUPTS();
+}
+#endif /* configUSE_TICKLESS_IDLE */
+
+void LowPower_GetStats(LowPower_StatsType *pStats)
+{
+    taskENTER_CRITICAL();
+    *pStats = LowPower_Stats;
+    taskEXIT_CRITICAL();
+}
@@ -0,0 +1,54 @@
+/******************************************************************************
+ *
+ * Module: LowPower
+ *
+ * File Name: LowPower.h
+ *
+ * Description: Header file for the tickless idle sleep. With configUSE_TICKLESS_IDLE
+ *              set in FreeRTOSConfig.h the idle task calls
+ *              LowPower_SuppressTicksAndSleep (portSUPPRESS_TICKS_AND_SLEEP)
+ *              when no task is due for at least configEXPECTED_IDLE_TIME_BEFORE_SLEEP
+ *              ticks. It stops the SysTick, sleeps (WFI) until the WTimer1A
+ *              one-shot wakes the CPU at the tick the next task is due or an
+ *              interrupt wakes it earlier, then steps the kernel tick count by
+ *              the tick periods that passed and restarts the SysTick for the
+ *              rest of the current period. The sleep is measured on the
+ *              Timebase (WTimer0), which keeps counting, so the tick stays in
+ *              phase with it across sleeps and vTaskDelayUntil periods keep
+ *              their length (to within 1 us per sleep with
+ *              TIMEBASE_RESOLUTION_US, exactly with TIMEBASE_RESOLUTION_CLOCK).
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#ifndef LOWPOWER_H
+#define LOWPOWER_H
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+typedef struct
+{
+    uint32 ulSleeps;                    /* Sleeps entered */
+    uint32 ulAbortedSleeps;             /* Given up, a task became ready meanwhile */
+    uint32 ulTimerWakeUps;              /* Woken by WTimer1A at the expected idle time */
+    uint32 ulEarlyWakeUps;              /* Woken earlier by another interrupt */
+    uint32 ulSuppressedTicks;           /* Tick interrupts the sleeps saved */
+    uint64 ullTimeAsleep;               /* Timebase ticks */
+} LowPower_StatsType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/* Set up the WTimer1A wake timer, after Timebase_Init and before the scheduler starts */
+void LowPower_Init(void);
+
+/* portSUPPRESS_TICKS_AND_SLEEP, from the idle task with the scheduler suspended */
+void LowPower_SuppressTicksAndSleep(uint32 ulExpectedIdleTicks);
+
+/* Counters since start-up, from a task. All 0 without configUSE_TICKLESS_IDLE */
+void LowPower_GetStats(LowPower_StatsType *pStats);
+
+#endif /* LOWPOWER_H */
@@ -0,0 +1,87 @@
+/******************************************************************************
+ *
+ * Module: PidController
+ *
+ * File Name: PidController.c
+ *
+ * Description: Source file for the integer PID controller.
+ *              Tools/pid_step_bench.c runs it against a seat thermal model.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include "PidController.h"
+
+/*******************************************************************************
+ *                         Private Functions Definitions                       *
+ *******************************************************************************/
+
+static sint32 PidController_Clamp(sint32 slValue, sint32 slMin, sint32 slMax)
+{
+    if (slValue < slMin)
+    {
+        return slMin;
+    }
+    if (slValue > slMax)
+    {
+        return slMax;
+    }
+    return slValue;
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void PidController_Init(PidController_Type *pPid, const PidController_ConfigType *pConfig)
+{
+    /* The per-second gains are folded with the sample period once here, so an update
+     * is only multiplies, adds and shifts */
+    pPid->slKpQ16 = pConfig->slKp << 8;
+    pPid->slKiQ16 = (sint32)(((sint64)pConfig->slKi * pConfig->usSamplePeriodMs * 256) / 1000);
+    pPid->slKdQ16 = (sint32)(((sint64)pConfig->slKd * 1000 * 256) / pConfig->usSamplePeriodMs);
+    pPid->slOutputMinQ16 = (sint32)pConfig->ucOutputMin << 16;
+    pPid->slOutputMaxQ16 = (sint32)pConfig->ucOutputMax << 16;
+    PidController_Reset(pPid);
+}
+
+void PidController_Reset(PidController_Type *pPid)
+{
+    pPid->slIntegralQ16 = pPid->slOutputMinQ16;
+    pPid->sLastMeasurement = 0;
+    pPid->bFirstSample = TRUE;
+}
+
+uint8 PidController_Update(PidController_Type *pPid, sint16 sSetpoint, sint16 sMeasurement)
+{
+    sint32 slError = (sint32)sSetpoint - sMeasurement;   /* Signed, a seat above the setpoint gives a negative error */
+    sint32 slProportional;
+    sint32 slDerivative;
+    sint32 slIntegral;
+    sint32 slOutput;
+
+    if (TRUE == pPid->bFirstSample)
+    {
+        pPid->sLastMeasurement = sMeasurement;
+        pPid->bFirstSample = FALSE;
+    }
+
+    slProportional = pPid->slKpQ16 * slError;
+    slDerivative = -pPid->slKdQ16 * ((sint32)sMeasurement - pPid->sLastMeasurement);
+    pPid->sLastMeasurement = sMeasurement;
+
+    slIntegral = PidController_Clamp(pPid->slIntegralQ16 + (pPid->slKiQ16 * slError),
+                                     pPid->slOutputMinQ16, pPid->slOutputMaxQ16);
+    slOutput = slProportional + slIntegral + slDerivative;
+
+    /* Anti-windup: only keep the new integral if it does not push further into saturation */
+    if (!(((slOutput > pPid->slOutputMaxQ16) && (slError > 0)) ||
+          ((slOutput < pPid->slOutputMinQ16) && (slError < 0))))
+    {
+        pPid->slIntegralQ16 = slIntegral;
+    }
+
+    slOutput = PidController_Clamp(slOutput, pPid->slOutputMinQ16, pPid->slOutputMaxQ16);
+
+    /* Round to the nearest % */
+    return (uint8)((slOutput + 0x8000) >> 16);
+}
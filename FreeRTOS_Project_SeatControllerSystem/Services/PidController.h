@@ -0,0 +1,68 @@
+/******************************************************************************
+ *
+ * Module: PidController
+ *
+ * File Name: PidController.h
+ *
+ * Description: Header file for the integer PID controller.
+ *              One controller object per seat. Setpoint and measurement are in
+ *              0.1 C, the output is a 0 .. 100 % heater drive. Gains are Q8 fixed
+ *              point, the controller state is kept in Q16 so slow integral steps
+ *              are not lost. The integral is clamped to the output range and is
+ *              frozen while the output saturates in the direction of the error
+ *              (anti-windup), and the derivative acts on the measurement so a
+ *              setpoint change does not kick the output.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#ifndef PID_CONTROLLER_H
+#define PID_CONTROLLER_H
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+/* Gains are Q8: PID_CONTROLLER_GAIN(1.5) == 384 */
+#define PID_CONTROLLER_GAIN_ONE          (256)
+#define PID_CONTROLLER_GAIN(value)       ((sint32)((value) * PID_CONTROLLER_GAIN_ONE))
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+typedef struct
+{
+    sint32 slKp;                /* % per 0.1 C, Q8 */
+    sint32 slKi;                /* % per 0.1 C per second, Q8 */
+    sint32 slKd;                /* % per 0.1 C/s, Q8 */
+    uint16 usSamplePeriodMs;    /* Time between two PidController_Update calls */
+    uint8  ucOutputMin;         /* % */
+    uint8  ucOutputMax;         /* % */
+} PidController_ConfigType;
+
+typedef struct
+{
+    sint32 slKpQ16;             /* Gains scaled to the sample period, Q16 */
+    sint32 slKiQ16;
+    sint32 slKdQ16;
+    sint32 slIntegralQ16;       /* Integral contribution to the output, Q16 % */
+    sint32 slOutputMinQ16;
+    sint32 slOutputMaxQ16;
+    sint16 sLastMeasurement;
+    boolean bFirstSample;
+} PidController_Type;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/* Scale the gains to the sample period and reset the state */
+void PidController_Init(PidController_Type *pPid, const PidController_ConfigType *pConfig);
+
+/* Clear the integral and the derivative history, e.g. when the heater is switched off */
+void PidController_Reset(PidController_Type *pPid);
+
+/* Run one sample period, returns the output in % */
+uint8 PidController_Update(PidController_Type *pPid, sint16 sSetpoint, sint16 sMeasurement);
+
+#endif /* PID_CONTROLLER_H */
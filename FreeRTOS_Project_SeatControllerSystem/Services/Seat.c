@@ -0,0 +1,185 @@
+/******************************************************************************
+ *
+ * Module: Seat
+ *
+ * File Name: Seat.c
+ *
+ * Description: Source file for the per-seat heater logic. The functions only
+ *              touch the seat data, the tasks in main.c own the I/O.
+ *              Tools/seat_scaling_bench.c measures the cost per seat.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include "Seat.h"
+
+/*******************************************************************************
+ *                              Module Variables                               *
+ *******************************************************************************/
+static const uint8 Seat_Setpoints[SEAT_NUMBER_OF_SETPOINTS] = SEAT_SETPOINTS;
+
+/*******************************************************************************
+ *                         Private Functions Definitions                       *
+ *******************************************************************************/
+
+/* Band of the PID output shown on the dashboard and recorded with failures */
+static HeatingLevel Seat_LevelFromDuty(uint8 ucDuty)
+{
+    if (0 == ucDuty)
+    {
+        return TURN_OFF_HEATER;
+    }
+    else if (ucDuty <= LOW_HEATER_DUTY_PERCENT)
+    {
+        return LOW_HEATER_INTENSITY;
+    }
+    else if (ucDuty <= MEDIUM_HEATER_DUTY_PERCENT)
+    {
+        return MEDIUM_HEATER_INTENSITY;
+    }
+    else
+    {
+        return HIGH_HEATER_INTENSITY;
+    }
+}
+
+static boolean Seat_TemperatureValid(TempConv_DeciCelsiusType sTemp)
+{
+    return (boolean)((sTemp >= TEMP_CONV_DECI_CELSIUS(MIN_VALID_TEMP)) && (sTemp <= TEMP_CONV_DECI_CELSIUS(MAX_VALID_TEMP)));
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void Seat_Init(const Seat_ConfigType *pConfig, Seat_StateType *pSeat, const PidController_ConfigType *pPidConfig)
+{
+    pSeat->ucButtonPresses = 0;
+    SensorFilter_Init(&pSeat->xFilter, &pConfig->xFilter);
+    PidController_Init(&pSeat->xPid, pPidConfig);
+
+    /* Runs before the scheduler starts, nobody reads yet */
+    SeqLock_Init(&pSeat->xLock);
+    pSeat->xShared.ucDesiredTemp = SEAT_HEATING_OFF;
+    pSeat->xShared.sCurrentTemp = 0;
+    pSeat->xShared.usAdcValue = 0;
+    pSeat->xShared.ucHeaterDuty = 0;
+    pSeat->xShared.HeaterLevel = TURN_OFF_HEATER;
+    pSeat->xShared.bSensorFailure = FALSE;
+    pSeat->xShared.xLatestFailure.failureMessage = NULL_PTR;
+    pSeat->xShared.xLatestFailure.timestamp = 0;
+    pSeat->xShared.xLatestFailure.level = TURN_OFF_HEATER;
+}
+
+boolean Seat_HandlePress(Seat_StateType *pSeat)
+{
+    pSeat->ucButtonPresses++;
+    if (pSeat->ucButtonPresses >= SEAT_NUMBER_OF_SETPOINTS)
+    {
+        pSeat->ucButtonPresses = 0;
+    }
+    SeqLock_WriteBegin(&pSeat->xLock);
+    pSeat->xShared.ucDesiredTemp = Seat_Setpoints[pSeat->ucButtonPresses];
+    SeqLock_WriteEnd(&pSeat->xLock);
+    return TRUE;
+}
+
+boolean Seat_HandleLongPress(Seat_StateType *pSeat)
+{
+    if (0U == pSeat->ucButtonPresses)
+    {
+        return FALSE; /* Already off */
+    }
+    pSeat->ucButtonPresses = 0;
+    SeqLock_WriteBegin(&pSeat->xLock);
+    pSeat->xShared.ucDesiredTemp = Seat_Setpoints[0];
+    SeqLock_WriteEnd(&pSeat->xLock);
+    return TRUE;
+}
+
+uint16 Seat_FilterSample(Seat_StateType *pSeat, uint16 usSample)
+{
+    return SensorFilter_Process(&pSeat->xFilter, usSample);
+}
+
+void Seat_SetTemperature(const Seat_ConfigType *pConfig, Seat_StateType *pSeat, uint16 usFiltered)
+{
+    TempConv_DeciCelsiusType sTemp = TempConv_ToDeciCelsius(pConfig->ucAdcStep, usFiltered);
+
+    SeqLock_WriteBegin(&pSeat->xLock);
+    pSeat->xShared.sCurrentTemp = sTemp;
+    pSeat->xShared.usAdcValue = usFiltered;
+    SeqLock_WriteEnd(&pSeat->xLock);
+}
+
+void Seat_UpdateHeater(Seat_StateType *pSeat)
+{
+    Seat_SnapshotType xSnapshot;
+    uint8 ucDuty;
+
+    Seat_GetSnapshot(pSeat, &xSnapshot);
+
+    /* The heater stays off, and the controller is reset so it restarts without a stale
+     * integral, while heating is off or the sensor reads out of range */
+    if ((SEAT_HEATING_OFF == xSnapshot.ucDesiredTemp) || (FALSE == Seat_TemperatureValid(xSnapshot.sCurrentTemp)))
+    {
+        PidController_Reset(&pSeat->xPid);
+        ucDuty = 0;
+    }
+    else
+    {
+        ucDuty = PidController_Update(&pSeat->xPid, TEMP_CONV_DECI_CELSIUS(xSnapshot.ucDesiredTemp), xSnapshot.sCurrentTemp);
+    }
+
+    SeqLock_WriteBegin(&pSeat->xLock);
+    pSeat->xShared.ucHeaterDuty = ucDuty;
+    pSeat->xShared.HeaterLevel = Seat_LevelFromDuty(ucDuty);
+    SeqLock_WriteEnd(&pSeat->xLock);
+}
+
+boolean Seat_CheckSensor(const Seat_ConfigType *pConfig, Seat_StateType *pSeat, Timebase_TicksType ullTimestamp)
+{
+    Seat_SnapshotType xSnapshot;
+
+    Seat_GetSnapshot(pSeat, &xSnapshot);
+
+    if (TRUE == Seat_TemperatureValid(xSnapshot.sCurrentTemp))
+    {
+        if (TRUE == xSnapshot.bSensorFailure)
+        {
+            SeqLock_WriteBegin(&pSeat->xLock);
+            pSeat->xShared.bSensorFailure = FALSE;
+            SeqLock_WriteEnd(&pSeat->xLock);
+        }
+        return FALSE;
+    }
+
+    SeqLock_WriteBegin(&pSeat->xLock);
+    pSeat->xShared.xLatestFailure.failureMessage = pConfig->pFailureMessage;
+    pSeat->xShared.xLatestFailure.level = Seat_GetHeaterLevel(&xSnapshot);
+    pSeat->xShared.xLatestFailure.timestamp = ullTimestamp;
+    pSeat->xShared.bSensorFailure = TRUE;
+    SeqLock_WriteEnd(&pSeat->xLock);
+    return TRUE;
+}
+
+void Seat_GetSnapshot(const Seat_StateType *pSeat, Seat_SnapshotType *pSnapshot)
+{
+    uint32 ulSequence;
+
+    do
+    {
+        ulSequence = SeqLock_ReadBegin(&pSeat->xLock);
+        *pSnapshot = pSeat->xShared;
+    }
+    while (TRUE == SeqLock_ReadRetry(&pSeat->xLock, ulSequence));
+}
+
+HeatingLevel Seat_GetHeaterLevel(const Seat_SnapshotType *pSnapshot)
+{
+    return (TRUE == pSnapshot->bSensorFailure) ? TURN_OFF_HEATER : pSnapshot->HeaterLevel;
+}
+
+uint8 Seat_GetHeaterDrive(const Seat_SnapshotType *pSnapshot)
+{
+    return (TURN_OFF_HEATER == Seat_GetHeaterLevel(pSnapshot)) ? 0 : pSnapshot->ucHeaterDuty;
+}
@@ -0,0 +1,121 @@
+/******************************************************************************
+ *
+ * Module: Seat
+ *
+ * File Name: Seat.h
+ *
+ * Description: Header file for the per-seat heater logic.
+ *              Every seat is described by one entry of Seat_Configuration
+ *              (Seat_PBcfg.c) and keeps its run-time data in a Seat_StateType.
+ *              The tasks apply the functions below to each seat in turn, so a
+ *              seat is added by configuration only and the cost of a cycle
+ *              grows linearly with NUMBER_OF_SEATS.
+ *
+ *              The seat data read by several tasks is published under a
+ *              sequence lock (SeqLock.h): every field has a single writer task
+ *              and readers take a consistent Seat_SnapshotType copy without
+ *              ever entering a critical section.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#ifndef SEAT_H
+#define SEAT_H
+
+#include "std_types.h"
+#include "PWM.h"
+#include "SensorFilter.h"
+#include "TempConversion.h"
+#include "PidController.h"
+#include "SeqLock.h"
+#include "Timebase.h"
+#include "FreeRTOS_Project.h"
+
+/*******************************************************************************
+ *                              Configurations                                 *
+ *******************************************************************************/
+/* Setpoints a seat button cycles through, in C (SEAT_HEATING_OFF first) */
+#define SEAT_SETPOINTS  {SEAT_HEATING_OFF, LOW_SEAT_HEATING_TEMPERATURE, MEDIUM_SEAT_HEATING_TEMPERATURE, HIGH_SEAT_HEATING_TEMPERATURE}
+#define SEAT_NUMBER_OF_SETPOINTS         (4U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+/* Static description of a seat */
+typedef struct
+{
+    uint8 ucAdcStep;                    /* Position of the seat sensor in the ADC0 scan, also its TempConversion channel */
+    uint8 ButtonChannel;                /* Dio channel index of the seat button (DioConf_..._CHANNEL_ID_INDEX) */
+    PWM_ChannelType HeaterChannel;      /* PWM output driving the seat heater */
+    uint8 FaultLedChannel;              /* Dio channel index of the sensor failure LED */
+    const uint8 *pName;                 /* Name shown on the dashboard */
+    char *pFailureMessage;              /* Stored in the failure record when the sensor is out of range */
+    SensorFilter_ConfigType xFilter;    /* Spike rejection and smoothing of the seat sensor */
+} Seat_ConfigType;
+
+/* Seat data shared between the tasks, with the only task writing each field */
+typedef struct
+{
+    uint8 ucDesiredTemp;                    /* C, SEAT_HEATING_OFF when off      - vSeatButtonTask     */
+    TempConv_DeciCelsiusType sCurrentTemp;  /* 0.1 C                             - vGetCurrentTempTask */
+    uint16 usAdcValue;                      /* Filtered sensor ADC counts        - vGetCurrentTempTask */
+    uint8 ucHeaterDuty;                     /* PID output in %                   - vHeaterMonitorTask  */
+    HeatingLevel HeaterLevel;               /* Band of ucHeaterDuty              - vHeaterMonitorTask  */
+    boolean bSensorFailure;                 /* Sensor out of range, heater off   - vFailureHandleTask  */
+    FailureRecord xLatestFailure;           /*                                   - vFailureHandleTask  */
+} Seat_SnapshotType;
+
+/* Run-time data of a seat */
+typedef struct
+{
+    /* Private to the single task using each of them */
+    uint8 ucButtonPresses;                  /* Index in SEAT_SETPOINTS */
+    SensorFilter_StateType xFilter;
+    PidController_Type xPid;
+
+    /* Shared, only accessed through the functions below */
+    SeqLock_Type xLock;
+    volatile Seat_SnapshotType xShared;
+} Seat_StateType;
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+/* Seat descriptors, in Seat_PBcfg.c */
+extern const Seat_ConfigType Seat_Configuration[NUMBER_OF_SEATS];
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/* Heating off, filter (configured by pConfig) and controller reset */
+void Seat_Init(const Seat_ConfigType *pConfig, Seat_StateType *pSeat, const PidController_ConfigType *pPidConfig);
+
+/* A debounced button press, moves to the next setpoint. Returns TRUE (the setpoint always changes) */
+boolean Seat_HandlePress(Seat_StateType *pSeat);
+
+/* A long press of the button switches the heating off. Returns TRUE when the setpoint changed */
+boolean Seat_HandleLongPress(Seat_StateType *pSeat);
+
+/* Filter a raw sample of the seat sensor and return the filtered value */
+uint16 Seat_FilterSample(Seat_StateType *pSeat, uint16 usSample);
+
+/* Convert a filtered sample to the current seat temperature */
+void Seat_SetTemperature(const Seat_ConfigType *pConfig, Seat_StateType *pSeat, uint16 usFiltered);
+
+/* Run one PID period: heater duty and level from the setpoint and the current temperature */
+void Seat_UpdateHeater(Seat_StateType *pSeat);
+
+/* Range check of the seat sensor. A failure switches the heater off, through bSensorFailure,
+ * and is recorded with ullTimestamp. Returns TRUE while the sensor has failed */
+boolean Seat_CheckSensor(const Seat_ConfigType *pConfig, Seat_StateType *pSeat, Timebase_TicksType ullTimestamp);
+
+/* Consistent copy of the shared seat data, lock-free, callable from any task */
+void Seat_GetSnapshot(const Seat_StateType *pSeat, Seat_SnapshotType *pSnapshot);
+
+/* Heater level in effect, TURN_OFF_HEATER while the sensor has failed */
+HeatingLevel Seat_GetHeaterLevel(const Seat_SnapshotType *pSnapshot);
+
+/* Duty cycle to drive the heater with, 0 while the sensor has failed */
+uint8 Seat_GetHeaterDrive(const Seat_SnapshotType *pSnapshot);
+
+#endif /* SEAT_H */
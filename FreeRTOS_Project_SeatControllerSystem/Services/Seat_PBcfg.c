@@ -0,0 +1,34 @@
+/******************************************************************************
+ *
+ * Module: Seat
+ *
+ * File Name: Seat_PBcfg.c
+ *
+ * Description: Seat descriptors of the vehicle variant. To add a seat, append
+ *              its sensor to ADC0_SCAN_CHANNELS (adc.h), mux its pins in
+ *              Port_PBcfg.c / Dio_PBcfg.c, add the entry below and raise
+ *              NUMBER_OF_SEATS (FreeRTOS_Project.h).
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include "Seat.h"
+#include "Dio.h"
+#include "Button_Cfg.h"
+#include "adc.h"
+
+/* Every seat needs its own ADC0 scan step and TempConversion channel */
+typedef char Seat_SensorsFitScan[(NUMBER_OF_SEATS <= ADC0_NUMBER_OF_CHANNELS) ? 1 : -1];
+typedef char Seat_SensorsFitCalibration[(NUMBER_OF_SEATS <= TEMP_CONV_NUMBER_OF_CHANNELS) ? 1 : -1];
+
+/* PB structure used by the seat tasks */
+const Seat_ConfigType Seat_Configuration[NUMBER_OF_SEATS] =
+{
+    /* Driver seat: LM35 on AIN0 (PE3), SW1, green LED on the LaunchPad as heater, red LED as fault,
+     * median of 5 and alpha 1/4 */
+    { 0, SW1_BUTTON_PIN_NUM_INDEX, PWM_TIMER1B_PF3, DioConf_RED_LED_CHANNEL_ID_INDEX,
+      (const uint8 *)"Driver Seat", "Invalid Driver Temperature Sensor Range ", { 5U, 2U } },
+    /* Passenger seat: LM35 on AIN1 (PE2), SW2, external green LED as heater, external red LED as fault,
+     * median of 5 and alpha 1/4 */
+    { 1, SW2_BUTTON_PIN_NUM_INDEX, PWM_TIMER0A_PB6, DioConf_RED_LED_OUT_CHANNEL_ID_INDEX,
+      (const uint8 *)"Passenger Seat", "Invalid Passenger Temperature Sensor Range ", { 5U, 2U } }
+};
@@ -0,0 +1,97 @@
+/******************************************************************************
+ *
+ * Module: SensorFilter
+ *
+ * File Name: SensorFilter.c
+ *
+ * Description: Source file for the fixed-point sensor filter chain.
+ *              Median-of-N spike rejection followed by a fixed-point IIR.
+ *              Tools/sensor_filter_bench.c measures the cost per sample.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include "SensorFilter.h"
+
+#if ((SENSOR_FILTER_MAX_MEDIAN_SIZE % 2U) == 0U) || (SENSOR_FILTER_MAX_MEDIAN_SIZE > 7U)
+#error "SENSOR_FILTER_MAX_MEDIAN_SIZE must be odd and at most 7"
+#endif
+
+/*******************************************************************************
+ *                         Private Functions Definitions                       *
+ *******************************************************************************/
+
+/* Median of the valid window entries. The window is tiny, so an insertion sort of a
+ * local copy is both the cheapest and the one with a fixed worst case */
+static uint16 SensorFilter_Median(const SensorFilter_StateType *pState)
+{
+    uint16 ausSorted[SENSOR_FILTER_MAX_MEDIAN_SIZE];
+    uint16 usValue;
+    uint8 ucIndex;
+    uint8 ucSlot;
+
+    for (ucIndex = 0; ucIndex < pState->ucCount; ucIndex++)
+    {
+        usValue = pState->ausWindow[ucIndex];
+        ucSlot = ucIndex;
+        while ((ucSlot > 0U) && (ausSorted[ucSlot - 1U] > usValue))
+        {
+            ausSorted[ucSlot] = ausSorted[ucSlot - 1U];
+            ucSlot--;
+        }
+        ausSorted[ucSlot] = usValue;
+    }
+
+    return ausSorted[pState->ucCount / 2U];
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void SensorFilter_Init(SensorFilter_StateType *pState, const SensorFilter_ConfigType *pConfig)
+{
+    /* An even window has no middle sample, it is widened to the next odd length */
+    pState->ucMedianSize = pConfig->ucMedianSize | 1U;
+    if (pState->ucMedianSize > SENSOR_FILTER_MAX_MEDIAN_SIZE)
+    {
+        pState->ucMedianSize = SENSOR_FILTER_MAX_MEDIAN_SIZE;
+    }
+    pState->ucIirShift = pConfig->ucIirShift;
+    pState->ucIndex = 0;
+    pState->ucCount = 0;
+    pState->ulIirState = 0;
+}
+
+uint16 SensorFilter_Process(SensorFilter_StateType *pState, uint16 usSample)
+{
+    uint32 ulMedian;
+
+    pState->ausWindow[pState->ucIndex] = usSample;
+    pState->ucIndex = (pState->ucIndex + 1U < pState->ucMedianSize) ? (pState->ucIndex + 1U) : 0U;
+
+    if (pState->ucCount < pState->ucMedianSize)
+    {
+        pState->ucCount++;
+        if (1U == pState->ucCount)
+        {
+            /* First sample primes the IIR instead of ramping up from zero */
+            pState->ulIirState = (uint32)usSample << SENSOR_FILTER_FRACTION_BITS;
+            return usSample;
+        }
+    }
+
+    ulMedian = (uint32)SensorFilter_Median(pState) << SENSOR_FILTER_FRACTION_BITS;
+
+    /* y += (x - y) * alpha, written so it stays in unsigned arithmetic */
+    if (ulMedian >= pState->ulIirState)
+    {
+        pState->ulIirState += (ulMedian - pState->ulIirState) >> pState->ucIirShift;
+    }
+    else
+    {
+        pState->ulIirState -= (pState->ulIirState - ulMedian) >> pState->ucIirShift;
+    }
+
+    /* Round to the nearest integer */
+    return (uint16)((pState->ulIirState + (1UL << (SENSOR_FILTER_FRACTION_BITS - 1U))) >> SENSOR_FILTER_FRACTION_BITS);
+}
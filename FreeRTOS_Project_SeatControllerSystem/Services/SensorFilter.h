@@ -0,0 +1,62 @@
+/******************************************************************************
+ *
+ * Module: SensorFilter
+ *
+ * File Name: SensorFilter.h
+ *
+ * Description: Header file for the fixed-point sensor filter chain.
+ *              Every raw sample first goes through a median-of-N window that
+ *              rejects single-sample spikes, then through a first order IIR
+ *              (exponential moving average) kept in fixed point. One state
+ *              struct per channel, no floating point, no division.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#ifndef SENSOR_FILTER_H
+#define SENSOR_FILTER_H
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                              Configurations                                 *
+ *******************************************************************************/
+/* Median window every channel has room for, odd and at most 7. A channel
+ * configures its own window up to this length (SensorFilter_ConfigType) */
+#define SENSOR_FILTER_MAX_MEDIAN_SIZE    (5U)
+
+/* Fractional bits of the IIR state, keeps the small steps of a slow filter from being truncated */
+#define SENSOR_FILTER_FRACTION_BITS      (8U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+/* Filter of one channel */
+typedef struct
+{
+    uint8 ucMedianSize;                 /* Odd, 1 .. SENSOR_FILTER_MAX_MEDIAN_SIZE. A spike lasting up to
+                                         * (ucMedianSize - 1) / 2 samples is rejected completely, 1 disables the stage */
+    uint8 ucIirShift;                   /* IIR smoothing factor alpha = 1 / 2^ucIirShift, 0 disables the stage */
+} SensorFilter_ConfigType;
+
+typedef struct
+{
+    uint16 ausWindow[SENSOR_FILTER_MAX_MEDIAN_SIZE]; /* Last raw samples, circular */
+    uint8  ucIndex;                              /* Next window slot to overwrite */
+    uint8  ucCount;                              /* Valid samples in the window */
+    uint8  ucMedianSize;                         /* From the configuration */
+    uint8  ucIirShift;                           /* From the configuration */
+    uint32 ulIirState;                           /* IIR output in SENSOR_FILTER_FRACTION_BITS fixed point */
+} SensorFilter_StateType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/* Reset a channel and take its configuration, the next sample primes the filter so there is no start-up ramp */
+void SensorFilter_Init(SensorFilter_StateType *pState, const SensorFilter_ConfigType *pConfig);
+
+/* Feed one raw sample and return the filtered value in the same unit. Constant time: one
+ * insertion sort of at most SENSOR_FILTER_MAX_MEDIAN_SIZE entries and one shift-add */
+uint16 SensorFilter_Process(SensorFilter_StateType *pState, uint16 usSample);
+
+#endif /* SENSOR_FILTER_H */
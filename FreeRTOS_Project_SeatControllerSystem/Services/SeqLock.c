@@ -0,0 +1,49 @@
+/******************************************************************************
+ *
+ * Module: SeqLock
+ *
+ * File Name: SeqLock.c
+ *
+ * Description: Source file for the sequence lock.
+ *              Tools/seqlock_stress.c hammers it from several host threads.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include "SeqLock.h"
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void SeqLock_Init(SeqLock_Type *pLock)
+{
+    pLock->ulSequence = 0;
+}
+
+void SeqLock_WriteBegin(SeqLock_Type *pLock)
+{
+    SEQLOCK_WRITER_ENTER();
+    pLock->ulSequence++;
+    SEQLOCK_BARRIER(); /* The odd sequence is visible before any data store */
+}
+
+void SeqLock_WriteEnd(SeqLock_Type *pLock)
+{
+    SEQLOCK_BARRIER(); /* Every data store is visible before the even sequence */
+    pLock->ulSequence++;
+    SEQLOCK_WRITER_EXIT();
+}
+
+uint32 SeqLock_ReadBegin(const SeqLock_Type *pLock)
+{
+    uint32 ulSequence = pLock->ulSequence;
+
+    SEQLOCK_BARRIER(); /* The data is loaded after the sequence */
+    return ulSequence;
+}
+
+boolean SeqLock_ReadRetry(const SeqLock_Type *pLock, uint32 ulSequence)
+{
+    SEQLOCK_BARRIER(); /* The data is loaded before the sequence is checked again */
+    return (boolean)(((ulSequence & 1U) != 0U) || (pLock->ulSequence != ulSequence));
+}
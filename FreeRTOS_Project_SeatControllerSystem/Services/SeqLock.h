@@ -0,0 +1,73 @@
+/******************************************************************************
+ *
+ * Module: SeqLock
+ *
+ * File Name: SeqLock.h
+ *
+ * Description: Header file for the sequence lock protecting data shared
+ *              between tasks. A writer makes the sequence odd, updates the
+ *              data and makes it even again. A reader copies the data between
+ *              two reads of the sequence and retries if it was odd or has
+ *              moved, so readers never block and never lock.
+ *
+ *              Writers are serialized with SEQLOCK_WRITER_ENTER/EXIT (a short
+ *              critical section on the target). On a single core this also
+ *              guarantees a reader never finds a half-finished write left by a
+ *              preempted lower priority writer, so a read retries at most once
+ *              per write that preempts it.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                              Configurations                                 *
+ *******************************************************************************/
+/* Writer serialization, a host build defines both before including this file */
+#ifndef SEQLOCK_WRITER_ENTER
+#include "FreeRTOS.h"
+#include "task.h"
+#define SEQLOCK_WRITER_ENTER()   taskENTER_CRITICAL()
+#define SEQLOCK_WRITER_EXIT()    taskEXIT_CRITICAL()
+#endif
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+/* Orders the sequence accesses against the data accesses, for the compiler and the core */
+#if defined(__TI_ARM__)
+#define SEQLOCK_BARRIER()        __asm("	dmb")
+#else
+#define SEQLOCK_BARRIER()        __atomic_thread_fence(__ATOMIC_ACQ_REL)
+#endif
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+typedef struct
+{
+    volatile uint32 ulSequence;   /* Odd while a write is in progress */
+} SeqLock_Type;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+void SeqLock_Init(SeqLock_Type *pLock);
+
+/* Enter the writer lock and mark the data as being written */
+void SeqLock_WriteBegin(SeqLock_Type *pLock);
+
+/* Publish the write and leave the writer lock */
+void SeqLock_WriteEnd(SeqLock_Type *pLock);
+
+/* Start of a read, returns the sequence to hand to SeqLock_ReadRetry */
+uint32 SeqLock_ReadBegin(const SeqLock_Type *pLock);
+
+/* End of a read, TRUE if the copy may be torn and has to be taken again */
+boolean SeqLock_ReadRetry(const SeqLock_Type *pLock, uint32 ulSequence);
+
+#endif /* SEQLOCK_H */
@@ -0,0 +1,64 @@
+/******************************************************************************
+ *
+ * Module: Signal
+ *
+ * File Name: Signal.c
+ *
+ * Description: Source file for the signalling between the tasks.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include "Signal.h"
+
+/* A signal is one bit of the notification value */
+typedef char SignalsFitNotification[(SIGNAL_NUMBER_OF_SIGNALS <= 32) ? 1 : -1];
+
+/*******************************************************************************
+ *                              Module Variables                               *
+ *******************************************************************************/
+/* Written before the scheduler starts, read only afterwards */
+static TaskHandle_t Signal_Subscribers[SIGNAL_NUMBER_OF_SIGNALS][SIGNAL_MAX_SUBSCRIBERS];
+static uint8 Signal_SubscriberCount[SIGNAL_NUMBER_OF_SIGNALS];
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void Signal_Subscribe(Signal_IdType Id, TaskHandle_t xTask)
+{
+    configASSERT((Id < SIGNAL_NUMBER_OF_SIGNALS) && (Signal_SubscriberCount[Id] < SIGNAL_MAX_SUBSCRIBERS));
+
+    Signal_Subscribers[Id][Signal_SubscriberCount[Id]] = xTask;
+    Signal_SubscriberCount[Id]++;
+}
+
+void Signal_Publish(Signal_IdType Id)
+{
+    uint8 ucSubscriber;
+
+    for (ucSubscriber = 0; ucSubscriber < Signal_SubscriberCount[Id]; ucSubscriber++)
+    {
+        xTaskNotifyIndexed(Signal_Subscribers[Id][ucSubscriber], SIGNAL_NOTIFY_INDEX, SIGNAL_MASK(Id), eSetBits);
+    }
+}
+
+uint32 Signal_Wait(uint32 ulSignals, TickType_t xTicksToWait)
+{
+    TimeOut_t xTimeOut;
+    uint32 ulTaken;
+
+    vTaskSetTimeOutState(&xTimeOut);
+    for (;;)
+    {
+        /* Take the requested bits already set, a notification received while the task waited
+         * for other signals left them in the value without unblocking a later wait */
+        ulTaken = (uint32)ulTaskNotifyValueClearIndexed(NULL, SIGNAL_NOTIFY_INDEX, ulSignals) & ulSignals;
+        if ((0U != ulTaken) || (pdTRUE == xTaskCheckForTimeOut(&xTimeOut, &xTicksToWait)))
+        {
+            return ulTaken;
+        }
+
+        /* Any publish from here on marks the notification pending, none is missed */
+        xTaskNotifyWaitIndexed(SIGNAL_NOTIFY_INDEX, 0, 0, NULL, xTicksToWait);
+    }
+}
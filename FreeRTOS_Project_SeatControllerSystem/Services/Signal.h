@@ -0,0 +1,65 @@
+/******************************************************************************
+ *
+ * Module: Signal
+ *
+ * File Name: Signal.h
+ *
+ * Description: Header file for the signalling between the tasks.
+ *              A producer publishes a signal and every task subscribed to it
+ *              gets the signal bit in its SIGNAL_NOTIFY_INDEX task notification.
+ *              Each subscriber keeps its own copy of the bit until it waits for
+ *              it, so a consumer cannot take a signal from another one, and a
+ *              task only wakes for the signals it subscribed to.
+ *              Tools/signal_fanout_sim.c compares it with the event group it
+ *              replaced.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#ifndef SIGNAL_H
+#define SIGNAL_H
+
+#include "std_types.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*******************************************************************************
+ *                              Configurations                                 *
+ *******************************************************************************/
+/* Task notification index owned by the signals (see configTASK_NOTIFICATION_ARRAY_ENTRIES) */
+#define SIGNAL_NOTIFY_INDEX             (2U)
+
+/* Tasks subscribed to one signal at most */
+#define SIGNAL_MAX_SUBSCRIBERS          (4U)
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+#define SIGNAL_MASK(Id)                 (1UL << (uint32)(Id))
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+/* Signals, with the task publishing each of them */
+typedef enum
+{
+    SIGNAL_TEMPERATURE_UPDATED,     /* New current temperature of every seat  - vGetCurrentTempTask */
+    SIGNAL_SETPOINT_CHANGED,        /* Desired temperature of a seat changed  - vSeatButtonTask     */
+    SIGNAL_HEATER_UPDATED,          /* New heater duty of every seat          - vHeaterMonitorTask  */
+    SIGNAL_NUMBER_OF_SIGNALS
+} Signal_IdType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/* Deliver Id to xTask from now on. Called before the scheduler starts */
+void Signal_Subscribe(Signal_IdType Id, TaskHandle_t xTask);
+
+/* Notify every subscriber of Id, task context only */
+void Signal_Publish(Signal_IdType Id);
+
+/* Block the calling task until one of ulSignals (SIGNAL_MASK bits) is pending or xTicksToWait
+ * ticks have passed. Returns the signals taken, 0 on timeout; the others stay pending */
+uint32 Signal_Wait(uint32 ulSignals, TickType_t xTicksToWait);
+
+#endif /* SIGNAL_H */
@@ -0,0 +1,193 @@
+/******************************************************************************
+ *
+ * Module: StackMonitor
+ *
+ * File Name: StackMonitor.c
+ *
+ * Description: Source file for the task stack usage monitor.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include "StackMonitor.h"
+#include "uart0.h"
+
+/* The kernel only fills the stacks it can scan with this option */
+#if (INCLUDE_uxTaskGetStackHighWaterMark != 1)
+#error "StackMonitor needs INCLUDE_uxTaskGetStackHighWaterMark"
+#endif
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+typedef struct
+{
+    TaskHandle_t xTask;
+    uint16 usStackWords;
+    uint16 usMinFreeWords;              /* Least free stack seen, the high water mark */
+} StackMonitor_TaskType;
+
+/*******************************************************************************
+ *                              Module Variables                               *
+ *******************************************************************************/
+static StackMonitor_TaskType StackMonitor_Tasks[STACKMONITOR_MAX_TASKS];
+static uint8 StackMonitor_NumberOfTasks = 0;
+static uint8 StackMonitor_NextTask = 0;  /* Only used by the task calling StackMonitor_Sample */
+
+/*******************************************************************************
+ *                         Private Functions Definitions                       *
+ *******************************************************************************/
+
+/* Scan one task and keep its least free stack */
+static void StackMonitor_Scan(uint8 ucIndex)
+{
+    StackMonitor_TaskType *pTask = &StackMonitor_Tasks[ucIndex];
+    uint16 usFreeWords = (uint16)uxTaskGetStackHighWaterMark(pTask->xTask);
+
+    /* The dump and the periodic sampling may scan the same task */
+    taskENTER_CRITICAL();
+    if (usFreeWords < pTask->usMinFreeWords)
+    {
+        pTask->usMinFreeWords = usFreeWords;
+    }
+    taskEXIT_CRITICAL();
+}
+
+static void StackMonitor_SendField(sint64 Value)
+{
+    UART0_SendString((const uint8 *)",");
+    UART0_SendInteger(Value);
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void StackMonitor_Register(TaskHandle_t xTask, uint16 usStackWords)
+{
+    taskENTER_CRITICAL();
+    if ((NULL != xTask) && (StackMonitor_NumberOfTasks < STACKMONITOR_MAX_TASKS))
+    {
+        StackMonitor_Tasks[StackMonitor_NumberOfTasks].xTask = xTask;
+        StackMonitor_Tasks[StackMonitor_NumberOfTasks].usStackWords = usStackWords;
+        StackMonitor_Tasks[StackMonitor_NumberOfTasks].usMinFreeWords = usStackWords;
+        StackMonitor_NumberOfTasks++;
+    }
+    taskEXIT_CRITICAL();
+}
+
+void StackMonitor_Sample(void)
+{
+    uint8 ucNumberOfTasks = StackMonitor_GetNumberOfTasks();
+
+    if (0U != ucNumberOfTasks)
+    {
+        StackMonitor_NextTask = (StackMonitor_NextTask + 1U < ucNumberOfTasks) ? (StackMonitor_NextTask + 1U) : 0U;
+        StackMonitor_Scan(StackMonitor_NextTask);
+    }
+}
+
+void StackMonitor_SampleAll(void)
+{
+    uint8 ucNumberOfTasks = StackMonitor_GetNumberOfTasks();
+    uint8 ucIndex;
+
+    for (ucIndex = 0; ucIndex < ucNumberOfTasks; ucIndex++)
+    {
+        StackMonitor_Scan(ucIndex);
+    }
+}
+
+uint8 StackMonitor_GetNumberOfTasks(void)
+{
+    uint8 ucNumberOfTasks;
+
+    taskENTER_CRITICAL();
+    ucNumberOfTasks = StackMonitor_NumberOfTasks;
+    taskEXIT_CRITICAL();
+    return ucNumberOfTasks;
+}
+
+uint16 StackMonitor_Recommend(uint16 usUsedWords)
+{
+    uint32 ulWords = (uint32)usUsedWords + ((((uint32)usUsedWords * STACKMONITOR_MARGIN_PERCENT) + 99U) / 100U);
+
+    ulWords = ((ulWords + STACKMONITOR_ROUND_WORDS - 1U) / STACKMONITOR_ROUND_WORDS) * STACKMONITOR_ROUND_WORDS;
+    return (uint16)((ulWords < STACKMONITOR_MIN_WORDS) ? STACKMONITOR_MIN_WORDS : ulWords);
+}
+
+void StackMonitor_GetReport(uint8 ucIndex, StackMonitor_ReportType *pReport)
+{
+    StackMonitor_TaskType xTask;
+
+    taskENTER_CRITICAL();
+    xTask = StackMonitor_Tasks[ucIndex];
+    taskEXIT_CRITICAL();
+
+    pReport->pcName = pcTaskGetName(xTask.xTask);
+    pReport->usStackWords = xTask.usStackWords;
+    pReport->usUsedWords = xTask.usStackWords - xTask.usMinFreeWords;
+    pReport->usRecommendedWords = StackMonitor_Recommend(pReport->usUsedWords);
+    pReport->Status = (((uint32)pReport->usUsedWords * 100U) > ((uint32)xTask.usStackWords * STACKMONITOR_WARNING_PERCENT)) ?
+                      STACKMONITOR_NEAR_OVERFLOW : STACKMONITOR_OK;
+}
+
+uint8 StackMonitor_GetWarnings(void)
+{
+    StackMonitor_ReportType xReport;
+    uint8 ucNumberOfTasks = StackMonitor_GetNumberOfTasks();
+    uint8 ucWarnings = 0;
+    uint8 ucIndex;
+
+    for (ucIndex = 0; ucIndex < ucNumberOfTasks; ucIndex++)
+    {
+        StackMonitor_GetReport(ucIndex, &xReport);
+        if (STACKMONITOR_NEAR_OVERFLOW == xReport.Status)
+        {
+            ucWarnings++;
+        }
+    }
+    return ucWarnings;
+}
+
+void StackMonitor_Dump(void)
+{
+    StackMonitor_ReportType xReport;
+    uint8 ucNumberOfTasks = StackMonitor_GetNumberOfTasks();
+    uint32 ulStackWords = 0;
+    uint32 ulUsedWords = 0;
+    uint32 ulRecommendedWords = 0;
+    uint8 ucIndex;
+
+    StackMonitor_SampleAll();
+
+    UART0_SendString((const uint8 *)"\r\ntask,stack_words,used_words,free_words,used_percent,recommended_words,status (margin ");
+    UART0_SendInteger(STACKMONITOR_MARGIN_PERCENT);
+    UART0_SendString((const uint8 *)" %)\r\n");
+
+    for (ucIndex = 0; ucIndex < ucNumberOfTasks; ucIndex++)
+    {
+        StackMonitor_GetReport(ucIndex, &xReport);
+        ulStackWords += xReport.usStackWords;
+        ulUsedWords += xReport.usUsedWords;
+        ulRecommendedWords += xReport.usRecommendedWords;
+
+        UART0_SendString((const uint8 *)xReport.pcName);
+        StackMonitor_SendField(xReport.usStackWords);
+        StackMonitor_SendField(xReport.usUsedWords);
+        StackMonitor_SendField(xReport.usStackWords - xReport.usUsedWords);
+        StackMonitor_SendField(((uint32)xReport.usUsedWords * 100U) / xReport.usStackWords);
+        StackMonitor_SendField(xReport.usRecommendedWords);
+        UART0_SendString((STACKMONITOR_NEAR_OVERFLOW == xReport.Status) ? (const uint8 *)",NEAR OVERFLOW\r\n" : (const uint8 *)",ok\r\n");
+    }
+
+    /* A smaller stack frees its words from the kernel heap, a larger one needs them */
+    UART0_SendString((const uint8 *)"total");
+    StackMonitor_SendField(ulStackWords);
+    StackMonitor_SendField(ulUsedWords);
+    StackMonitor_SendField(ulStackWords - ulUsedWords);
+    StackMonitor_SendField((0U != ulStackWords) ? ((ulUsedWords * 100U) / ulStackWords) : 0U);
+    StackMonitor_SendField(ulRecommendedWords);
+    UART0_SendString((const uint8 *)",heap bytes freed by the recommended sizes: ");
+    UART0_SendInteger(((sint64)ulStackWords - (sint64)ulRecommendedWords) * (sint64)sizeof(StackType_t));
+    UART0_SendString((const uint8 *)"\r\n");
+}
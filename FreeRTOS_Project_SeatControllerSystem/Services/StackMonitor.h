@@ -0,0 +1,91 @@
+/******************************************************************************
+ *
+ * Module: StackMonitor
+ *
+ * File Name: StackMonitor.h
+ *
+ * Description: Header file for the task stack usage monitor. The kernel fills
+ *              every stack with a known pattern, uxTaskGetStackHighWaterMark
+ *              scans for the deepest word ever overwritten. The scan takes
+ *              time proportional to the free stack, so StackMonitor_Sample
+ *              only scans one registered task per call. For every task the
+ *              least free stack seen is kept, a task that has used more than
+ *              STACKMONITOR_WARNING_PERCENT of its stack is flagged and a
+ *              stack size is recommended: the deepest use plus
+ *              STACKMONITOR_MARGIN_PERCENT, rounded up. The recommendation
+ *              only covers the paths the tasks ran since start-up.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#ifndef STACKMONITOR_H
+#define STACKMONITOR_H
+
+#include "std_types.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*******************************************************************************
+ *                              Configurations                                 *
+ *******************************************************************************/
+/* The application tasks, the idle task and the timer service task */
+#define STACKMONITOR_MAX_TASKS           (10U)
+
+/* Head room added to the deepest use seen for the recommended size */
+#define STACKMONITOR_MARGIN_PERCENT      (25U)
+
+/* Recommended sizes are rounded up to this many words and never below the minimum. A task stack holds
+ * at least the 17-word exception frame, 50 words once the task has used the FPU */
+#define STACKMONITOR_ROUND_WORDS         (8U)
+#define STACKMONITOR_MIN_WORDS           (64U)
+
+/* A task that has used more than this share of its stack is near overflow */
+#define STACKMONITOR_WARNING_PERCENT     (85U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+typedef enum
+{
+    STACKMONITOR_OK,
+    STACKMONITOR_NEAR_OVERFLOW
+} StackMonitor_StatusType;
+
+/* Stack use of one task in words (StackType_t) */
+typedef struct
+{
+    const char *pcName;
+    uint16 usStackWords;                /* Size it was created with */
+    uint16 usUsedWords;                 /* Deepest use seen */
+    uint16 usRecommendedWords;
+    StackMonitor_StatusType Status;
+} StackMonitor_ReportType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/* Watch a task created with usStackWords, before the scheduler starts or from a task */
+void StackMonitor_Register(TaskHandle_t xTask, uint16 usStackWords);
+
+/* Scan the next registered task, from a task */
+void StackMonitor_Sample(void);
+
+/* Scan every registered task, from a task. Takes about a scan of every free stack word */
+void StackMonitor_SampleAll(void);
+
+/* Number of registered tasks */
+uint8 StackMonitor_GetNumberOfTasks(void);
+
+/* Use and recommendation of the registered task ucIndex, from the samples taken so far */
+void StackMonitor_GetReport(uint8 ucIndex, StackMonitor_ReportType *pReport);
+
+/* Number of tasks near overflow, from the samples taken so far */
+uint8 StackMonitor_GetWarnings(void);
+
+/* Recommended size of a stack whose deepest use was usUsedWords */
+uint16 StackMonitor_Recommend(uint16 usUsedWords);
+
+/* Scan every task and send the report as text over UART0, one CSV line per task and the totals, from a task */
+void StackMonitor_Dump(void);
+
+#endif /* STACKMONITOR_H */
@@ -0,0 +1,159 @@
+/******************************************************************************
+ *
+ * Module: Telemetry
+ *
+ * File Name: Telemetry.c
+ *
+ * Description: Source file for the binary telemetry stream.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include "Telemetry.h"
+#include "uart0.h"
+
+/*******************************************************************************
+ *                              Module Variables                               *
+ *******************************************************************************/
+/* CRC-16/CCITT remainders for one nibble, keeps the table at 32 bytes of flash */
+static const uint16 Telemetry_CrcNibbleTable[16] =
+{
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+static uint16 Telemetry_Sequence = 0;
+
+/*******************************************************************************
+ *                         Private Functions Definitions                       *
+ *******************************************************************************/
+
+static uint8 * Telemetry_PutU16(uint8 *pBuffer, uint16 usValue)
+{
+    *pBuffer++ = (uint8)(usValue);
+    *pBuffer++ = (uint8)(usValue >> 8);
+    return pBuffer;
+}
+
+static uint8 * Telemetry_PutU32(uint8 *pBuffer, uint32 ulValue)
+{
+    *pBuffer++ = (uint8)(ulValue);
+    *pBuffer++ = (uint8)(ulValue >> 8);
+    *pBuffer++ = (uint8)(ulValue >> 16);
+    *pBuffer++ = (uint8)(ulValue >> 24);
+    return pBuffer;
+}
+
+static uint8 * Telemetry_PutU64(uint8 *pBuffer, uint64 ullValue)
+{
+    pBuffer = Telemetry_PutU32(pBuffer, (uint32)ullValue);
+    return Telemetry_PutU32(pBuffer, (uint32)(ullValue >> 32));
+}
+
+/* Consistent Overhead Byte Stuffing: removes every 0x00 from the data so that
+ * 0x00 can delimit frames. Returns the encoded length (without delimiter) */
+static uint16 Telemetry_CobsEncode(const uint8 *pInput, uint16 usLength, uint8 *pOutput)
+{
+    uint16 usRead = 0;
+    uint16 usWrite = 1;
+    uint16 usCodeIndex = 0;
+    uint8 ucCode = 1;
+
+    while (usRead < usLength)
+    {
+        if (pInput[usRead] == 0U)
+        {
+            pOutput[usCodeIndex] = ucCode;
+            usCodeIndex = usWrite++;
+            ucCode = 1;
+        }
+        else
+        {
+            pOutput[usWrite++] = pInput[usRead];
+            ucCode++;
+            if (ucCode == 0xFFU)
+            {
+                pOutput[usCodeIndex] = ucCode;
+                usCodeIndex = usWrite++;
+                ucCode = 1;
+            }
+        }
+        usRead++;
+    }
+    pOutput[usCodeIndex] = ucCode;
+
+    return usWrite;
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+uint16 Telemetry_Crc16(const uint8 *pData, uint16 usLength)
+{
+    uint16 usCrc = 0xFFFF;
+
+    while (usLength-- > 0U)
+    {
+        usCrc = (usCrc << 4) ^ Telemetry_CrcNibbleTable[(usCrc >> 12) ^ (*pData >> 4)];
+        usCrc = (usCrc << 4) ^ Telemetry_CrcNibbleTable[(usCrc >> 12) ^ (*pData & 0x0FU)];
+        pData++;
+    }
+    return usCrc;
+}
+
+uint16 Telemetry_EncodeFrame(uint8 *pPayload, uint16 usLength, uint8 *pFrame)
+{
+    /* The CRC covers the whole payload and is appended little-endian */
+    Telemetry_PutU16(&pPayload[usLength], Telemetry_Crc16(pPayload, usLength));
+
+    usLength = Telemetry_CobsEncode(pPayload, usLength + TELEMETRY_CRC_SIZE, pFrame);
+    pFrame[usLength++] = 0x00; /* Frame delimiter */
+
+    return usLength;
+}
+
+uint16 Telemetry_EncodeRecord(const Telemetry_RecordType *pRecord, uint8 *pFrame)
+{
+    uint8 aPayload[TELEMETRY_PAYLOAD_SIZE + TELEMETRY_CRC_SIZE];
+    uint8 *pWrite = aPayload;
+    uint8 ucIndex;
+
+    *pWrite++ = TELEMETRY_RECORD_VERSION;
+    pWrite = Telemetry_PutU16(pWrite, Telemetry_Sequence++);
+    pWrite = Telemetry_PutU64(pWrite, pRecord->ullTimestamp);
+    *pWrite++ = TELEMETRY_NUMBER_OF_SEATS;
+
+    for (ucIndex = 0; ucIndex < TELEMETRY_NUMBER_OF_SEATS; ucIndex++)
+    {
+        *pWrite++ = pRecord->Seats[ucIndex].ucHeaterLevel;
+        *pWrite++ = pRecord->Seats[ucIndex].ucDesiredTemp;
+        pWrite = Telemetry_PutU16(pWrite, (uint16)pRecord->Seats[ucIndex].sCurrentTemp);
+    }
+
+    *pWrite++ = pRecord->ucCpuLoad;
+
+    for (ucIndex = 0; ucIndex < TELEMETRY_NUMBER_OF_TASKS; ucIndex++)
+    {
+        pWrite = Telemetry_PutU64(pWrite, pRecord->ullTaskTime[ucIndex]);
+    }
+
+    for (ucIndex = 0; ucIndex < TELEMETRY_NUMBER_OF_SEATS; ucIndex++)
+    {
+        *pWrite++ = pRecord->Seats[ucIndex].ucFailureCode;
+        *pWrite++ = pRecord->Seats[ucIndex].ucFailureLevel;
+        pWrite = Telemetry_PutU64(pWrite, pRecord->Seats[ucIndex].ullFailureTimestamp);
+    }
+
+    pWrite = Telemetry_PutU32(pWrite, pRecord->ulAdcOverruns);
+
+    return Telemetry_EncodeFrame(aPayload, TELEMETRY_PAYLOAD_SIZE, pFrame);
+}
+
+void Telemetry_SendRecord(const Telemetry_RecordType *pRecord)
+{
+    uint8 aFrame[TELEMETRY_MAX_FRAME_SIZE];
+    uint16 usLength;
+
+    usLength = Telemetry_EncodeRecord(pRecord, aFrame);
+    UART0_SendBuffer(aFrame, usLength);
+}
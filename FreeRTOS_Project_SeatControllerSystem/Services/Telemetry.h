@@ -0,0 +1,89 @@
+/******************************************************************************
+ *
+ * Module: Telemetry
+ *
+ * File Name: Telemetry.h
+ *
+ * Description: Header file for the binary telemetry stream.
+ *              Each record is serialized little-endian, protected by a CRC-16
+ *              and COBS framed, so a 0x00 byte always delimits the records on
+ *              the wire. Tools/telemetry_decode.c turns a capture into CSV.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include "std_types.h"
+#include "FreeRTOS_Project.h"
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+/* Record format version, bump it whenever the payload layout changes */
+#define TELEMETRY_RECORD_VERSION       (5U)
+
+#define TELEMETRY_NUMBER_OF_SEATS      (NUMBER_OF_SEATS)
+#define TELEMETRY_NUMBER_OF_TASKS      (8U)
+
+/* Payload layout (little-endian), times in us:
+ *   version(1) sequence(2) timestamp(8) number of seats(1)
+ *   per seat: heater level(1) desired temp C(1) current temp 0.1 C signed(2)
+ *   CPU load(1)
+ *   per task: total run time(8)
+ *   per seat: failure code(1) failure heater level(1) failure timestamp(8)
+ *   ADC sample overruns(4) */
+#define TELEMETRY_PAYLOAD_SIZE         (12U + (TELEMETRY_NUMBER_OF_SEATS * 4U) + 1U + \
+                                        (TELEMETRY_NUMBER_OF_TASKS * 8U) + (TELEMETRY_NUMBER_OF_SEATS * 10U) + 4U)
+#define TELEMETRY_CRC_SIZE             (2U)
+
+/* COBS adds one byte per 254 bytes plus one, and the frame ends with a 0x00 delimiter */
+#define TELEMETRY_FRAME_SIZE(PayloadSize) \
+    ((PayloadSize) + TELEMETRY_CRC_SIZE + 2U + (((PayloadSize) + TELEMETRY_CRC_SIZE) / 254U))
+#define TELEMETRY_MAX_FRAME_SIZE       TELEMETRY_FRAME_SIZE(TELEMETRY_PAYLOAD_SIZE)
+
+/* Failure codes carried in the record */
+#define TELEMETRY_FAILURE_NONE         (0U)
+#define TELEMETRY_FAILURE_SENSOR_RANGE (1U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+typedef struct
+{
+    uint8  ucHeaterLevel;
+    uint8  ucDesiredTemp;
+    sint16 sCurrentTemp;   /* 0.1 C */
+    uint8  ucFailureCode;
+    uint8  ucFailureLevel;
+    uint64 ullFailureTimestamp;    /* us */
+} Telemetry_SeatType;
+
+typedef struct
+{
+    uint64 ullTimestamp;           /* us */
+    Telemetry_SeatType Seats[TELEMETRY_NUMBER_OF_SEATS];
+    uint8  ucCpuLoad;
+    uint64 ullTaskTime[TELEMETRY_NUMBER_OF_TASKS];  /* us */
+    uint32 ulAdcOverruns;
+} Telemetry_RecordType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/* CRC-16/CCITT-FALSE (polynomial 0x1021, initial value 0xFFFF) */
+uint16 Telemetry_Crc16(const uint8 *pData, uint16 usLength);
+
+/* CRC-protect and COBS-frame any payload into pFrame (TELEMETRY_FRAME_SIZE(usLength) bytes). pPayload needs
+ * room for the CRC after usLength bytes. Returns the frame length including the trailing 0x00 delimiter */
+uint16 Telemetry_EncodeFrame(uint8 *pPayload, uint16 usLength, uint8 *pFrame);
+
+/* Serialize, CRC-protect and COBS-frame a record into pFrame (TELEMETRY_MAX_FRAME_SIZE bytes).
+ * Returns the frame length including the trailing 0x00 delimiter */
+uint16 Telemetry_EncodeRecord(const Telemetry_RecordType *pRecord, uint8 *pFrame);
+
+/* Encode a record and queue it on UART0 */
+void Telemetry_SendRecord(const Telemetry_RecordType *pRecord);
+
+#endif /* TELEMETRY_H */
@@ -0,0 +1,59 @@
+/******************************************************************************
+ *
+ * Module: TempConversion
+ *
+ * File Name: TempConversion.c
+ *
+ * Description: Source file for the ADC to temperature conversion.
+ *              The calibration gain is folded into the Q16 scale factor when it
+ *              is set, so a conversion is one multiply, one add and one shift.
+ *              Tools/temp_conversion_bench.c compares it with the old divide.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include "TempConversion.h"
+
+/* 12-bit samples times the largest scale must stay inside 32 bits */
+typedef char TempConv_RangeCheck[((TEMP_CONV_ADC_FULL_SCALE * TEMP_CONV_SCALE_Q16 * 2UL) < 0xFFFFFFFFUL) ? 1 : -1];
+
+/*******************************************************************************
+ *                              Module Variables                               *
+ *******************************************************************************/
+/* Per-channel Q16 scale (0.1 C per count, gain included) and offset */
+static uint32 TempConv_Scale[TEMP_CONV_NUMBER_OF_CHANNELS];
+static TempConv_DeciCelsiusType TempConv_Offset[TEMP_CONV_NUMBER_OF_CHANNELS];
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void TempConv_Init(void)
+{
+    uint8 ucChannel;
+
+    for (ucChannel = 0; ucChannel < TEMP_CONV_NUMBER_OF_CHANNELS; ucChannel++)
+    {
+        TempConv_SetCalibration(ucChannel, TEMP_CONV_DEFAULT_GAIN_Q16, TEMP_CONV_DEFAULT_OFFSET);
+    }
+}
+
+void TempConv_SetCalibration(uint8 ucChannel, uint32 ulGainQ16, TempConv_DeciCelsiusType sOffset)
+{
+    if (ucChannel >= TEMP_CONV_NUMBER_OF_CHANNELS)
+    {
+        return;
+    }
+    /* Gains up to 2.0 keep raw * scale inside 32 bits (see TempConv_RangeCheck) */
+    if (ulGainQ16 > (2UL << 16))
+    {
+        ulGainQ16 = (2UL << 16);
+    }
+    TempConv_Scale[ucChannel] = ((TEMP_CONV_SCALE_Q16 * ulGainQ16) + 0x8000UL) >> 16;
+    TempConv_Offset[ucChannel] = sOffset;
+}
+
+TempConv_DeciCelsiusType TempConv_ToDeciCelsius(uint8 ucChannel, uint16 usRaw)
+{
+    /* Round to the nearest 0.1 C */
+    return (TempConv_DeciCelsiusType)(((usRaw * TempConv_Scale[ucChannel]) + 0x8000UL) >> 16) + TempConv_Offset[ucChannel];
+}
@@ -0,0 +1,60 @@
+/******************************************************************************
+ *
+ * Module: TempConversion
+ *
+ * File Name: TempConversion.h
+ *
+ * Description: Header file for the ADC to temperature conversion.
+ *              Converts raw 12-bit seat sensor samples to 0.1 degree Celsius
+ *              fixed point with one Q16 multiply-shift per sample (no runtime
+ *              division) and applies a per-channel gain and offset calibration.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#ifndef TEMP_CONVERSION_H
+#define TEMP_CONVERSION_H
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                              Configurations                                 *
+ *******************************************************************************/
+#define TEMP_CONV_NUMBER_OF_CHANNELS     (2U)
+
+/* ADC full scale and the temperature it represents (the seat sensors read 45.0 C at 4095) */
+#define TEMP_CONV_ADC_FULL_SCALE         (4095UL)
+#define TEMP_CONV_SPAN_DECI_CELSIUS      (450UL)
+
+/* Default calibration of every channel: gain 1.0 (Q16) and no offset */
+#define TEMP_CONV_DEFAULT_GAIN_Q16       (65536UL)
+#define TEMP_CONV_DEFAULT_OFFSET         (0)
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+/* 0.1 C per ADC count in Q16, rounded, evaluated by the compiler */
+#define TEMP_CONV_SCALE_Q16              (((TEMP_CONV_SPAN_DECI_CELSIUS << 16) + (TEMP_CONV_ADC_FULL_SCALE / 2UL)) / TEMP_CONV_ADC_FULL_SCALE)
+
+/* Whole degrees to the 0.1 C fixed point type */
+#define TEMP_CONV_DECI_CELSIUS(degrees)  ((TempConv_DeciCelsiusType)((degrees) * 10))
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+/* Temperature in 0.1 degree Celsius steps */
+typedef sint16 TempConv_DeciCelsiusType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/* Load the default calibration on every channel */
+void TempConv_Init(void);
+
+/* Calibrate a channel: T = raw * scale * (ulGainQ16 / 65536) + sOffset (sOffset in 0.1 C) */
+void TempConv_SetCalibration(uint8 ucChannel, uint32 ulGainQ16, TempConv_DeciCelsiusType sOffset);
+
+/* Convert a raw sample of the channel to 0.1 C */
+TempConv_DeciCelsiusType TempConv_ToDeciCelsius(uint8 ucChannel, uint16 usRaw);
+
+#endif /* TEMP_CONVERSION_H */
@@ -0,0 +1,66 @@
+/******************************************************************************
+ *
+ * Module: Timebase
+ *
+ * File Name: Timebase.c
+ *
+ * Description: Source file for the monotonic 64-bit timestamp service.
+ *              Tools/timebase_wrap_test.c checks Timebase_Now across wraps
+ *              with the interrupt delayed or preempting the read.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include "Timebase.h"
+#include "GPTM.h"
+
+/* The prescaler divides the system clock down to one tick */
+typedef char TimebasePrescalerFits[(((TIMEBASE_CLOCK_HZ / TIMEBASE_TICKS_PER_SECOND) - 1UL) <= 0xFFFFUL) ? 1 : -1];
+
+/*******************************************************************************
+ *                              Module Variables                               *
+ *******************************************************************************/
+/* Upper 32 bits of the timestamp, only written by the WTimer0A interrupt */
+static volatile uint32 Timebase_Wraps = 0;
+
+/*******************************************************************************
+ *                         Private Functions Definitions                       *
+ *******************************************************************************/
+
+static void Timebase_WrapCallback(void)
+{
+    Timebase_Wraps++;
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void Timebase_Init(void)
+{
+    Timebase_Wraps = 0;
+    GPTM_WTimer0Init((uint16)((TIMEBASE_CLOCK_HZ / TIMEBASE_TICKS_PER_SECOND) - 1UL), Timebase_WrapCallback);
+}
+
+Timebase_TicksType Timebase_Now(void)
+{
+    uint32 ulWraps;
+    uint32 ulHigh;
+    uint32 ulLow;
+
+    do
+    {
+        ulWraps = Timebase_Wraps;
+        ulHigh = ulWraps;
+        ulLow = GPTM_WTimer0Read();
+
+        /* The count wrapped but the interrupt has not run yet (the caller masks it or runs in a
+         * critical section). A low count was read after that wrap, a high one just before it */
+        if ((TRUE == GPTM_WTimer0OverflowPending()) && (ulLow < 0x80000000UL))
+        {
+            ulHigh++;
+        }
+    }
+    while (ulWraps != Timebase_Wraps); /* The interrupt ran meanwhile, read again */
+
+    return ((Timebase_TicksType)ulHigh << 32) | ulLow;
+}
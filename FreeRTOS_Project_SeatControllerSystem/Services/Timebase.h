@@ -0,0 +1,64 @@
+/******************************************************************************
+ *
+ * Module: Timebase
+ *
+ * File Name: Timebase.h
+ *
+ * Description: Header file for the monotonic 64-bit timestamp service.
+ *              WTimer0A counts the low 32 bits and its time-out interrupt the
+ *              wraps. Timebase_Now takes no lock and may be called from any
+ *              task or interrupt, a wrap the interrupt has not counted yet is
+ *              read from the timer itself. At one clock per tick (62.5 ns at
+ *              16 MHz) the timestamps wrap after more than 36000 years, at
+ *              1 us resolution after more than 500000 years.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#ifndef TIMEBASE_H
+#define TIMEBASE_H
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                              Configurations                                 *
+ *******************************************************************************/
+#define TIMEBASE_RESOLUTION_US          (0U)    /* 1 us per tick */
+#define TIMEBASE_RESOLUTION_CLOCK       (1U)    /* One system clock per tick */
+
+#define TIMEBASE_RESOLUTION             TIMEBASE_RESOLUTION_CLOCK
+
+/* System clock feeding the timer, checked against configCPU_CLOCK_HZ in main.c */
+#define TIMEBASE_CLOCK_HZ               (16000000UL)
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+#if (TIMEBASE_RESOLUTION == TIMEBASE_RESOLUTION_US)
+#define TIMEBASE_TICKS_PER_SECOND       (1000000UL)
+#else
+#define TIMEBASE_TICKS_PER_SECOND       (TIMEBASE_CLOCK_HZ)
+#endif
+
+#define TIMEBASE_TICKS_PER_MS           (TIMEBASE_TICKS_PER_SECOND / 1000UL)
+#define TIMEBASE_TICKS_PER_US           (TIMEBASE_TICKS_PER_SECOND / 1000000UL)
+
+/* Timestamps and durations in other units */
+#define TIMEBASE_TO_MS(Ticks)           ((Ticks) / TIMEBASE_TICKS_PER_MS)
+#define TIMEBASE_TO_US(Ticks)           ((Ticks) / TIMEBASE_TICKS_PER_US)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+typedef uint64 Timebase_TicksType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/* Start counting from 0, before the scheduler starts */
+void Timebase_Init(void);
+
+/* Ticks since Timebase_Init, from any task or interrupt */
+Timebase_TicksType Timebase_Now(void);
+
+#endif /* TIMEBASE_H */
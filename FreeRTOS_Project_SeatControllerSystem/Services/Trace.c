@@ -0,0 +1,218 @@
+/******************************************************************************
+ *
+ * Module: Trace
+ *
+ * File Name: Trace.c
+ *
+ * Description: Source file for the binary kernel event trace recorder. A record
+ *              masks the kernel-aware interrupts (nestable, so it may run in a
+ *              critical section or an interrupt) for one timer read and four
+ *              stores. Compiled to nothing with TRACE_OUTPUT STD_OFF.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "Trace.h"
+#include "Telemetry.h"
+#include "Timebase.h"
+#include "GPTM.h"
+#include "tm4c123gh6pm_registers.h"
+
+/* The MCAL interrupt handlers record through this module exactly when it is built in */
+typedef char Trace_IsrHooksMatchOutput[(MCAL_ISR_TRACE == TRACE_OUTPUT) ? 1 : -1];
+
+#if (TRACE_OUTPUT == STD_ON)
+
+/* The ring index wraps with a mask and every kernel task name fits */
+typedef char Trace_BufferIsPowerOfTwo[((TRACE_BUFFER_EVENTS & (TRACE_BUFFER_EVENTS - 1U)) == 0U) ? 1 : -1];
+typedef char Trace_NamesFit[(configMAX_TASK_NAME_LEN <= TRACE_MAX_NAME_LENGTH) ? 1 : -1];
+typedef char Trace_FrameCountFits[(TRACE_EVENTS_PER_FRAME <= 255U) ? 1 : -1];
+
+/* Exception number of the active interrupt, VECTACTIVE of the interrupt control register */
+#define TRACE_VECTACTIVE_MASK         (0x1FFUL)
+
+/*******************************************************************************
+ *                              Module Variables                               *
+ *******************************************************************************/
+static Trace_EventType Trace_Buffer[TRACE_BUFFER_EVENTS];
+static uint32 Trace_Head = 0;             /* Next slot written */
+static uint32 Trace_Count = 0;            /* Events waiting */
+static uint32 Trace_Dropped = 0;          /* Events lost to a full ring since start-up */
+static uint16 Trace_Sequence = 0;         /* Of the next events frame */
+static uint16 Trace_RecordCost = 0;       /* Timebase ticks per record, measured by Trace_Init */
+
+/* Names live in the TCBs, tasks are never deleted */
+static const char *Trace_TaskNames[TRACE_MAX_TASKS];
+
+/*******************************************************************************
+ *                         Private Functions Definitions                       *
+ *******************************************************************************/
+
+static uint8 *Trace_PutU16(uint8 *pWrite, uint16 usValue)
+{
+    pWrite[0] = (uint8)(usValue);
+    pWrite[1] = (uint8)(usValue >> 8);
+    return pWrite + 2;
+}
+
+static uint8 *Trace_PutU32(uint8 *pWrite, uint32 ulValue)
+{
+    pWrite[0] = (uint8)(ulValue);
+    pWrite[1] = (uint8)(ulValue >> 8);
+    pWrite[2] = (uint8)(ulValue >> 16);
+    pWrite[3] = (uint8)(ulValue >> 24);
+    return pWrite + 4;
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void Trace_Init(void)
+{
+    uint32 ulStart;
+    uint32 ulEnd;
+    uint32 ulRecord;
+
+    /* The timed records land in the ring and are discarded with it. Task creation left the
+     * kernel-aware interrupts masked until the scheduler starts, nothing records meanwhile */
+    Trace_Head = 0;
+    Trace_Count = 0;
+    ulStart = GPTM_WTimer0Read();
+    for (ulRecord = 0; ulRecord < TRACE_COST_SAMPLES; ulRecord++)
+    {
+        Trace_Record(TRACE_EVENT_TASK_READY, 0U, 0U);
+    }
+    ulEnd = GPTM_WTimer0Read();
+    Trace_RecordCost = (uint16)(((ulEnd - ulStart) + (TRACE_COST_SAMPLES / 2U)) / TRACE_COST_SAMPLES);
+    Trace_Head = 0;
+    Trace_Count = 0;
+    Trace_Dropped = 0;
+    Trace_Sequence = 0;
+}
+
+void Trace_Record(uint8 ucEvent, uint8 ucTask, uint16 usArgument)
+{
+    UBaseType_t uxSavedMask = portSET_INTERRUPT_MASK_FROM_ISR();
+    Trace_EventType *pEvent;
+
+    if (Trace_Count < TRACE_BUFFER_EVENTS)
+    {
+        pEvent = &Trace_Buffer[Trace_Head];
+        pEvent->ulTimestamp = GPTM_WTimer0Read();
+        pEvent->ucEvent = ucEvent;
+        pEvent->ucTask = ucTask;
+        pEvent->usArgument = usArgument;
+        Trace_Head = (Trace_Head + 1U) & (TRACE_BUFFER_EVENTS - 1U);
+        Trace_Count++;
+    }
+    else
+    {
+        /* Keep the older events, the gap is reported by the dropped count */
+        Trace_Dropped++;
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(uxSavedMask);
+}
+
+void Trace_TaskCreated(uint32 ulTask, const char *pcName)
+{
+    if (ulTask < TRACE_MAX_TASKS)
+    {
+        Trace_TaskNames[ulTask] = pcName;
+    }
+}
+
+void Trace_IsrEnter(void)
+{
+    Trace_Record(TRACE_EVENT_ISR_ENTER, 0U, (uint16)(NVIC_SYSTEM_INTCTRL & TRACE_VECTACTIVE_MASK));
+}
+
+void Trace_IsrExit(void)
+{
+    Trace_Record(TRACE_EVENT_ISR_EXIT, 0U, (uint16)(NVIC_SYSTEM_INTCTRL & TRACE_VECTACTIVE_MASK));
+}
+
+uint32 Trace_GetPending(void)
+{
+    return Trace_Count;
+}
+
+uint16 Trace_EncodeEvents(uint8 *pFrame)
+{
+    /* Room for the CRC behind the payload */
+    uint8 aPayload[TRACE_EVENTS_PAYLOAD_SIZE + TELEMETRY_CRC_SIZE];
+    Trace_EventType aEvents[TRACE_EVENTS_PER_FRAME];
+    uint8 *pWrite = aPayload;
+    uint32 ulDropped;
+    uint32 ulTail;
+    uint8 ucCount = 0;
+    uint8 ucEvent;
+
+    /* Copy the oldest events out, the hooks keep recording meanwhile */
+    taskENTER_CRITICAL();
+    ulTail = (Trace_Head - Trace_Count) & (TRACE_BUFFER_EVENTS - 1U);
+    while ((ucCount < TRACE_EVENTS_PER_FRAME) && (ucCount < Trace_Count))
+    {
+        aEvents[ucCount++] = Trace_Buffer[ulTail];
+        ulTail = (ulTail + 1U) & (TRACE_BUFFER_EVENTS - 1U);
+    }
+    Trace_Count -= ucCount;
+    ulDropped = Trace_Dropped;
+    taskEXIT_CRITICAL();
+
+    if (0U == ucCount)
+    {
+        return 0U;
+    }
+
+    *pWrite++ = TRACE_FRAME_EVENTS;
+    pWrite = Trace_PutU16(pWrite, Trace_Sequence++);
+    pWrite = Trace_PutU32(pWrite, ulDropped);
+    *pWrite++ = ucCount;
+    for (ucEvent = 0; ucEvent < ucCount; ucEvent++)
+    {
+        pWrite = Trace_PutU32(pWrite, aEvents[ucEvent].ulTimestamp);
+        *pWrite++ = aEvents[ucEvent].ucEvent;
+        *pWrite++ = aEvents[ucEvent].ucTask;
+        pWrite = Trace_PutU16(pWrite, aEvents[ucEvent].usArgument);
+    }
+
+    return Telemetry_EncodeFrame(aPayload, (uint16)(pWrite - aPayload), pFrame);
+}
+
+uint16 Trace_EncodeNames(uint8 *pFrame)
+{
+    uint8 aPayload[TRACE_NAMES_PAYLOAD_SIZE + TELEMETRY_CRC_SIZE];
+    uint8 *pWrite = aPayload;
+    uint8 *pCount;
+    uint8 *pLength;
+    const char *pcName;
+    uint8 ucTask;
+
+    *pWrite++ = TRACE_FRAME_NAMES;
+    pWrite = Trace_PutU32(pWrite, TIMEBASE_TICKS_PER_SECOND);
+    pWrite = Trace_PutU16(pWrite, Trace_RecordCost);
+    pCount = pWrite++;
+    *pCount = 0;
+
+    for (ucTask = 0; ucTask < TRACE_MAX_TASKS; ucTask++)
+    {
+        pcName = Trace_TaskNames[ucTask];
+        if (NULL_PTR != pcName)
+        {
+            *pWrite++ = ucTask;
+            pLength = pWrite++;
+            *pLength = 0;
+            while ((*pLength < TRACE_MAX_NAME_LENGTH) && ('\0' != pcName[*pLength]))
+            {
+                *pWrite++ = (uint8)pcName[(*pLength)++];
+            }
+            (*pCount)++;
+        }
+    }
+
+    return Telemetry_EncodeFrame(aPayload, (uint16)(pWrite - aPayload), pFrame);
+}
+
+#endif /* TRACE_OUTPUT */
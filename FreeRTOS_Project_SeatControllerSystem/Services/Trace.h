@@ -0,0 +1,142 @@
+/******************************************************************************
+ *
+ * Module: Trace
+ *
+ * File Name: Trace.h
+ *
+ * Description: Header file for the binary kernel event trace recorder.
+ *              The trace macros in FreeRTOSConfig.h and the MCAL interrupt
+ *              handlers (MCAL_ISR_ENTER/EXIT in hw_access.h) record context
+ *              switches, tasks made ready, delays, task notifications, event
+ *              group set/wait and interrupt entry/exit into a RAM ring (not
+ *              of WTimer0A, its priority 0 is above the BASEPRI mask that
+ *              guards the ring). Every
+ *              event is 8 bytes with the low 32 bits of the Timebase as its
+ *              timestamp (62.5 ns at 16 MHz, wraps every 268 s).
+ *              A full ring drops the newest events and counts them. The ring
+ *              is drained by a task into CRC-protected, COBS-framed binary
+ *              frames (the telemetry framing), Tools/trace2chrome.c turns a
+ *              capture into Chrome trace JSON for chrome://tracing or Perfetto.
+ *
+ *              Cost: Trace_Init times TRACE_COST_SAMPLES back-to-back records
+ *              and reports the average in the names frame, trace2chrome prints
+ *              it. A hook adds its call and argument loads on top of that.
+ *
+ *              Bandwidth: at UART0_BAUD_RATE 9600 one 8-byte event takes about
+ *              9 ms of line time, the stream sustains roughly 100 events/s.
+ *              Bursts are absorbed by the ring, a sustained higher rate shows
+ *              up as dropped events.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                              Configurations                                 *
+ *******************************************************************************/
+/* STD_ON installs the kernel hooks and replaces the UART0 dashboard with the trace stream.
+ * MCAL_ISR_TRACE in hw_access.h must match, TELEMETRY_OUTPUT must be STD_OFF */
+#define TRACE_OUTPUT                  STD_OFF
+
+/* Events held in RAM, a power of two */
+#define TRACE_BUFFER_EVENTS           (256U)
+
+/* Tasks named in the names frame, indexed by their kernel TCB number */
+#define TRACE_MAX_TASKS               (12U)
+
+/* Longest task name sent, checked against configMAX_TASK_NAME_LEN in Trace.c */
+#define TRACE_MAX_NAME_LENGTH         (16U)
+
+/* Events sent in one frame, a full frame is 200 bytes of payload */
+#define TRACE_EVENTS_PER_FRAME        (24U)
+
+/* Drain period of the stream task and the number of drains between two names frames */
+#define TRACE_STREAM_PERIOD_MS        (250U)
+#define TRACE_NAMES_PERIOD            (40U)
+
+/* Records timed by Trace_Init to measure the cost of one event */
+#define TRACE_COST_SAMPLES            (64U)
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+/* Frame types, the first payload byte. Events frame: type, u16 sequence, u32 dropped events,
+ * u8 count, then count * {u32 timestamp, u8 event, u8 task, u16 argument}. Names frame: type,
+ * u32 Timebase ticks per second, u16 record cost in ticks, u8 count, then count * {u8 task,
+ * u8 length, name}. Multi-byte fields are little-endian */
+#define TRACE_FRAME_EVENTS            (0x81U)
+#define TRACE_FRAME_NAMES             (0x82U)
+
+#define TRACE_EVENT_SIZE              (8U)
+#define TRACE_EVENTS_HEADER_SIZE      (8U)
+#define TRACE_NAMES_HEADER_SIZE       (8U)
+#define TRACE_EVENTS_PAYLOAD_SIZE     (TRACE_EVENTS_HEADER_SIZE + (TRACE_EVENTS_PER_FRAME * TRACE_EVENT_SIZE))
+#define TRACE_NAMES_PAYLOAD_SIZE      (TRACE_NAMES_HEADER_SIZE + (TRACE_MAX_TASKS * (2U + TRACE_MAX_NAME_LENGTH)))
+
+/* Event codes, the task field is the kernel TCB number of the task named below */
+#define TRACE_EVENT_TASK_SWITCHED_IN  (1U)   /* Task starts running, argument: its priority */
+#define TRACE_EVENT_TASK_READY        (2U)   /* Task made ready, argument: its priority */
+#define TRACE_EVENT_TASK_DELAY        (3U)   /* Running task delays, argument: kernel ticks */
+#define TRACE_EVENT_TASK_DELAY_UNTIL  (4U)   /* Running task blocks until a tick, argument: kernel ticks to it */
+#define TRACE_EVENT_NOTIFY            (5U)   /* Notified task, argument: notification index */
+#define TRACE_EVENT_NOTIFY_FROM_ISR   (6U)   /* Notified task, argument: notification index */
+#define TRACE_EVENT_NOTIFY_WAIT       (7U)   /* Running task blocks on a notification, argument: index */
+#define TRACE_EVENT_GROUP_SET_BITS    (8U)   /* Running task sets event group bits, argument: the bits */
+#define TRACE_EVENT_GROUP_WAIT_BITS   (9U)   /* Running task blocks on event group bits, argument: the bits */
+#define TRACE_EVENT_ISR_ENTER         (10U)  /* Task 0, argument: exception number (IRQ + 16) */
+#define TRACE_EVENT_ISR_EXIT          (11U)  /* Task 0, argument: exception number (IRQ + 16) */
+
+/* Kernel hooks record through this macro, it compiles away with TRACE_OUTPUT STD_OFF */
+#if (TRACE_OUTPUT == STD_ON)
+#define TRACE_RECORD(Event, Task, Argument) \
+    Trace_Record((uint8)(Event), (uint8)(Task), (uint16)(Argument))
+#else
+#define TRACE_RECORD(Event, Task, Argument)
+#endif
+
+/* 32-bit hook arguments saturated to the 16-bit argument field */
+#define TRACE_SATURATE(Value)         (((Value) > 0xFFFFUL) ? 0xFFFFU : (uint16)(Value))
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+typedef struct
+{
+    uint32 ulTimestamp;                 /* Low 32 bits of the Timebase */
+    uint8 ucEvent;
+    uint8 ucTask;
+    uint16 usArgument;
+} Trace_EventType;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/* Measure the record cost and empty the ring, after Timebase_Init and before the scheduler starts */
+void Trace_Init(void);
+
+/* Append one event, from the kernel hooks, any task or interrupt */
+void Trace_Record(uint8 ucEvent, uint8 ucTask, uint16 usArgument);
+
+/* Remember the name of a new task for the names frame, from traceTASK_CREATE */
+void Trace_TaskCreated(uint32 ulTask, const char *pcName);
+
+/* Interrupt entry and exit, from MCAL_ISR_ENTER/EXIT */
+void Trace_IsrEnter(void);
+void Trace_IsrExit(void);
+
+/* Events waiting in the ring, from a task */
+uint32 Trace_GetPending(void);
+
+/* Move up to TRACE_EVENTS_PER_FRAME events into one events frame (TELEMETRY_FRAME_SIZE(TRACE_EVENTS_PAYLOAD_SIZE)
+ * bytes), from the stream task. Returns the frame length, 0 when the ring is empty */
+uint16 Trace_EncodeEvents(uint8 *pFrame);
+
+/* Frame the task names, the timestamp rate and the record cost (TELEMETRY_FRAME_SIZE(TRACE_NAMES_PAYLOAD_SIZE)
+ * bytes), from the stream task. Returns the frame length */
+uint16 Trace_EncodeNames(uint8 *pFrame);
+
+#endif /* TRACE_H */
@@ -13,116 +13,243 @@
    ensuring responsive user interaction and robust performance monitoring with GPTM.
  * Author: Mohamed Hassan
  ******************************************************************************/
-/* Include standard header files for ADC, FreeRTOS, tasks, event groups, etc. */
+/* Include standard header files for ADC, FreeRTOS, tasks, timers, etc. */
 #include "adc.h"
 #include "FreeRTOS.h"
 #include "task.h"
-#include "event_groups.h"
+#include "timers.h"
+#include "queue.h"
 #include "Port.h"
 #include "Dio.h"
 #include "uart0.h"
 #include "Button.h"
 #include "led.h"
 #include "GPTM.h"
+#include "Timebase.h"
+#include "CpuLoad.h"
+#include "JobStats.h"
+#include "StackMonitor.h"
+#include "HeapMonitor.h"
+#include "LowPower.h"
+#include "Eeprom.h"
+#include "FailureLog.h"
+#include "PWM.h"
+#include "Dashboard.h"
+#include "Telemetry.h"
+#include "Trace.h"
+#include "Debounce.h"
+#include "Signal.h"
+#include "Seat.h"
 #include "FreeRTOS_Project.h"
 
-/* Define initial heating levels for driver and passenger */
-HeatingLevel ucDriverHeaterIntensity = TURN_OFF_HEATER;       /* Initialize driver heater intensity */
-HeatingLevel ucPassengerHeaterIntensity = TURN_OFF_HEATER;    /* Initialize passenger heater intensity */
-
-/* Define desired temperature for driver and passenger seats */
-uint8 usDriver_Seat_Desired_Temp = SEAT_HEATING_OFF;          /* Initialize driver seat desired temperature */
-uint8 usPassenger_Seat_Desired_Temp= SEAT_HEATING_OFF;        /* Initialize passenger seat desired temperature */
-
-/* Define current temperature variables for driver and passenger seats */
-uint16 usDriverSeatCurrentTemp;                               /* Variable to hold driver seat current temperature */
-uint16 usPassengerSeatCurrentTemp;                            /* Variable to hold passenger seat current temperature */
-
-/* Define a structure to record failures */
-FailureRecord latestFailure[2];                               /* Array to hold latest failure records */
-
-/* Define a constant for delay iterations */
-#define NUMBER_OF_ITERATIONS_PER_ONE_MILI_SECOND 369          /* Define macro for delay iterations */
-
-/* Function to create a delay in milliseconds */
-void Delay_MS(unsigned long long n)                           /* Function to create delay */
-{
-    volatile unsigned long long count = 0;                    /* Volatile to prevent optimization */
-    while(count++ < (NUMBER_OF_ITERATIONS_PER_ONE_MILI_SECOND * n) ); /* Delay loop */
-}
-
-/* Structure to hold driver seat task information */
-TaskInformation DriverSeatTask =
-{
- /* Driver Task ID*/ DRIVER_TASK_ID,                          /* Task ID for driver seat */
- /* Driver Seat Button */  SW1_BUTTON_PIN_NUM_INDEX,          /* Button pin number for driver seat */
- /* Driver Seat Button Presses Count */ 0,                    /* Button presses count for driver seat */
- /* Driver Seat Heating Temp*/ SEAT_HEATING_OFF               /* Initial heating level for driver seat */
-};
-
-/* Structure to hold passenger seat task information */
-TaskInformation PassengerSeatTask =
-{
- /* Passenger Task ID*/ PASSENGER_TASK_ID,                    /* Task ID for passenger seat */
- /* Passenger Seat Button */  SW2_BUTTON_PIN_NUM_INDEX,       /* Button pin number for passenger seat */
- /* Passenger Seat Button Presses Count*/ 0,                  /* Button presses count for passenger seat */
- /* Passenger Seat Heating Temp*/ SEAT_HEATING_OFF            /* Initial heating level for passenger seat */
-};
+/* Run-time data of every seat, indexed like Seat_Configuration */
+Seat_StateType xSeats[NUMBER_OF_SEATS];                       /* Shared part is read with Seat_GetSnapshot, see Seat.h */
 
 /* Function prototypes */
 void prvSetupHardware(void);                                  /* Prototype for hardware setup function */
-void vSeatHeatingLevelTask(void *pvParameters);               /* Prototype for seat heating level task */
+void vSeatButtonTask(void *pvParameters);                     /* Prototype for seat button task */
+void vButtonEdgeCallback(uint8 ucButtonChannel);              /* Prototype for button edge interrupt callback */
+void vButtonScanCallback(TimerHandle_t xTimer);               /* Prototype for button scan timer callback */
 void vHeaterMonitorTask(void *pvParameters);                  /* Prototype for heater monitor task */
 void vHeaterControlTask(void *pvParameters);                  /* Prototype for heater control task */
 void vGetCurrentTempTask(void *pvParameters);                 /* Prototype for get current temperature task */
+void vAdcConversionCallback(const uint16 *pSamples);         /* Prototype for ADC completion callback */
+void vAdcBlockCallback(void);                                 /* Prototype for ADC sample block callback */
 void vDashboardDisplayTask(void *pvParameters);               /* Prototype for dashboard display task */
+void vTelemetryTask(void *pvParameters);                      /* Prototype for binary telemetry task */
+void vTraceStreamTask(void *pvParameters);                    /* Prototype for kernel trace stream task */
 void vFailureHandleTask(void *pvParameters);                  /* Prototype for failure handle task */
+void vFailureLogTask(void *pvParameters);                     /* Prototype for failure log task */
 void vRunTimeMeasurementsTask(void *pvParameters);            /* Prototype for runtime measurements task */
+void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer,
+                                   uint32_t *pulIdleTaskStackSize);   /* Prototype for idle task memory callback */
+void vApplicationGetTimerTaskMemory(StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer,
+                                    uint32_t *pulTimerTaskStackSize); /* Prototype for timer task memory callback */
+Timebase_TicksType prvGetTasksTotalTime(uint64 *pTimes);      /* Prototype for run time snapshot function */
 
 /* Task handles */
-TaskHandle_t xDriverSeatHeatingLevelTask;                     /* Task handle for driver seat heating level task */
-TaskHandle_t xPassengerSeatHeatingLevelTask;                  /* Task handle for passenger seat heating level task */
+TaskHandle_t xSeatButtonTask;                                 /* Task handle for seat button task */
 TaskHandle_t xHeaterMonitorTask;                              /* Task handle for heater monitor task */
 TaskHandle_t xHeaterControlTask;                              /* Task handle for heater control task */
 TaskHandle_t xGetCurrentTempTask;                             /* Task handle for get current temperature task */
 TaskHandle_t xDashboardDisplayTask;                           /* Task handle for dashboard display task */
 TaskHandle_t xFailureHandleTask;                              /* Task handle for failure handle task */
 TaskHandle_t xRunTimeMeasurementsTask;                        /* Task handle for runtime measurements task */
+TaskHandle_t xFailureLogTask;                                 /* Task handle for failure log task */
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Task control blocks and stacks, placed by the linker instead of the kernel heap */
+StaticTask_t xSeatButtonTaskBuffer;                           /* TCB of seat button task */
+StaticTask_t xGetCurrentTempTaskBuffer;                       /* TCB of get current temperature task */
+StaticTask_t xFailureHandleTaskBuffer;                        /* TCB of failure handle task */
+StaticTask_t xHeaterMonitorTaskBuffer;                        /* TCB of heater monitor task */
+StaticTask_t xHeaterControlTaskBuffer;                        /* TCB of heater control task */
+StaticTask_t xDashboardDisplayTaskBuffer;                     /* TCB of the dashboard, telemetry or trace stream task */
+StaticTask_t xRunTimeMeasurementsTaskBuffer;                  /* TCB of runtime measurements task */
+StaticTask_t xFailureLogTaskBuffer;                           /* TCB of failure log task */
+StaticTask_t xIdleTaskBuffer;                                 /* TCB of the kernel idle task */
+StaticTask_t xTimerTaskBuffer;                                /* TCB of the kernel timer service task */
+StackType_t xSeatButtonTaskStack[SEAT_BUTTON_TASK_STACK_SIZE];
+StackType_t xGetCurrentTempTaskStack[CURRENT_TEMP_TASK_STACK_SIZE];
+StackType_t xFailureHandleTaskStack[FAILURE_TASK_STACK_SIZE];
+StackType_t xHeaterMonitorTaskStack[HEATER_MONITOR_TASK_STACK_SIZE];
+StackType_t xHeaterControlTaskStack[HEATER_CONTROL_TASK_STACK_SIZE];
+StackType_t xDashboardDisplayTaskStack[DISPLAY_TASK_STACK_SIZE];
+StackType_t xRunTimeMeasurementsTaskStack[RUNTIME_TASK_STACK_SIZE];
+StackType_t xFailureLogTaskStack[FAILURE_LOG_TASK_STACK_SIZE];
+StackType_t xIdleTaskStack[configMINIMAL_STACK_SIZE];
+StackType_t xTimerTaskStack[configTIMER_TASK_STACK_DEPTH];
+StaticTimer_t xButtonScanTimerBuffer;                         /* Button scan timer, the timer queue is static in timers.c */
+StaticQueue_t xFailureLogQueueBuffer;                         /* Failure log queue */
+uint8 ucFailureLogQueueStorage[FAILURE_LOG_QUEUE_LENGTH * sizeof(FailureLog_RecordType)];
+
+/* Creates a task in its static buffers, named <Handle>Buffer and <Handle>Stack */
+#define CREATE_TASK(Function, Name, StackSize, Priority, Handle) \
+    ((Handle) = xTaskCreateStatic((Function), (Name), (StackSize), NULL, (Priority), Handle##Stack, &Handle##Buffer))
+#else
+/* Creates a task from the kernel heap */
+#define CREATE_TASK(Function, Name, StackSize, Priority, Handle) \
+    ((void)xTaskCreate((Function), (Name), (StackSize), NULL, (Priority), &(Handle)))
+#endif
 
 /* Variables to hold task times */
-uint32 ullTasksOutTime[9];                                    /* Array to hold tasks out time */
-uint32 ullTasksInTime[9];                                     /* Array to hold tasks in time */
-uint32 ullTasksTotalTime[9];                                  /* Array to hold tasks total time */
-uint8 ucCPU_Load=0;                                           /* Variable to hold CPU load */
+uint64 ullTasksOutTime[NUMBER_OF_TASK_TAGS];                  /* Array to hold tasks out time, Timebase ticks */
+uint64 ullTasksInTime[NUMBER_OF_TASK_TAGS];                   /* Array to hold tasks in time, Timebase ticks */
+uint64 ullTasksTotalTime[NUMBER_OF_TASK_TAGS];                /* Array to hold tasks total time, Timebase ticks */
+uint32 ulAdcSampleOverruns=0;                                 /* Scans dropped by the continuous ADC sampling */
+
+/* Button debouncing, only touched by vButtonScanCallback once the scheduler runs */
+Debounce_StateType xButtonDebounce;                           /* Every scanned button pin, one lane each */
+uint8 ucSeatButtonLanes[NUMBER_OF_SEATS];                     /* Debounce lane of the button of every seat */
+TimerHandle_t xButtonScanTimer;                               /* Auto-reload scan timer, runs while a button is busy */
+
+/* Every seat owns a press and a long press bit of the seat button task notification value */
+typedef char SeatButtonBitsFitNotification[(NUMBER_OF_SEATS <= SEAT_LONG_PRESS_SHIFT) ? 1 : -1];
+/* The scanned ports fit one Debounce engine and the long press fits its hold counter */
+typedef char ButtonScanFitsDebounce[(BUTTON_SCAN_WORDS <= DEBOUNCE_MAX_WORDS) ? 1 : -1];
+typedef char ButtonLongPressFitsDebounce[((BUTTON_LONG_PRESS_MS / BUTTON_SCAN_PERIOD_MS) <= 255U) ? 1 : -1];
+
+/* Sensor failures on their way to the EEPROM journal, only the failure log task touches the EEPROM */
+QueueHandle_t xFailureLogQueue;                               /* Records from vFailureHandleTask to vFailureLogTask */
+boolean bFailureLogReady = FALSE;                             /* EEPROM started and the journal found */
+uint32 ulFailureLogDrops = 0;                                 /* Records lost to a full queue */
+uint32 ulFailureLogWriteErrors = 0;                           /* Records the EEPROM did not store */
+
+/* The journal keeps the seat index in 4 bits */
+typedef char SeatsFitFailureLog[(NUMBER_OF_SEATS <= 16U) ? 1 : -1];
+
+/* Last completed ADC0 scan, written by the conversion interrupt before vGetCurrentTempTask is notified */
+uint16 usAdcScan[ADC0_NUMBER_OF_CHANNELS];                    /* One raw sample per scan step */
+
+/* WTimer0 counts the system clock down to Timebase ticks */
+typedef char TimebaseClockMatchesCpu[(TIMEBASE_CLOCK_HZ == configCPU_CLOCK_HZ) ? 1 : -1];
+
+/* The load windows are slid by the runtime measurements task, one slot per task tag */
+typedef char CpuLoadSamplesRunTime[(CPULOAD_SAMPLE_PERIOD_MS == RUNTIME_MEASUREMENTS_TASK_PERIODICITY) ? 1 : -1];
+typedef char CpuLoadTasksMatchTags[(CPULOAD_NUMBER_OF_TASKS == NUMBER_OF_TASK_TAGS) ? 1 : -1];
+typedef char JobStatsTasksMatchTags[(JOBSTATS_NUMBER_OF_TASKS == NUMBER_OF_TASK_TAGS) ? 1 : -1];
+typedef char CpuLoadWindowsMatchDashboard[(CPULOAD_NUMBER_OF_WINDOWS == DASHBOARD_NUMBER_OF_LOAD_WINDOWS) ? 1 : -1];
+
+/* The telemetry record carries one run time per task tag */
+typedef char TelemetryTaskTimesMatchTags[(TELEMETRY_NUMBER_OF_TASKS == NUMBER_OF_TASK_TAGS) ? 1 : -1];
+
+/* UART0 carries the dashboard, the telemetry or the trace stream */
+#if ((TRACE_OUTPUT == STD_ON) && (TELEMETRY_OUTPUT == STD_ON))
+#error "TRACE_OUTPUT and TELEMETRY_OUTPUT cannot both be STD_ON"
+#endif
 
-/* Event group handle */
-EventGroupHandle_t xSystemEventGroup;                         /* Handle for system event group */
+#if (TRACE_OUTPUT == STD_ON)
+/* Both trace frames are built here, the stream only queues a frame the UART0 transmit ring can take whole */
+uint8 ucTraceFrame[TELEMETRY_FRAME_SIZE(TRACE_NAMES_PAYLOAD_SIZE)];
+typedef char TraceEventsFrameFits[(TRACE_EVENTS_PAYLOAD_SIZE <= TRACE_NAMES_PAYLOAD_SIZE) ? 1 : -1];
+typedef char TraceFrameFitsUartRing[(TELEMETRY_FRAME_SIZE(TRACE_NAMES_PAYLOAD_SIZE) < UART0_TX_BUFFER_SIZE) ? 1 : -1];
+#endif
+
+#if (TELEMETRY_OUTPUT == STD_ON)
+/* One record frame per TELEMETRY_PERIOD_MS, 10 bit times per byte, must fit in the UART0 line rate */
+typedef char TelemetryRateFitsUartBaud[(((TELEMETRY_MAX_FRAME_SIZE * 10UL * 1000UL) / TELEMETRY_PERIOD_MS) <= UART0_BAUD_RATE) ? 1 : -1];
+#endif
 
 /* Main function */
 void main(void)
 {
+    const PidController_ConfigType xPidConfig = HEATER_PID_CONFIG;
+    uint8 ucSeat;
+
     prvSetupHardware();                                       /* Setup hardware */
-    xSystemEventGroup = xEventGroupCreate();                  /* Create event group */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xButtonScanTimer = xTimerCreateStatic("ButtonScan", pdMS_TO_TICKS(BUTTON_SCAN_PERIOD_MS), pdTRUE, NULL,
+                                          vButtonScanCallback, &xButtonScanTimerBuffer); /* Create button scan timer */
+#else
+    xButtonScanTimer = xTimerCreate("ButtonScan", pdMS_TO_TICKS(BUTTON_SCAN_PERIOD_MS), pdTRUE, NULL,
+                                    vButtonScanCallback);     /* Create button scan timer */
+#endif
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xFailureLogQueue = xQueueCreateStatic(FAILURE_LOG_QUEUE_LENGTH, sizeof(FailureLog_RecordType),
+                                          ucFailureLogQueueStorage, &xFailureLogQueueBuffer); /* Create failure log queue */
+#else
+    xFailureLogQueue = xQueueCreate(FAILURE_LOG_QUEUE_LENGTH, sizeof(FailureLog_RecordType)); /* Create failure log queue */
+#endif
+    Debounce_Init(&xButtonDebounce, BUTTON_SCAN_WORDS, (uint8)(BUTTON_LONG_PRESS_MS / BUTTON_SCAN_PERIOD_MS));
+
+    for (ucSeat = 0; ucSeat < NUMBER_OF_SEATS; ucSeat++)
+    {
+        Seat_Init(&Seat_Configuration[ucSeat], &xSeats[ucSeat], &xPidConfig); /* Heating off, filter and PID reset */
+        ucSeatButtonLanes[ucSeat] = buttonGetLane(Seat_Configuration[ucSeat].ButtonChannel);
+    }
 
     /* Create tasks with appropriate parameters and priorities */
-    xTaskCreate(vSeatHeatingLevelTask, "DriverSeatHeatingLevelTask", 150, (void*)&DriverSeatTask, 4, &xDriverSeatHeatingLevelTask);
-    xTaskCreate(vSeatHeatingLevelTask, "PassengerSeatHeatingLevelTask", 150, (void*)&PassengerSeatTask, 4, &xPassengerSeatHeatingLevelTask);
-    xTaskCreate(vGetCurrentTempTask, "GetCurrentTempTask", 150, NULL, 3, &xGetCurrentTempTask);
-    xTaskCreate(vFailureHandleTask, "Failure", 150, NULL, 1, &xFailureHandleTask);
-    xTaskCreate(vHeaterMonitorTask, "HeaterMonitorTask", 256, NULL, 2, &xHeaterMonitorTask);
-    xTaskCreate(vHeaterControlTask, "HeaterControlTask", 100, NULL, 1, &xHeaterControlTask);
-    xTaskCreate(vDashboardDisplayTask, "DashboardDisplayTask", 150, NULL, 1, &xDashboardDisplayTask);
-    xTaskCreate(vRunTimeMeasurementsTask, "RunTimeMeasurementsTask", 256, NULL, 1, &xRunTimeMeasurementsTask);
+    CREATE_TASK(vSeatButtonTask, "SeatButtonTask", SEAT_BUTTON_TASK_STACK_SIZE, 4, xSeatButtonTask);
+    CREATE_TASK(vGetCurrentTempTask, "GetCurrentTempTask", CURRENT_TEMP_TASK_STACK_SIZE, 3, xGetCurrentTempTask);
+    CREATE_TASK(vFailureHandleTask, "Failure", FAILURE_TASK_STACK_SIZE, 1, xFailureHandleTask);
+    CREATE_TASK(vHeaterMonitorTask, "HeaterMonitorTask", HEATER_MONITOR_TASK_STACK_SIZE, 2, xHeaterMonitorTask);
+    CREATE_TASK(vHeaterControlTask, "HeaterControlTask", HEATER_CONTROL_TASK_STACK_SIZE, 1, xHeaterControlTask);
+#if (TELEMETRY_OUTPUT == STD_ON)
+    CREATE_TASK(vTelemetryTask, "TelemetryTask", DISPLAY_TASK_STACK_SIZE, 1, xDashboardDisplayTask);
+#elif (TRACE_OUTPUT == STD_ON)
+    CREATE_TASK(vTraceStreamTask, "TraceStreamTask", DISPLAY_TASK_STACK_SIZE, 1, xDashboardDisplayTask);
+#else
+    CREATE_TASK(vDashboardDisplayTask, "DashboardDisplayTask", DISPLAY_TASK_STACK_SIZE, 1, xDashboardDisplayTask);
+#endif
+    CREATE_TASK(vRunTimeMeasurementsTask, "RunTimeMeasurementsTask", RUNTIME_TASK_STACK_SIZE, 4, xRunTimeMeasurementsTask); /* Samples on time under load */
+    CREATE_TASK(vFailureLogTask, "FailureLogTask", FAILURE_LOG_TASK_STACK_SIZE, 1, xFailureLogTask); /* Waits for the EEPROM */
 
     /* Set application task tags for runtime statistics */
-    vTaskSetApplicationTaskTag(xDriverSeatHeatingLevelTask, (void *) 1);
-    vTaskSetApplicationTaskTag(xPassengerSeatHeatingLevelTask, (void *) 2);
-    vTaskSetApplicationTaskTag(xGetCurrentTempTask, (void *) 3);
-    vTaskSetApplicationTaskTag(xFailureHandleTask, (void *) 4);
-    vTaskSetApplicationTaskTag(xHeaterMonitorTask, (void *) 5);
-    vTaskSetApplicationTaskTag(xHeaterControlTask, (void *) 6);
-    vTaskSetApplicationTaskTag(xDashboardDisplayTask, (void *) 7);
-    vTaskSetApplicationTaskTag(xRunTimeMeasurementsTask, (void *) 8);
+    vTaskSetApplicationTaskTag(xSeatButtonTask, (void *)(portPOINTER_SIZE_TYPE) SEAT_BUTTON_TASK_TAG);
+    vTaskSetApplicationTaskTag(xGetCurrentTempTask, (void *)(portPOINTER_SIZE_TYPE) CURRENT_TEMP_TASK_TAG);
+    vTaskSetApplicationTaskTag(xFailureHandleTask, (void *)(portPOINTER_SIZE_TYPE) FAILURE_TASK_TAG);
+    vTaskSetApplicationTaskTag(xHeaterMonitorTask, (void *)(portPOINTER_SIZE_TYPE) HEATER_MONITOR_TASK_TAG);
+    vTaskSetApplicationTaskTag(xHeaterControlTask, (void *)(portPOINTER_SIZE_TYPE) HEATER_CONTROL_TASK_TAG);
+    vTaskSetApplicationTaskTag(xDashboardDisplayTask, (void *)(portPOINTER_SIZE_TYPE) DISPLAY_TASK_TAG);
+    vTaskSetApplicationTaskTag(xRunTimeMeasurementsTask, (void *)(portPOINTER_SIZE_TYPE) RUNTIME_TASK_TAG);
+    vTaskSetApplicationTaskTag(xFailureLogTask, (void *)(portPOINTER_SIZE_TYPE) FAILURE_TASK_TAG);
+
+    /* Watch the stack use of every task, the kernel tasks are added once the scheduler runs */
+    StackMonitor_Register(xSeatButtonTask, SEAT_BUTTON_TASK_STACK_SIZE);
+    StackMonitor_Register(xGetCurrentTempTask, CURRENT_TEMP_TASK_STACK_SIZE);
+    StackMonitor_Register(xFailureHandleTask, FAILURE_TASK_STACK_SIZE);
+    StackMonitor_Register(xHeaterMonitorTask, HEATER_MONITOR_TASK_STACK_SIZE);
+    StackMonitor_Register(xHeaterControlTask, HEATER_CONTROL_TASK_STACK_SIZE);
+    StackMonitor_Register(xDashboardDisplayTask, DISPLAY_TASK_STACK_SIZE);
+    StackMonitor_Register(xRunTimeMeasurementsTask, RUNTIME_TASK_STACK_SIZE);
+    StackMonitor_Register(xFailureLogTask, FAILURE_LOG_TASK_STACK_SIZE);
+
+    /* Every consumer gets its own copy of the signals it needs (see Signal.h) */
+    Signal_Subscribe(SIGNAL_SETPOINT_CHANGED, xHeaterMonitorTask);
+    Signal_Subscribe(SIGNAL_TEMPERATURE_UPDATED, xFailureHandleTask);
+    Signal_Subscribe(SIGNAL_HEATER_UPDATED, xHeaterControlTask);
+#if ((TELEMETRY_OUTPUT == STD_OFF) && (TRACE_OUTPUT == STD_OFF))
+    Signal_Subscribe(SIGNAL_HEATER_UPDATED, xDashboardDisplayTask);
+#endif
+
+    /* First scans pick up a button held at power up, then arm the edge interrupts */
+    xTimerStart(xButtonScanTimer, 0);
+
+    /* Drop the jobs released by the task creation, the first ones start with the scheduler */
+    JobStats_Reset();
+#if (TRACE_OUTPUT == STD_ON)
+    Trace_Init();                       /* Times the record cost and drops the events of the task creation */
+#endif
 
     /* Start the scheduler */
     vTaskStartScheduler();
@@ -145,72 +272,160 @@ Parameters (in):        None
 Parameters (inout):     None
 Parameters (out):       None
 Return value:           None
-Description:            Initializes hardware components including Port, Dio, UART0, ADC0, ADC1, and GPTM_WTimer0.
+Description:            Initializes hardware components including Port, Dio, the button edge interrupts, UART0, ADC0,
+                        the WTimer0 timebase, the WTimer1 tickless idle wake timer, the heater PWM and the
+                        EEPROM failure journal.
  ************************************************************************************/
 void prvSetupHardware(void)
 {
     Port_Init(&Port_Configuration);     /* Initialize Port Driver module */
     Dio_Init(&Dio_Configuration);       /* Initialize Dio Driver module */
     UART0_Init();                       /* Initialize UART0 */
-    ADC0_Init();                        /* Initialize ADC0 */
-    ADC1_Init();                        /* Initialize ADC1 */
-    GPTM_WTimer0Init();                 /* Initialize General Purpose Timer Module WTimer0 */
+    ADC0_Init();                        /* Initialize ADC0, one sequencer scans every seat sensor */
+    ADC0_SetCallback(vAdcConversionCallback); /* Deliver completed scans to vGetCurrentTempTask */
+    buttonInitEdgeInterrupts(vButtonEdgeCallback); /* Seat buttons interrupt on both edges, armed by vButtonScanCallback */
+    TempConv_Init();                    /* Load the default sensor calibration */
+    Timebase_Init();                    /* Start the 64-bit timestamps on WTimer0 */
+    LowPower_Init();                    /* Tickless idle wakes on WTimer1 */
+    PWM_Init();                         /* Start the heater PWM outputs at 0% duty */
+    if (E_OK == Eeprom_Init())          /* Complete an EEPROM write the last reset cut short */
+    {
+        FailureLog_Init();              /* Find the newest record of the failure journal */
+        bFailureLogReady = TRUE;
+    }
 }
 
 /************************************************************************************
-Service name:           vSeatHeatingLevelTask
-void                    vSeatHeatingLevelTask(void *pvParameters)
-Syntax:                 void vSeatHeatingLevelTask(void *pvParameters)
+Service name:           vSeatButtonTask
+void                    vSeatButtonTask(void *pvParameters)
+Syntax:                 void vSeatButtonTask(void *pvParameters)
 Service ID[hex]:        N/A
 Sync/Async:             Asynchronous
-Reentrancy:             Reentrant for different tasks
-Parameters (in):        pvParameters - Pointer to TaskInformation structure
+Reentrancy:             Non Reentrant
+Parameters (in):        pvParameters - Pointer to task parameters (not used)
 Parameters (inout):     None
 Parameters (out):       None
 Return value:           None
 Description:            Task to manage seat heating levels based on button presses.
-                        Handles button presses, updates desired temperatures, and communicates
-                        with UART0 if necessary. Monitors a specific seat identified by TaskInformation.
+                        Sleeps until vButtonScanCallback reports debounced button events.
+                        A press moves that seat to its next desired temperature (OFF, LOW,
+                        MEDIUM, HIGH), a long press switches it off; SIGNAL_SETPOINT_CHANGED
+                        wakes the heater monitor.
  ************************************************************************************/
-void vSeatHeatingLevelTask(void *pvParameters)
+void vSeatButtonTask(void *pvParameters)
 {
-    uint8 Button_flag = 0;  /* Variable to track button press state */
-    uint8 SeatsRequiredTemperatures[4] = {SEAT_HEATING_OFF, LOW_SEAT_HEATING_TEMPERATURE, MEDIUM_SEAT_HEATING_TEMPERATURE, HIGH_SEAT_HEATING_TEMPERATURE}; /* Array defining heating levels */
-    TaskInformation *pTaskInformation = (TaskInformation *)pvParameters; /* Cast pvParameters to TaskInformation pointer */
+    uint32_t ulEvents;                                        /* Notification value, see SEAT_LONG_PRESS_SHIFT */
+    boolean bChanged;
+    uint8 ucSeat;
+
+    /* The button scans run in the timer service task, account them to the buttons */
+    vTaskSetApplicationTaskTag(xTimerGetTimerDaemonTaskHandle(), (void *)(portPOINTER_SIZE_TYPE) SEAT_BUTTON_TASK_TAG);
 
     for (;;)
     {
-        if (buttonCheckState(pTaskInformation->ucSeatButton) == BUTTON_PRESSED) /* Check if button is pressed */
+        xTaskNotifyWait(0, 0xFFFFFFFFUL, &ulEvents, portMAX_DELAY); /* Wait for button events */
+
+        bChanged = FALSE;
+        for (ucSeat = 0; ucSeat < NUMBER_OF_SEATS; ucSeat++)
         {
-            if (Button_flag == 0) /* Check if button flag is not set */
+            if ((0U != (ulEvents & (1UL << ucSeat))) && (TRUE == Seat_HandlePress(&xSeats[ucSeat])))
             {
-                pTaskInformation->ucSeatButtonPressesCount += 1; /* Increment button press count */
-                if ((pTaskInformation->ucSeatButtonPressesCount) == 4) /* Check if button press count reaches maximum */
-                {
-                    pTaskInformation->ucSeatButtonPressesCount = 0; /* Reset button press count */
-                }
-                pTaskInformation->ucSeatHeatingTemp = SeatsRequiredTemperatures[pTaskInformation->ucSeatButtonPressesCount]; /* Update desired temperature */
+                bChanged = TRUE; /* Desired temperature of this seat changed */
+            }
+            if ((0U != (ulEvents & (1UL << (SEAT_LONG_PRESS_SHIFT + ucSeat)))) && (TRUE == Seat_HandleLongPress(&xSeats[ucSeat])))
+            {
+                bChanged = TRUE; /* Seat switched off */
+            }
+        }
+        if (TRUE == bChanged)
+        {
+            Signal_Publish(SIGNAL_SETPOINT_CHANGED); /* Run the heater monitor now */
+        }
+    }
+}
 
-                if (pTaskInformation->ucTaskID == PASSENGER_TASK_ID) /* Check if task is for passenger */
-                {
-                    usPassenger_Seat_Desired_Temp = pTaskInformation->ucSeatHeatingTemp; /* Update passenger seat desired temperature */
-                    // UART0_SendInteger(usPassenger_Seat_Desired_Temp); /* Example: Send temperature via UART0 */
-                }
-                else
-                {
-                    usDriver_Seat_Desired_Temp = pTaskInformation->ucSeatHeatingTemp; /* Update driver seat desired temperature */
-                    // UART0_SendInteger(usDriver_Seat_Desired_Temp); /* Example: Send temperature via UART0 */
-                    // UART0_SendString("Driver ^^\r\n"); /* Example: Send debug message via UART0 */
-                }
-                Button_flag = 1; /* Set button flag indicating button was pressed */
-                xEventGroupSetBits(xSystemEventGroup, SEAT_MONITOR_TASK_BIT); /* Set event bit for seat monitor task */
+/************************************************************************************
+Service name:           vButtonEdgeCallback
+Syntax:                 void vButtonEdgeCallback(uint8 ucButtonChannel)
+Service ID[hex]:        N/A
+Sync/Async:             Synchronous
+Reentrancy:             Non Reentrant
+Parameters (in):        ucButtonChannel - Dio channel of the button that saw an edge (not used)
+Parameters (inout):     None
+Parameters (out):       None
+Return value:           None
+Description:            Runs in the GPIO Port F interrupt. The button stays masked while it bounces
+                        and the button scans are (re)started.
+ ************************************************************************************/
+void vButtonEdgeCallback(uint8 ucButtonChannel)
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    xTimerStartFromISR(xButtonScanTimer, &xHigherPriorityTaskWoken);
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+/************************************************************************************
+Service name:           vButtonScanCallback
+Syntax:                 void vButtonScanCallback(TimerHandle_t xTimer)
+Service ID[hex]:        N/A
+Sync/Async:             Synchronous
+Reentrancy:             Non Reentrant
+Parameters (in):        xTimer - The button scan timer
+Parameters (inout):     None
+Parameters (out):       None
+Return value:           None
+Description:            Runs in the timer service task every BUTTON_SCAN_PERIOD_MS while a button
+                        is busy. Reads every scanned port with one Dio_ReadPort and debounces all
+                        button pins at once, then hands the press and long press events of the
+                        seats to vSeatButtonTask. Once nothing is left to debounce or time, the
+                        scans stop and the edge interrupts are re-armed. The pins are read again
+                        after re-arming, so a change in between keeps the scans going.
+ ************************************************************************************/
+void vButtonScanCallback(TimerHandle_t xTimer)
+{
+    uint32 aulInputs[BUTTON_SCAN_WORDS];
+    Debounce_EventsType xEvents;
+    uint32 ulNotify = 0;
+    uint8 ucLane;
+    uint8 ucSeat;
+
+    buttonReadInputs(aulInputs);
+    Debounce_Scan(&xButtonDebounce, aulInputs, &xEvents);
+
+    for (ucSeat = 0; ucSeat < NUMBER_OF_SEATS; ucSeat++)
+    {
+        ucLane = ucSeatButtonLanes[ucSeat];
+        if (BUTTON_NO_LANE != ucLane)
+        {
+            if (0U != (xEvents.aulPressed[DEBOUNCE_LANE_WORD(ucLane)] & DEBOUNCE_LANE_MASK(ucLane)))
+            {
+                ulNotify |= (1UL << ucSeat);
+            }
+            if (0U != (xEvents.aulLongPressed[DEBOUNCE_LANE_WORD(ucLane)] & DEBOUNCE_LANE_MASK(ucLane)))
+            {
+                ulNotify |= (1UL << (SEAT_LONG_PRESS_SHIFT + ucSeat));
             }
         }
-        else
+    }
+    if (0U != ulNotify)
+    {
+        xTaskNotify(xSeatButtonTask, ulNotify, eSetBits);
+    }
+
+    if (TRUE == Debounce_IsIdle(&xButtonDebounce, aulInputs))
+    {
+        /* Stopped before re-arming, so a start from an edge interrupt that follows is never undone */
+        xTimerStop(xTimer, 0);
+        for (ucSeat = 0; ucSeat < NUMBER_OF_SEATS; ucSeat++)
         {
-            Button_flag = 0; /* Reset button flag indicating button is not pressed */
+            buttonEnableEdgeInterrupt(Seat_Configuration[ucSeat].ButtonChannel);
+        }
+        buttonReadInputs(aulInputs);
+        if (FALSE == Debounce_IsIdle(&xButtonDebounce, aulInputs))
+        {
+            xTimerStart(xTimer, 0);
         }
-        vTaskDelay(pdMS_TO_TICKS(200)); /* Delay task execution for 200 milliseconds */
     }
 }
 
@@ -226,19 +441,114 @@ Parameters (inout):     None
 Parameters (out):       None
 Return value:           None
 Description:            Task to read current temperatures from ADC channels.
-                        Calculates current temperatures for driver and passenger seats
-                        and updates global variables. Communicates temperature readings
-                        using UART0. Monitors ADC channels ADC0 and ADC1.
+                        By default it starts one ADC0 scan of every seat sensor each TEMP_SCAN_PERIOD_MS
+                        and blocks on its task notification until the conversion interrupt
+                        delivers the samples. With TEMP_CONTINUOUS_SAMPLING, Timer2A triggers
+                        the scans at TEMP_SAMPLE_RATE_HZ and the task drains them in blocks of
+                        TEMP_SAMPLE_BLOCK_SIZE, the last filtered sample of a block giving the
+                        temperature. Either way every raw sample goes through the SensorFilter
+                        chain of its seat (median spike rejection, then IIR, configured per seat
+                        in Seat_Configuration) before TempConversion turns it into the current
+                        temperature (0.1 C) of the seat. SIGNAL_TEMPERATURE_UPDATED then wakes the failure handling.
  ************************************************************************************/
 void vGetCurrentTempTask(void *pvParameters)
 {
+#if (TEMP_CONTINUOUS_SAMPLING == STD_ON)
+    uint16 aSamples[TEMP_SAMPLE_BLOCK_SIZE * ADC0_NUMBER_OF_CHANNELS];
+    uint16 usFiltered;
+    uint8 ucCounter;
+    uint8 ucSeat;
+
+    ADC0_StartContinuous(TEMP_SAMPLE_BLOCK_SIZE, vAdcBlockCallback);
+    GPTM_Timer2AStartAdcTrigger(configCPU_CLOCK_HZ / TEMP_SAMPLE_RATE_HZ);
+
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY); /* Wait for the ADC interrupt to signal a full block */
+
+        /* Drain whole blocks only, a partial block stays in the ring until it completes */
+        while (ADC0_GetSampleCount() >= TEMP_SAMPLE_BLOCK_SIZE)
+        {
+            ADC0_ReadSamples(aSamples, TEMP_SAMPLE_BLOCK_SIZE);
+            for (ucSeat = 0; ucSeat < NUMBER_OF_SEATS; ucSeat++)
+            {
+                usFiltered = 0;
+                for (ucCounter = 0; ucCounter < TEMP_SAMPLE_BLOCK_SIZE; ucCounter++)
+                {
+                    usFiltered = Seat_FilterSample(&xSeats[ucSeat], aSamples[(ucCounter * ADC0_NUMBER_OF_CHANNELS) + Seat_Configuration[ucSeat].ucAdcStep]);
+                }
+                Seat_SetTemperature(&Seat_Configuration[ucSeat], &xSeats[ucSeat], usFiltered); /* Calculate seat temperature */
+            }
+        }
+        ulAdcSampleOverruns = ADC0_GetOverrunCount();
+        Signal_Publish(SIGNAL_TEMPERATURE_UPDATED); /* New temperature of every seat */
+    }
+#else
+    uint8 ucSeat;
+
     for (;;)
     {
-        usDriverSeatCurrentTemp = (ADC0_ReadChannel() * MAX_VALID_TEMP) / ADC_FULL_SCALE_VALUE; /* Read and calculate driver seat temperature */
-        usPassengerSeatCurrentTemp = (ADC1_ReadChannel() * MAX_VALID_TEMP) / ADC_FULL_SCALE_VALUE; /* Read and calculate passenger seat temperature */
-        xEventGroupSetBits(xSystemEventGroup, SEAT_CURRENT_TEMP_TASK_BIT); /* Set event bit for current temperature task */
-        vTaskDelay(pdMS_TO_TICKS(500)); /* Delay task execution for 500 milliseconds */
+        ADC0_StartConversion(); /* Scan every seat sensor in a single sequence */
+        if (0 != ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ADC_CONVERSION_TIMEOUT_MS)))
+        {
+            for (ucSeat = 0; ucSeat < NUMBER_OF_SEATS; ucSeat++)
+            {
+                Seat_SetTemperature(&Seat_Configuration[ucSeat], &xSeats[ucSeat],
+                                    Seat_FilterSample(&xSeats[ucSeat], usAdcScan[Seat_Configuration[ucSeat].ucAdcStep])); /* Calculate seat temperature */
+            }
+        }
+        Signal_Publish(SIGNAL_TEMPERATURE_UPDATED); /* New temperature of every seat */
+        vTaskDelay(pdMS_TO_TICKS(TEMP_SCAN_PERIOD_MS)); /* Delay task execution until the next scan */
+    }
+#endif
+}
+
+/************************************************************************************
+Service name:           vAdcConversionCallback
+Syntax:                 void vAdcConversionCallback(const uint16 *pSamples)
+Service ID[hex]:        N/A
+Sync/Async:             Synchronous
+Reentrancy:             Non Reentrant
+Parameters (in):        pSamples - One raw sample per ADC0 scan step
+Parameters (inout):     None
+Parameters (out):       None
+Return value:           None
+Description:            Runs in the ADC0 sequencer 0 interrupt. Copies the scan to usAdcScan and
+                        wakes vGetCurrentTempTask. The next scan is only started by that task, so
+                        the buffer is never written while it is being read.
+ ************************************************************************************/
+void vAdcConversionCallback(const uint16 *pSamples)
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    uint8 ucStep;
+
+    for (ucStep = 0; ucStep < ADC0_NUMBER_OF_CHANNELS; ucStep++)
+    {
+        usAdcScan[ucStep] = pSamples[ucStep];
     }
+    vTaskNotifyGiveFromISR(xGetCurrentTempTask, &xHigherPriorityTaskWoken);
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+/************************************************************************************
+Service name:           vAdcBlockCallback
+Syntax:                 void vAdcBlockCallback(void)
+Service ID[hex]:        N/A
+Sync/Async:             Synchronous
+Reentrancy:             Non Reentrant
+Parameters (in):        None
+Parameters (inout):     None
+Parameters (out):       None
+Return value:           None
+Description:            Runs in the ADC0 sequencer 0 interrupt in continuous sampling mode once
+                        TEMP_SAMPLE_BLOCK_SIZE scans are waiting, and wakes vGetCurrentTempTask.
+ ************************************************************************************/
+void vAdcBlockCallback(void)
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    vTaskNotifyGiveFromISR(xGetCurrentTempTask, &xHigherPriorityTaskWoken);
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 }
 
 /************************************************************************************
@@ -252,72 +562,38 @@ Parameters (in): pvParameters - Pointer to task parameters
 Parameters (inout): None
 Parameters (out): None
 Return value: None
-Description: Monitors seat heater temperatures and adjusts heater intensities based on desired and current temperatures for both driver and passenger seats.
+Description: Monitors seat heater temperatures and runs the PID controller of every seat each HEATER_CONTROL_PERIOD_MS,
+             with the latest current temperature. A SIGNAL_SETPOINT_CHANGED runs it at once and the period restarts from there.
+             The PID output is the heater duty cycle (0 .. 100 %), the heater intensity level follows it, and
+             SIGNAL_HEATER_UPDATED wakes the heater control and the dashboard.
  ************************************************************************************/
 void vHeaterMonitorTask(void *pvParameters)
 {
-    EventBits_t xEventGroupValue;
-    const EventBits_t xBitsToWaitFor = (SEAT_CURRENT_TEMP_TASK_BIT | SEAT_MONITOR_TASK_BIT);
+    const TickType_t xPeriod = pdMS_TO_TICKS(HEATER_CONTROL_PERIOD_MS); /* The PID gains assume this sample period */
+    TickType_t xLastRunTime;
+    TickType_t xElapsed;
+    uint8 ucSeat;
+
+    xLastRunTime = xTaskGetTickCount();
 
     for (;;)
     {
-        /* Block to wait for event bits to become set within the event group. */
-        xEventGroupValue = xEventGroupWaitBits(
-                xSystemEventGroup, /* The event group to read. */
-                xBitsToWaitFor,   /* Bits to test. */
-                pdTRUE,           /* Clear bits on exit if the unblock condition is met. */
-                pdFALSE,          /* Don't wait for all bits. */
-                portMAX_DELAY     /* Don't time out. */
-        );
-
-        if (((xEventGroupValue & SEAT_CURRENT_TEMP_TASK_BIT) != 0) || ((xEventGroupValue & SEAT_MONITOR_TASK_BIT) != 0))
+        xElapsed = xTaskGetTickCount() - xLastRunTime;
+        if (0U != Signal_Wait(SIGNAL_MASK(SIGNAL_SETPOINT_CHANGED), (xElapsed < xPeriod) ? (xPeriod - xElapsed) : 0U))
         {
-            if ((usDriver_Seat_Desired_Temp - usDriverSeatCurrentTemp) >= 10)
-            {
-                ucDriverHeaterIntensity = HIGH_HEATER_INTENSITY;
-            }
-            else if ((usDriver_Seat_Desired_Temp - usDriverSeatCurrentTemp) >= 5 && (usDriver_Seat_Desired_Temp - usDriverSeatCurrentTemp) < 10)
-            {
-                ucDriverHeaterIntensity = MEDIUM_HEATER_INTENSITY;
-            }
-            else if ((usDriver_Seat_Desired_Temp - usDriverSeatCurrentTemp) > 2 && (usDriver_Seat_Desired_Temp - usDriverSeatCurrentTemp) < 5)
-            {
-                ucDriverHeaterIntensity = LOW_HEATER_INTENSITY;
-            }
-            else if ((usDriverSeatCurrentTemp - usDriver_Seat_Desired_Temp) <= 3)
-            {
-                ucDriverHeaterIntensity = TURN_OFF_HEATER;
-            }
-            else
-            {
-                /* Nothing to do */
-            }
+            xLastRunTime = xTaskGetTickCount(); /* New setpoint */
+        }
+        else
+        {
+            xLastRunTime += xPeriod;            /* Period elapsed, no drift */
+        }
 
-            if ((usPassenger_Seat_Desired_Temp - usPassengerSeatCurrentTemp) >= 10)
-            {
-                ucPassengerHeaterIntensity = HIGH_HEATER_INTENSITY;
-            }
-            else if ((usPassenger_Seat_Desired_Temp - usPassengerSeatCurrentTemp) >= 5 && (usPassenger_Seat_Desired_Temp - usPassengerSeatCurrentTemp) < 10)
-            {
-                ucPassengerHeaterIntensity = MEDIUM_HEATER_INTENSITY;
-            }
-            else if ((usPassenger_Seat_Desired_Temp - usPassengerSeatCurrentTemp) > 2 && (usPassenger_Seat_Desired_Temp - usPassengerSeatCurrentTemp) < 5)
-            {
-                ucPassengerHeaterIntensity = LOW_HEATER_INTENSITY;
-            }
-            else if ((usPassengerSeatCurrentTemp - usPassenger_Seat_Desired_Temp) <= 3)
-            {
-                ucPassengerHeaterIntensity = TURN_OFF_HEATER;
-            }
-            else
-            {
-                /* Nothing to do */
-            }
+        for (ucSeat = 0; ucSeat < NUMBER_OF_SEATS; ucSeat++)
+        {
+            Seat_UpdateHeater(&xSeats[ucSeat]);
         }
 
-        xEventGroupSetBits(xSystemEventGroup, SEAT_HEATER_INTENSITY_TASK_BIT);
-        xEventGroupSetBits(xSystemEventGroup, SEAT_CURRENT_TEMP_TASK_BIT);
-        vTaskDelay(500);
+        Signal_Publish(SIGNAL_HEATER_UPDATED);
     }
 }
 
@@ -332,78 +608,220 @@ Parameters (in): pvParameters - Pointer to task parameters
 Parameters (inout): None
 Parameters (out): None
 Return value: None
-Description: Controls the activation of seat heaters based on the intensity levels calculated by the Heater Monitor task.
+Description: Controls the activation of seat heaters based on the intensity levels calculated by the Heater Monitor task,
+             on each SIGNAL_HEATER_UPDATED.
+             Each heater is driven by a hardware PWM output with the duty cycle computed by the PID. A seat
+             whose sensor failed stays at 0 %.
  ************************************************************************************/
 void vHeaterControlTask(void *pvParameters)
 {
+    Seat_SnapshotType xSnapshot;
+    uint8 ucSeat;
+
     for (;;)
     {
-        xEventGroupWaitBits(
-                xSystemEventGroup,             /* The event group to read. */
-                SEAT_HEATER_INTENSITY_TASK_BIT, /* Bits to test. */
-                pdTRUE,                        /* Clear bits on exit if the unblock condition is met. */
-                pdFALSE,                       /* Don't wait for all bits. */
-                portMAX_DELAY                  /* Don't time out. */
-        );
-
-        /* Control driver seat heater */
-        if (ucDriverHeaterIntensity == LOW_HEATER_INTENSITY)
-        {
-            Dio_WriteChannel(DioConf_BLUE_LED_CHANNEL_ID_INDEX, STD_OFF);
-            Dio_WriteChannel(DioConf_GREEN_LED_CHANNEL_ID_INDEX, STD_ON);
-            Delay_MS(250);
-        }
-        else if (ucDriverHeaterIntensity == MEDIUM_HEATER_INTENSITY)
+        Signal_Wait(SIGNAL_MASK(SIGNAL_HEATER_UPDATED), portMAX_DELAY); /* Wait for new heater duties */
+
+        /* The timers generate the waveform, the task only updates the duty cycles */
+        for (ucSeat = 0; ucSeat < NUMBER_OF_SEATS; ucSeat++)
         {
-            Dio_WriteChannel(DioConf_GREEN_LED_CHANNEL_ID_INDEX, STD_OFF);
-            Dio_WriteChannel(DioConf_BLUE_LED_CHANNEL_ID_INDEX, STD_ON);
-            Delay_MS(250);
+            Seat_GetSnapshot(&xSeats[ucSeat], &xSnapshot);
+            PWM_SetDutyCycle(Seat_Configuration[ucSeat].HeaterChannel, Seat_GetHeaterDrive(&xSnapshot));
         }
-        else if (ucDriverHeaterIntensity == HIGH_HEATER_INTENSITY)
+    }
+}
+
+/************************************************************************************
+Service name: vDashboardDisplayTask
+Task ID: None
+Syntax: void vDashboardDisplayTask(void *pvParameters)
+Service ID[hex]: None
+Sync/Async: Synchronous
+Reentrancy: Non Reentrant
+Parameters (in): pvParameters - Pointer to task parameters
+Parameters (inout): None
+Parameters (out): None
+Return value: None
+Description: Updates and displays dashboard information including seat heater states, desired and current temperatures, task execution times, and CPU load on the UART console.
+             Only the fields that changed since the previous frame are sent (see Dashboard.c).
+             A frame is drawn on each SIGNAL_HEATER_UPDATED, held back until DASHBOARD_REFRESH_PERIOD_MS after the previous one.
+             DASHBOARD_JOBSTATS_DUMP_KEY shows the job statistics instead (see JobStats.h), DASHBOARD_JOBSTATS_RESET_KEY clears them.
+             DASHBOARD_STACK_REPORT_KEY shows the stack use and the recommended stack sizes (see StackMonitor.h).
+             DASHBOARD_HEAP_REPORT_KEY shows the kernel heap use and the live allocations (see HeapMonitor.h).
+             DASHBOARD_FAILURE_LOG_KEY has vFailureLogTask show the EEPROM failure journal (see FailureLog.h),
+             this task leaves UART0 to it until its notification says the journal is sent.
+             The share of tick interrupts the tickless idle saved is shown since start-up (see LowPower.h),
+             and the bytes the previous frame sent over UART0.
+ ************************************************************************************/
+void vDashboardDisplayTask(void *pvParameters)
+{
+    const uint8 *pHeaterStateText[5] = {(const uint8 *)"", (const uint8 *)"LOW", (const uint8 *)"MEDIUM", (const uint8 *)"HIGH", (const uint8 *)"OFF"}; /* Indexed by HeatingLevel */
+    uint64 ullTasksTime[NUMBER_OF_TASK_TAGS]; /* Snapshot of the tasks total time */
+    Seat_SnapshotType xSnapshot;              /* Consistent copy of one seat */
+    CpuLoad_WindowStatsType xLoad;            /* Utilisation over one window */
+    LowPower_StatsType xSleep;                /* Tickless idle counters */
+    TickType_t xLastFrameTime;
+    uint8 ucCounter;
+    uint8 ucSeat;
+    uint8 ucKey;
+
+    Dashboard_Init(); /* Draw the static part of the screen once */
+    xLastFrameTime = xTaskGetTickCount();
+
+    for (;;)
+    {
+        Signal_Wait(SIGNAL_MASK(SIGNAL_HEATER_UPDATED), portMAX_DELAY); /* Wait for new heater duties */
+        if ((xTaskGetTickCount() - xLastFrameTime) < pdMS_TO_TICKS(DASHBOARD_REFRESH_PERIOD_MS))
         {
-            Dio_WriteChannel(DioConf_GREEN_LED_CHANNEL_ID_INDEX, STD_ON);
-            Dio_WriteChannel(DioConf_BLUE_LED_CHANNEL_ID_INDEX, STD_ON);
-            Delay_MS(250);
+            vTaskDelayUntil(&xLastFrameTime, pdMS_TO_TICKS(DASHBOARD_REFRESH_PERIOD_MS)); /* At most one frame per refresh period */
         }
-        else
+        xLastFrameTime = xTaskGetTickCount();
+
+        if (TRUE == UART0_TryReceiveByte(&ucKey))
         {
-            Dio_WriteChannel(DioConf_GREEN_LED_CHANNEL_ID_INDEX, STD_OFF);
-            Dio_WriteChannel(DioConf_BLUE_LED_CHANNEL_ID_INDEX, STD_OFF);
-            Delay_MS(250);
+            if ((DASHBOARD_JOBSTATS_DUMP_KEY == ucKey) || (DASHBOARD_STACK_REPORT_KEY == ucKey) ||
+                (DASHBOARD_HEAP_REPORT_KEY == ucKey) || (DASHBOARD_FAILURE_LOG_KEY == ucKey))
+            {
+                /* Leave the report on a clear screen until the next key */
+                UART0_SendString((const uint8 *)"\033[2J\033[H");
+                if (DASHBOARD_JOBSTATS_DUMP_KEY == ucKey)
+                {
+                    JobStats_Dump();
+                }
+                else if (DASHBOARD_STACK_REPORT_KEY == ucKey)
+                {
+                    StackMonitor_Dump();
+                }
+                else if (DASHBOARD_FAILURE_LOG_KEY == ucKey)
+                {
+                    xTaskNotify(xFailureLogTask, FAILURE_LOG_EVENT_DUMP, eSetBits);
+                    ulTaskNotifyTake(pdTRUE, portMAX_DELAY); /* Nothing else on UART0 until the journal is sent */
+                }
+                else
+                {
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+                    HeapMonitor_Dump();
+#else
+                    UART0_SendString((const uint8 *)"No kernel heap in the static allocation build\r\n");
+#endif
+                }
+                while (FALSE == UART0_TryReceiveByte(&ucKey))
+                {
+                    vTaskDelay(pdMS_TO_TICKS(DASHBOARD_REFRESH_PERIOD_MS));
+                }
+                Dashboard_Init();
+            }
+            else if (DASHBOARD_JOBSTATS_RESET_KEY == ucKey)
+            {
+                JobStats_Reset();
+            }
         }
 
-        /* Control passenger seat heater */
-        if (ucPassengerHeaterIntensity == LOW_HEATER_INTENSITY)
+        /* Take a consistent copy of the runtime statistics. The UART sends below may
+         * block on the transmit ring, so they must stay outside the critical section */
+        prvGetTasksTotalTime(ullTasksTime);
+
+        /* Only the fields whose text changed since the last frame are retransmitted */
+        Dashboard_BeginFrame();
+        for (ucSeat = 0; ucSeat < NUMBER_OF_SEATS; ucSeat++)
         {
-            Dio_WriteChannel(DioConf_BLUE_LED_OUT_CHANNEL_ID_INDEX, STD_OFF);
-            Dio_WriteChannel(DioConf_GREEN_LED_OUT_CHANNEL_ID_INDEX, STD_ON);
-            Delay_MS(250);
+            Seat_GetSnapshot(&xSeats[ucSeat], &xSnapshot);
+            Dashboard_SetText(DASHBOARD_SEAT_FIELD(ucSeat, DASHBOARD_SEAT_NAME), Seat_Configuration[ucSeat].pName);
+            Dashboard_SetText(DASHBOARD_SEAT_FIELD(ucSeat, DASHBOARD_SEAT_HEATER_STATE), pHeaterStateText[Seat_GetHeaterLevel(&xSnapshot)]);
+            Dashboard_SetInteger(DASHBOARD_SEAT_FIELD(ucSeat, DASHBOARD_SEAT_REQUIRED_TEMP), xSnapshot.ucDesiredTemp);
+            Dashboard_SetDeciValue(DASHBOARD_SEAT_FIELD(ucSeat, DASHBOARD_SEAT_CURRENT_TEMP), xSnapshot.sCurrentTemp);
         }
-        else if (ucPassengerHeaterIntensity == MEDIUM_HEATER_INTENSITY)
+        Dashboard_SetInteger(DASHBOARD_IDLE_TASK_TIME, (sint32)TIMEBASE_TO_MS(ullTasksTime[0]));
+        Dashboard_SetInteger(DASHBOARD_SEAT_BUTTON_TASK_TIME, (sint32)TIMEBASE_TO_MS(ullTasksTime[SEAT_BUTTON_TASK_TAG]));
+        Dashboard_SetInteger(DASHBOARD_HEATER_MONITOR_TASK_TIME, (sint32)TIMEBASE_TO_MS(ullTasksTime[HEATER_MONITOR_TASK_TAG]));
+        Dashboard_SetInteger(DASHBOARD_HEATER_CONTROL_TASK_TIME, (sint32)TIMEBASE_TO_MS(ullTasksTime[HEATER_CONTROL_TASK_TAG]));
+        Dashboard_SetInteger(DASHBOARD_CURRENT_TEMP_TASK_TIME, (sint32)TIMEBASE_TO_MS(ullTasksTime[CURRENT_TEMP_TASK_TAG]));
+        Dashboard_SetInteger(DASHBOARD_DISPLAY_TASK_TIME, (sint32)TIMEBASE_TO_MS(ullTasksTime[DISPLAY_TASK_TAG]));
+        Dashboard_SetInteger(DASHBOARD_FAILURE_TASK_TIME, (sint32)TIMEBASE_TO_MS(ullTasksTime[FAILURE_TASK_TAG]));
+        Dashboard_SetInteger(DASHBOARD_RUNTIME_TASK_TIME, (sint32)TIMEBASE_TO_MS(ullTasksTime[RUNTIME_TASK_TAG]));
+
+        /* Task shares over the medium window, load and peak load over every window */
+        CpuLoad_GetWindow(CPULOAD_MEDIUM_WINDOW, &xLoad);
+        Dashboard_SetDeciValue(DASHBOARD_IDLE_TASK_SHARE, xLoad.usTaskShare[0]);
+        Dashboard_SetDeciValue(DASHBOARD_SEAT_BUTTON_TASK_SHARE, xLoad.usTaskShare[SEAT_BUTTON_TASK_TAG]);
+        Dashboard_SetDeciValue(DASHBOARD_HEATER_MONITOR_TASK_SHARE, xLoad.usTaskShare[HEATER_MONITOR_TASK_TAG]);
+        Dashboard_SetDeciValue(DASHBOARD_HEATER_CONTROL_TASK_SHARE, xLoad.usTaskShare[HEATER_CONTROL_TASK_TAG]);
+        Dashboard_SetDeciValue(DASHBOARD_CURRENT_TEMP_TASK_SHARE, xLoad.usTaskShare[CURRENT_TEMP_TASK_TAG]);
+        Dashboard_SetDeciValue(DASHBOARD_DISPLAY_TASK_SHARE, xLoad.usTaskShare[DISPLAY_TASK_TAG]);
+        Dashboard_SetDeciValue(DASHBOARD_FAILURE_TASK_SHARE, xLoad.usTaskShare[FAILURE_TASK_TAG]);
+        Dashboard_SetDeciValue(DASHBOARD_RUNTIME_TASK_SHARE, xLoad.usTaskShare[RUNTIME_TASK_TAG]);
+        for (ucCounter = 0; ucCounter < CPULOAD_NUMBER_OF_WINDOWS; ucCounter++)
         {
-            Dio_WriteChannel(DioConf_GREEN_LED_OUT_CHANNEL_ID_INDEX, STD_OFF);
-            Dio_WriteChannel(DioConf_BLUE_LED_OUT_CHANNEL_ID_INDEX, STD_ON);
-            Delay_MS(250);
+            CpuLoad_GetWindow((CpuLoad_WindowType)ucCounter, &xLoad);
+            Dashboard_SetDeciValue(DASHBOARD_CPU_LOAD_FIELD(ucCounter), xLoad.usLoad);
+            Dashboard_SetDeciValue(DASHBOARD_CPU_PEAK_LOAD_FIELD(ucCounter), xLoad.usPeakLoad);
         }
-        else if (ucPassengerHeaterIntensity == HIGH_HEATER_INTENSITY)
+        Dashboard_SetInteger(DASHBOARD_STACK_WARNINGS, StackMonitor_GetWarnings());
+        LowPower_GetStats(&xSleep);
+        Dashboard_SetDeciValue(DASHBOARD_TICKS_SUPPRESSED,
+                               (sint32)(((uint64)xSleep.ulSuppressedTicks * 1000U) / ((uint64)xTaskGetTickCount() + 1U)));
+        Dashboard_SetInteger(DASHBOARD_LAST_FRAME_BYTES, (sint32)Dashboard_GetLastFrameBytes()); /* UART0 cost of the refresh */
+        Dashboard_EndFrame();
+    }
+}
+
+/************************************************************************************
+Service name: vTelemetryTask
+Task ID: None
+Syntax: void vTelemetryTask(void *pvParameters)
+Service ID[hex]: None
+Sync/Async: Synchronous
+Reentrancy: Non Reentrant
+Parameters (in): pvParameters - Pointer to task parameters
+Parameters (inout): None
+Parameters (out): None
+Return value: None
+Description: Replaces the dashboard when TELEMETRY_OUTPUT is STD_ON. Every TELEMETRY_PERIOD_MS it sends
+             the seat states, temperatures, task run times, CPU load and latest failures as one
+             CRC-protected, COBS-framed binary record (see Telemetry.c).
+ ************************************************************************************/
+void vTelemetryTask(void *pvParameters)
+{
+    Telemetry_RecordType xRecord;
+    Seat_SnapshotType xSnapshot;
+    TickType_t xLastWakeTime = xTaskGetTickCount();
+    uint8 ucCounter;
+
+    for (;;)
+    {
+        vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(TELEMETRY_PERIOD_MS));
+
+        xRecord.ullTimestamp = TIMEBASE_TO_US(Timebase_Now());
+        xRecord.ucCpuLoad = (uint8)((CpuLoad_GetLoad(CPULOAD_SHORT_WINDOW) + 5U) / 10U);
+        xRecord.ulAdcOverruns = ulAdcSampleOverruns;
+
+        taskENTER_CRITICAL();
+        for (ucCounter = 0; ucCounter < TELEMETRY_NUMBER_OF_TASKS; ucCounter++)
         {
-            Dio_WriteChannel(DioConf_GREEN_LED_OUT_CHANNEL_ID_INDEX, STD_ON);
-            Dio_WriteChannel(DioConf_BLUE_LED_OUT_CHANNEL_ID_INDEX, STD_ON);
-            Delay_MS(250);
+            xRecord.ullTaskTime[ucCounter] = TIMEBASE_TO_US(ullTasksTotalTime[ucCounter]);
         }
-        else
+        taskEXIT_CRITICAL();
+
+        for (ucCounter = 0; ucCounter < TELEMETRY_NUMBER_OF_SEATS; ucCounter++)
         {
-            Dio_WriteChannel(DioConf_GREEN_LED_OUT_CHANNEL_ID_INDEX, STD_OFF);
-            Dio_WriteChannel(DioConf_BLUE_LED_OUT_CHANNEL_ID_INDEX, STD_OFF);
-            Delay_MS(250);
+            Seat_GetSnapshot(&xSeats[ucCounter], &xSnapshot);
+            xRecord.Seats[ucCounter].ucHeaterLevel = Seat_GetHeaterLevel(&xSnapshot);
+            xRecord.Seats[ucCounter].ucDesiredTemp = xSnapshot.ucDesiredTemp;
+            xRecord.Seats[ucCounter].sCurrentTemp = xSnapshot.sCurrentTemp;
+            xRecord.Seats[ucCounter].ucFailureCode = (xSnapshot.xLatestFailure.failureMessage != NULL) ? TELEMETRY_FAILURE_SENSOR_RANGE : TELEMETRY_FAILURE_NONE;
+            xRecord.Seats[ucCounter].ucFailureLevel = xSnapshot.xLatestFailure.level;
+            xRecord.Seats[ucCounter].ullFailureTimestamp = TIMEBASE_TO_US(xSnapshot.xLatestFailure.timestamp);
         }
+
+        Telemetry_SendRecord(&xRecord);
     }
 }
 
+#if (TRACE_OUTPUT == STD_ON)
 /************************************************************************************
-Service name: vDashboardDisplayTask
+Service name: vTraceStreamTask
 Task ID: None
-Syntax: void vDashboardDisplayTask(void *pvParameters)
+Syntax: void vTraceStreamTask(void *pvParameters)
 Service ID[hex]: None
 Sync/Async: Synchronous
 Reentrancy: Non Reentrant
@@ -411,107 +829,41 @@ Parameters (in): pvParameters - Pointer to task parameters
 Parameters (inout): None
 Parameters (out): None
 Return value: None
-Description: Updates and displays dashboard information including seat heater states, desired and current temperatures, task execution times, and CPU load on the UART console.
+Description: Replaces the dashboard when TRACE_OUTPUT is STD_ON. Every TRACE_STREAM_PERIOD_MS it drains
+             the kernel event trace into binary frames (see Trace.h), the task names first and again
+             every TRACE_NAMES_PERIOD drains. A frame is only queued when the UART0 transmit ring can
+             take it whole, so the stream never blocks and adds no UART waits of its own to the trace.
  ************************************************************************************/
-void vDashboardDisplayTask(void *pvParameters)
+void vTraceStreamTask(void *pvParameters)
 {
+    TickType_t xLastWakeTime = xTaskGetTickCount();
+    uint32 ulDrains = 0;
+    boolean bNamesDue = TRUE;
+    uint16 usLength;
+
     for (;;)
     {
-        xEventGroupWaitBits(
-                xSystemEventGroup,             /* The event group to read. */
-                SEAT_HEATER_INTENSITY_TASK_BIT, /* Bits to test. */
-                pdTRUE,                        /* Clear bits on exit if the unblock condition is met. */
-                pdFALSE,                       /* Don't wait for all bits. */
-                portMAX_DELAY                  /* Don't time out. */
-        );
-
-        UART0_SendString("\033[2J");  // Clear the entire screen
-        UART0_SendString("\033[H");   // Move cursor to the top-left corner
-        UART0_SendString("\t\tDriver Seat ");
-        UART0_SendString("\t  Passenger Seat ");
-        UART0_SendString("\r\n\nHEATER STATE:       ");
-        switch (ucDriverHeaterIntensity)
+        vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(TRACE_STREAM_PERIOD_MS));
+
+        if (0U == (++ulDrains % TRACE_NAMES_PERIOD))
         {
-        case 4:
-            UART0_SendString("OFF");
-            break;
-        case 3:
-            UART0_SendString("HIGH");
-            break;
-        case 2:
-            UART0_SendString("MEDIUM");
-            break;
-        case 1:
-            UART0_SendString("LOW");
-            break;
-        default:
-            break;
+            bNamesDue = TRUE; /* A capture started late can still name the tasks */
         }
-
-        UART0_SendString("                 ");
-        switch (ucPassengerHeaterIntensity)
+        if ((TRUE == bNamesDue) && (UART0_GetTxFreeSpace() >= TELEMETRY_FRAME_SIZE(TRACE_NAMES_PAYLOAD_SIZE)))
         {
-        case 4:
-            UART0_SendString("OFF");
-            break;
-        case 3:
-            UART0_SendString("HIGH");
-            break;
-        case 2:
-            UART0_SendString("MEDIUM");
-            break;
-        case 1:
-            UART0_SendString("LOW");
-            break;
-        default:
-            break;
+            usLength = Trace_EncodeNames(ucTraceFrame);
+            UART0_SendBuffer(ucTraceFrame, usLength);
+            bNamesDue = FALSE;
         }
 
-        UART0_SendString("\r\n\nRequired Temp:       ");
-        UART0_SendInteger(usDriver_Seat_Desired_Temp);
-        UART0_SendString("                   ");
-        UART0_SendInteger(usPassenger_Seat_Desired_Temp);
-        UART0_SendString("\r\n\nCurrent Temp:       ");
-        UART0_SendInteger(usDriverSeatCurrentTemp);
-        UART0_SendString("                   ");
-        UART0_SendInteger(usPassengerSeatCurrentTemp);
-
-        taskENTER_CRITICAL();
-        UART0_SendString("\r\n\nIdleTask execution time is ");
-        UART0_SendInteger(ullTasksTotalTime[0] / 10);
-        UART0_SendString(" msec \r\n");
-        UART0_SendString("DriverSeatHeatingLevelTask execution time is ");
-        UART0_SendInteger(ullTasksTotalTime[1] / 10);
-        UART0_SendString(" msec \r\n");
-        UART0_SendString("PassengerSeatHeatingLevelTask execution time is ");
-        UART0_SendInteger(ullTasksTotalTime[2] / 10);
-        UART0_SendString(" msec \r\n");
-        UART0_SendString("HeaterMonitorTask execution time is ");
-        UART0_SendInteger(ullTasksTotalTime[5] / 10);
-        UART0_SendString(" msec \r\n");
-        UART0_SendString("HeaterControlTask execution time is ");
-        UART0_SendInteger(ullTasksTotalTime[6] / 10);
-        UART0_SendString(" msec \r\n");
-        UART0_SendString("GetCurrentTempTask execution time is ");
-        UART0_SendInteger(ullTasksTotalTime[3] / 10);
-        UART0_SendString(" msec \r\n");
-        UART0_SendString("DashboardDisplayTask execution time is ");
-        UART0_SendInteger(ullTasksTotalTime[7] / 10);
-        UART0_SendString(" msec \r\n");
-        UART0_SendString("FailureHandleTask execution time is ");
-        UART0_SendInteger(ullTasksTotalTime[4] / 10);
-        UART0_SendString(" msec \r\n");
-        UART0_SendString("RunTimeMeasurementsTask execution time is ");
-        UART0_SendInteger(ullTasksTotalTime[8] / 10);
-        UART0_SendString(" msec \r\n");
-        UART0_SendString("CPU Load is ");
-        UART0_SendInteger(ucCPU_Load);
-        UART0_SendString("% \r\n");
-        taskEXIT_CRITICAL();
-
-        vTaskDelay(pdMS_TO_TICKS(1000));
+        while ((0U != Trace_GetPending()) && (UART0_GetTxFreeSpace() >= TELEMETRY_FRAME_SIZE(TRACE_EVENTS_PAYLOAD_SIZE)))
+        {
+            usLength = Trace_EncodeEvents(ucTraceFrame);
+            UART0_SendBuffer(ucTraceFrame, usLength);
+        }
     }
 }
+#endif
 
 /************************************************************************************
 Service name: vFailureHandleTask
@@ -524,45 +876,104 @@ Parameters (in): pvParameters - Pointer to task parameters
 Parameters (inout): None
 Parameters (out): None
 Return value: None
-Description: Handles temperature sensor failure conditions for driver and passenger seats.
-             Updates latest failure information and adjusts heater intensity accordingly.
+Description: Handles temperature sensor failure conditions for every seat, on each SIGNAL_TEMPERATURE_UPDATED.
+             Updates latest failure information, drives the seat fault LED and adjusts heater intensity accordingly.
+             A sensor that fails queues one record for the EEPROM journal, without waiting for vFailureLogTask.
  ************************************************************************************/
 void vFailureHandleTask(void *pvParameters)
 {
+    FailureLog_RecordType xRecord;
+    Seat_SnapshotType xSnapshot;
+    boolean bFailed;
+    uint8 ucSeat;
+
     for (;;)
     {
-        xEventGroupWaitBits(
-                xSystemEventGroup,               /* The event group to read. */
-                SEAT_CURRENT_TEMP_TASK_BIT,      /* Bits to test. */
-                pdTRUE,                          /* Clear bits on exit if the unblock condition is met. */
-                pdFALSE,                         /* Don't wait for all bits. */
-                portMAX_DELAY                    /* Don't time out. */
-        );
-
-        if (((usDriverSeatCurrentTemp < 5) || (usDriverSeatCurrentTemp > 40)))
-        {
-            latestFailure[0].failureMessage = "Invalid Driver Temperature Sensor Range ";
-            latestFailure[0].level = ucDriverHeaterIntensity;
-            latestFailure[0].timestamp = GPTM_WTimer0Read();
-            Dio_WriteChannel(DioConf_RED_LED_CHANNEL_ID_INDEX, STD_ON);
-            ucDriverHeaterIntensity = TURN_OFF_HEATER;
-        }
-        else
+        Signal_Wait(SIGNAL_MASK(SIGNAL_TEMPERATURE_UPDATED), portMAX_DELAY); /* Wait for new temperatures */
+
+        for (ucSeat = 0; ucSeat < NUMBER_OF_SEATS; ucSeat++)
         {
-            Dio_WriteChannel(DioConf_RED_LED_CHANNEL_ID_INDEX, STD_OFF);
+            Seat_GetSnapshot(&xSeats[ucSeat], &xSnapshot);
+            bFailed = xSnapshot.bSensorFailure;
+            if (TRUE == Seat_CheckSensor(&Seat_Configuration[ucSeat], &xSeats[ucSeat], Timebase_Now()))
+            {
+                Dio_WriteChannel(Seat_Configuration[ucSeat].FaultLedChannel, STD_ON);
+                if (FALSE == bFailed)
+                {
+                    Seat_GetSnapshot(&xSeats[ucSeat], &xSnapshot);
+                    xRecord.ullTimestamp = TIMEBASE_TO_US(xSnapshot.xLatestFailure.timestamp);
+                    xRecord.usAdcValue = xSnapshot.usAdcValue;
+                    xRecord.ucSeat = ucSeat;
+                    xRecord.ucCode = (xSnapshot.sCurrentTemp < TEMP_CONV_DECI_CELSIUS(MIN_VALID_TEMP)) ?
+                                     FAILURELOG_CODE_SENSOR_LOW : FAILURELOG_CODE_SENSOR_HIGH;
+                    xRecord.ucLevel = (uint8)xSnapshot.xLatestFailure.level;
+                    if (pdPASS == xQueueSend(xFailureLogQueue, &xRecord, 0))
+                    {
+                        xTaskNotify(xFailureLogTask, FAILURE_LOG_EVENT_RECORD, eSetBits);
+                    }
+                    else
+                    {
+                        ulFailureLogDrops++;
+                    }
+                }
+            }
+            else
+            {
+                Dio_WriteChannel(Seat_Configuration[ucSeat].FaultLedChannel, STD_OFF);
+            }
         }
+    }
+}
+
+/************************************************************************************
+Service name: vFailureLogTask
+Task ID: None
+Syntax: void vFailureLogTask(void *pvParameters)
+Service ID[hex]: None
+Sync/Async: Synchronous
+Reentrancy: Non Reentrant
+Parameters (in): pvParameters - Pointer to task parameters
+Parameters (inout): None
+Parameters (out): None
+Return value: None
+Description: Only user of the EEPROM once the scheduler runs. Writes the records vFailureHandleTask queues to
+             the failure journal (see FailureLog.h), waiting for the EEPROM at the lowest priority, and sends
+             the journal over UART0 when the dashboard asks for it, then notifies the dashboard, which waits
+             for the end of the journal before it writes to UART0 again.
+ ************************************************************************************/
+void vFailureLogTask(void *pvParameters)
+{
+    FailureLog_RecordType xRecord;
+    uint32_t ulEvents;
+
+    for (;;)
+    {
+        xTaskNotifyWait(0, 0xFFFFFFFFUL, &ulEvents, portMAX_DELAY); /* Wait for records or a dump request */
 
-        if (((usPassengerSeatCurrentTemp < 5) || (usPassengerSeatCurrentTemp > 40)))
+        while (pdPASS == xQueueReceive(xFailureLogQueue, &xRecord, 0))
         {
-            latestFailure[1].failureMessage = "Invalid Passenger Temperature Sensor Range ";
-            latestFailure[1].level = ucPassengerHeaterIntensity;
-            latestFailure[1].timestamp = GPTM_WTimer0Read();
-            Dio_WriteChannel(DioConf_RED_LED_OUT_CHANNEL_ID_INDEX, STD_ON);
-            ucPassengerHeaterIntensity = TURN_OFF_HEATER;
+            if ((FALSE == bFailureLogReady) || (E_OK != FailureLog_Append(&xRecord)))
+            {
+                ulFailureLogWriteErrors++;
+            }
         }
-        else
+
+        if (0UL != (ulEvents & FAILURE_LOG_EVENT_DUMP))
         {
-            Dio_WriteChannel(DioConf_RED_LED_OUT_CHANNEL_ID_INDEX, STD_OFF);
+            if (TRUE == bFailureLogReady)
+            {
+                FailureLog_Dump();
+            }
+            else
+            {
+                UART0_SendString((const uint8 *)"\r\nEEPROM failed to start, no failure journal\r\n");
+            }
+            UART0_SendString((const uint8 *)"\r\nqueue_drops,write_errors\r\n");
+            UART0_SendInteger(ulFailureLogDrops);
+            UART0_SendString((const uint8 *)",");
+            UART0_SendInteger(ulFailureLogWriteErrors);
+            UART0_SendString((const uint8 *)"\r\n");
+            xTaskNotifyGive(xDashboardDisplayTask); /* UART0 is free for the dashboard again */
         }
     }
 }
@@ -578,24 +989,111 @@ Parameters (in): pvParameters - Pointer to task parameters
 Parameters (inout): None
 Parameters (out): None
 Return value: None
-Description: Measures and updates the total execution time of critical tasks and calculates
-             CPU load based on the execution times.
+Description: Every RUNTIME_MEASUREMENTS_TASK_PERIODICITY slides the CPU load windows by the time each task
+             ran since the previous period (see CpuLoad.h). The idle task is never running while this
+             task samples, so the idle-derived load is exact. After the load, the stack of one task is
+             scanned for its high water mark (see StackMonitor.h), every task in turn.
  ************************************************************************************/
 void vRunTimeMeasurementsTask(void *pvParameters)
 {
-    TickType_t xLastWakeTime = xTaskGetTickCount();
+    uint64 ullTasksTime[NUMBER_OF_TASK_TAGS];
+    Timebase_TicksType ullNow;
+    TickType_t xLastWakeTime;
+
+    /* The kernel creates these with the scheduler */
+    StackMonitor_Register(xTaskGetIdleTaskHandle(), configMINIMAL_STACK_SIZE);
+    StackMonitor_Register(xTimerGetTimerDaemonTaskHandle(), configTIMER_TASK_STACK_DEPTH);
+
+    ullNow = prvGetTasksTotalTime(ullTasksTime);
+    CpuLoad_Init(ullTasksTime, ullNow);
+    xLastWakeTime = xTaskGetTickCount();
+
     for (;;)
     {
-        uint8_t ucCounter;
-        uint32_t ullTotalTasksTime = 0;
+        vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(RUNTIME_MEASUREMENTS_TASK_PERIODICITY));
 
-        vTaskDelayUntil(&xLastWakeTime, RUNTIME_MEASUREMENTS_TASK_PERIODICITY);
+        ullNow = prvGetTasksTotalTime(ullTasksTime);
+        CpuLoad_Update(ullTasksTime, ullNow);
+        StackMonitor_Sample();
+    }
+}
 
-        for (ucCounter = 1; ucCounter < 9; ucCounter++)
-        {
-            ullTotalTasksTime += ullTasksTotalTime[ucCounter];
-        }
+/************************************************************************************
+Service name:           prvGetTasksTotalTime
+Syntax:                 Timebase_TicksType prvGetTasksTotalTime(uint64 *pTimes)
+Service ID[hex]:        N/A
+Sync/Async:             Synchronous
+Reentrancy:             Reentrant
+Parameters (in):        None
+Parameters (inout):     None
+Parameters (out):       pTimes - Run time of every task tag, NUMBER_OF_TASK_TAGS entries
+Return value:           Timestamp taken together with the run times
+Description:            Copies the run time totals in one go, the context switches update them.
+ ************************************************************************************/
+Timebase_TicksType prvGetTasksTotalTime(uint64 *pTimes)
+{
+    Timebase_TicksType ullNow;
+    uint8 ucCounter;
 
-        ucCPU_Load = ((ullTotalTasksTime) * 100) / GPTM_WTimer0Read();
+    taskENTER_CRITICAL();
+    for (ucCounter = 0; ucCounter < NUMBER_OF_TASK_TAGS; ucCounter++)
+    {
+        pTimes[ucCounter] = ullTasksTotalTime[ucCounter];
     }
+    ullNow = Timebase_Now();
+    taskEXIT_CRITICAL();
+
+    return ullNow;
+}
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/************************************************************************************
+Service name:           vApplicationGetIdleTaskMemory
+Syntax:                 void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer,
+                                                           StackType_t **ppxIdleTaskStackBuffer,
+                                                           uint32_t *pulIdleTaskStackSize)
+Service ID[hex]:        N/A
+Sync/Async:             Synchronous
+Reentrancy:             Non Reentrant
+Parameters (in):        None
+Parameters (inout):     None
+Parameters (out):       ppxIdleTaskTCBBuffer - TCB of the idle task
+                        ppxIdleTaskStackBuffer - Stack of the idle task
+                        pulIdleTaskStackSize - Stack size in words
+Return value:           None
+Description:            Kernel callback of the static allocation build, called by vTaskStartScheduler
+                        for the memory of the idle task.
+ ************************************************************************************/
+void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer,
+                                   uint32_t *pulIdleTaskStackSize)
+{
+    *ppxIdleTaskTCBBuffer = &xIdleTaskBuffer;
+    *ppxIdleTaskStackBuffer = xIdleTaskStack;
+    *pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+
+/************************************************************************************
+Service name:           vApplicationGetTimerTaskMemory
+Syntax:                 void vApplicationGetTimerTaskMemory(StaticTask_t **ppxTimerTaskTCBBuffer,
+                                                            StackType_t **ppxTimerTaskStackBuffer,
+                                                            uint32_t *pulTimerTaskStackSize)
+Service ID[hex]:        N/A
+Sync/Async:             Synchronous
+Reentrancy:             Non Reentrant
+Parameters (in):        None
+Parameters (inout):     None
+Parameters (out):       ppxTimerTaskTCBBuffer - TCB of the timer service task
+                        ppxTimerTaskStackBuffer - Stack of the timer service task
+                        pulTimerTaskStackSize - Stack size in words
+Return value:           None
+Description:            Kernel callback of the static allocation build, called by vTaskStartScheduler
+                        for the memory of the timer service task.
+ ************************************************************************************/
+void vApplicationGetTimerTaskMemory(StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer,
+                                    uint32_t *pulTimerTaskStackSize)
+{
+    *ppxTimerTaskTCBBuffer = &xTimerTaskBuffer;
+    *ppxTimerTaskStackBuffer = xTimerTaskStack;
+    *pulTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
 }
+#endif
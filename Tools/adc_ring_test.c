@@ -0,0 +1,214 @@
+/******************************************************************************
+ *
+ * Tool: adc_ring_test
+ *
+ * File Name: adc_ring_test.c
+ *
+ * Description: Host test of the interrupt driven ADC0 block path of
+ *              MCAL/ADC/adc.c (ADC0_StartContinuous, ADC0_Seq0_Handler,
+ *              ADC0_ReadSamples), compiled in unchanged on the emulated
+ *              peripheral block (MCAL/hw_sim.c). The sequencer 0 FIFO is
+ *              emulated in front of it: every read of ADCSSFIFO0 returns the
+ *              next result of the scan, as the hardware pops one result per
+ *              step. Every scan carries its number in its results, so a
+ *              scan read twice, lost or out of order is seen.
+ *
+ *              Checked are:
+ *              1. The block callback runs once per TEST_BLOCK_SIZE scans while
+ *                 the reader drains whole blocks, every scan read in order.
+ *              2. A reader that stops: the ring fills to
+ *                 ADC0_SAMPLE_BUFFER_SIZE scans, every scan after is dropped
+ *                 and counted by ADC0_GetOverrunCount, the callback ran once,
+ *                 the ring still returns the oldest scans and takes new ones
+ *                 once drained.
+ *              3. The head and tail indexes wrapping past 0xFFFFFFFF: the fill
+ *                 level, the callbacks and the data stay right, the overrun
+ *                 check included.
+ *
+ *              Build: gcc -O2 -DTM4C_HOST_SIM
+ *                         -I../FreeRTOS_Project_SeatControllerSystem
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Common
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/ADC
+ *                         -o adc_ring_test adc_ring_test.c
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include <stdio.h>
+
+/* hw_sim.c backs the registers, the emulated sequencer FIFO sits in front of it */
+#define Sim_PeripheralAddress Sim_PageAddress
+#include "hw_sim.c"
+#undef Sim_PeripheralAddress
+volatile uint32 * Sim_PeripheralAddress(uint32 address);
+
+#include "adc.c"
+
+#define TEST_BLOCK_SIZE      16U                 /* Scans per block, TEMP_SAMPLE_BLOCK_SIZE of the application */
+#define TEST_ADC0_SSFIFO0    (0x40038000UL + 0x048UL)
+#define TEST_WRAP_START      (0xFFFFFFFFUL - 20UL) /* Ring indexes a few scans before the wrap */
+
+static uint32 Test_NextScan;                     /* Number of the next scan the sequencer converts */
+static uint8 Test_FifoStep;                      /* Step of the next ADCSSFIFO0 read */
+static uint32 Test_NextRead;                     /* Number of the next scan the reader expects */
+static uint32 Test_Callbacks;
+static uint32 Test_Failures;
+static uint32 Test_Checks;
+
+static void Test_Expect(const char *pName, uint32 ulValue, uint32 ulExpected)
+{
+    Test_Checks++;
+    if (ulValue != ulExpected)
+    {
+        printf("FAIL %s: %u, expected %u\n", pName, ulValue, ulExpected);
+        Test_Failures++;
+    }
+}
+
+/* Result of one step of one scan, 12 bits with the step in the lowest bit */
+static uint16 Test_Result(uint32 ulScan, uint8 ucStep)
+{
+    return (uint16)(((ulScan * ADC0_NUMBER_OF_CHANNELS) + ucStep) & ADC_RESULT_MASK);
+}
+
+volatile uint32 * Sim_PeripheralAddress(uint32 address)
+{
+    volatile uint32 *pRegister = Sim_PageAddress(address);
+
+    if (TEST_ADC0_SSFIFO0 == address)
+    {
+        /* Pop the next result, bits above the 12-bit result are not zero on the hardware either */
+        *pRegister = 0xABCD0000UL | Test_Result(Test_NextScan, Test_FifoStep);
+        if (++Test_FifoStep == ADC0_NUMBER_OF_CHANNELS)
+        {
+            Test_FifoStep = 0;
+            Test_NextScan++;
+        }
+    }
+    return pRegister;
+}
+
+static void Test_BlockCallback(void)
+{
+    Test_Callbacks++;
+}
+
+/* The sequencer completes one scan and interrupts */
+static void Test_Scan(void)
+{
+    ADC0_Seq0_Handler();
+    Test_Expect("FIFO read once per step", Test_FifoStep, 0U);
+}
+
+/* Read up to ulMaxScans scans and check they are the next ones in order */
+static uint32 Test_Read(uint32 ulMaxScans)
+{
+    uint16 aSamples[ADC0_SAMPLE_BUFFER_SIZE * ADC0_NUMBER_OF_CHANNELS];
+    uint32 ulCount = ADC0_ReadSamples(aSamples, ulMaxScans);
+    uint32 ulScan;
+    uint8 ucStep;
+    boolean bInOrder = TRUE;
+
+    for (ulScan = 0; ulScan < ulCount; ulScan++)
+    {
+        for (ucStep = 0; ucStep < ADC0_NUMBER_OF_CHANNELS; ucStep++)
+        {
+            if (aSamples[(ulScan * ADC0_NUMBER_OF_CHANNELS) + ucStep] != Test_Result(Test_NextRead, ucStep))
+            {
+                bInOrder = FALSE;
+            }
+        }
+        Test_NextRead++;
+    }
+    Test_Expect("scans read in order", bInOrder, TRUE);
+    return ulCount;
+}
+
+static void Test_Start(void)
+{
+    ADC0_StartContinuous(TEST_BLOCK_SIZE, Test_BlockCallback);
+    Test_NextScan = 0;
+    Test_NextRead = 0;
+    Test_Callbacks = 0;
+}
+
+int main(void)
+{
+    uint32 ulScan;
+    uint32 ulCallbacks;
+
+    ADC0_Init();
+
+    /* 1. A reader draining whole blocks: one callback per block */
+    Test_Start();
+    for (ulScan = 0; ulScan < (10U * TEST_BLOCK_SIZE); ulScan++)
+    {
+        ulCallbacks = Test_Callbacks;
+        Test_Scan();
+        if (Test_Callbacks != ulCallbacks)
+        {
+            Test_Expect("callback on the last scan of a block", ADC0_GetSampleCount(), TEST_BLOCK_SIZE);
+            Test_Expect("block read whole", Test_Read(TEST_BLOCK_SIZE), TEST_BLOCK_SIZE);
+        }
+    }
+    Test_Expect("one callback per block", Test_Callbacks, 10U);
+    Test_Expect("every scan read", Test_NextRead, 10U * TEST_BLOCK_SIZE);
+    Test_Expect("no overruns", ADC0_GetOverrunCount(), 0U);
+    Test_Expect("ISC cleared by the handler", ADC0_ADCISC_REG, 0x01U);
+
+    /* A late reader: three blocks in, then drained in one go, one callback in between */
+    for (ulScan = 0; ulScan < (3U * TEST_BLOCK_SIZE); ulScan++)
+    {
+        Test_Scan();
+    }
+    Test_Expect("late reader, one callback", Test_Callbacks, 11U);
+    Test_Expect("late reader, three blocks", Test_Read(ADC0_SAMPLE_BUFFER_SIZE), 3U * TEST_BLOCK_SIZE);
+
+    /* 2. A reader that stops: the newest scans are dropped and counted */
+    Test_Start();
+    for (ulScan = 0; ulScan < (ADC0_SAMPLE_BUFFER_SIZE + 5U); ulScan++)
+    {
+        Test_Scan();
+    }
+    Test_Expect("ring full", ADC0_GetSampleCount(), ADC0_SAMPLE_BUFFER_SIZE);
+    Test_Expect("overruns counted", ADC0_GetOverrunCount(), 5U);
+    Test_Expect("one callback while stopped", Test_Callbacks, 1U);
+    Test_Expect("oldest scans kept", Test_Read(ADC0_SAMPLE_BUFFER_SIZE), ADC0_SAMPLE_BUFFER_SIZE);
+    Test_NextRead = Test_NextScan;                /* The 5 dropped scans are gone */
+    Test_Scan();
+    Test_Expect("new scans after the overrun", Test_Read(ADC0_SAMPLE_BUFFER_SIZE), 1U);
+    Test_Expect("overruns kept", ADC0_GetOverrunCount(), 5U);
+    Test_Start();
+    Test_Expect("overruns reset by a restart", ADC0_GetOverrunCount(), 0U);
+
+    /* 3. The indexes wrap: both start a few scans before 0xFFFFFFFF */
+    Test_Start();
+    ADC0_SampleHead = TEST_WRAP_START;
+    ADC0_SampleTail = TEST_WRAP_START;
+    for (ulScan = 0; ulScan < (6U * TEST_BLOCK_SIZE); ulScan++)
+    {
+        ulCallbacks = Test_Callbacks;
+        Test_Scan();
+        Test_Expect("fill level across the wrap", ADC0_GetSampleCount(), (ulScan % TEST_BLOCK_SIZE) + 1U);
+        if (Test_Callbacks != ulCallbacks)
+        {
+            Test_Expect("block read whole across the wrap", Test_Read(TEST_BLOCK_SIZE), TEST_BLOCK_SIZE);
+        }
+    }
+    Test_Expect("one callback per block across the wrap", Test_Callbacks, 6U);
+    Test_Expect("head wrapped", (ADC0_SampleHead < TEST_WRAP_START) ? 1U : 0U, 1U);
+
+    ADC0_SampleHead = TEST_WRAP_START;
+    ADC0_SampleTail = TEST_WRAP_START;
+    Test_NextRead = Test_NextScan;
+    for (ulScan = 0; ulScan < (ADC0_SAMPLE_BUFFER_SIZE + 3U); ulScan++)
+    {
+        Test_Scan();
+    }
+    Test_Expect("ring full across the wrap", ADC0_GetSampleCount(), ADC0_SAMPLE_BUFFER_SIZE);
+    Test_Expect("overruns across the wrap", ADC0_GetOverrunCount(), 3U);
+    Test_Expect("oldest scans kept across the wrap", Test_Read(ADC0_SAMPLE_BUFFER_SIZE), ADC0_SAMPLE_BUFFER_SIZE);
+
+    printf("%s: %u checks, %u failures\n", (0U == Test_Failures) ? "PASS" : "FAIL", Test_Checks, Test_Failures);
+    return (0U == Test_Failures) ? 0 : 1;
+}
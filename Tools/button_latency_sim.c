@@ -0,0 +1,212 @@
+/******************************************************************************
+ *
+ * Tool: button_latency_sim
+ *
+ * File Name: button_latency_sim.c
+ *
+ * Description: Host simulation of the press to setpoint latency of a seat
+ *              button (Services/Seat.c and Services/Debounce.c are compiled in
+ *              unchanged), 1 ms steps.
+ *              A long series of presses of random length, with contact bounce
+ *              on both edges, is fed to:
+ *
+ *              1. The previous input path: the button level is polled every
+ *                 200 ms by the seat task.
+ *              2. The edge interrupt path of main.c: the first edge masks the
+ *                 button and starts the BUTTON_SCAN_PERIOD_MS scan timer, the
+ *                 Debounce engine publishes the press once DEBOUNCE_STABLE_SCANS
+ *                 scans agree, and the scans stop and re-arm the button once
+ *                 it is idle again.
+ *
+ *              For each it reports the mean and worst latency from the first
+ *              contact to the new desired temperature, and the presses that
+ *              never changed it. Task and interrupt run times (a few us) are
+ *              left out, they are far below the 1 ms resolution.
+ *
+ *              Build: gcc -O2 -I../FreeRTOS_Project_SeatControllerSystem
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Common
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Services
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/PWM
+ *                         -o button_latency_sim button_latency_sim.c
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+
+/* One thread, nothing to serialize */
+#define SEQLOCK_WRITER_ENTER()
+#define SEQLOCK_WRITER_EXIT()
+
+#include "SeqLock.c"
+#include "Debounce.c"
+#include "PidController.c"
+#include "SensorFilter.c"
+#include "TempConversion.c"
+#include "Seat.c"
+
+#define SIM_PRESSES          20000U
+#define SIM_MIN_PRESS_MS     30U      /* Shortest deliberate tap */
+#define SIM_MAX_PRESS_MS     400U
+#define SIM_MIN_GAP_MS       300U
+#define SIM_MAX_GAP_MS       1000U
+#define SIM_MAX_BOUNCE_MS    5U       /* Contact bounce after every transition */
+#define SIM_POLL_PERIOD_MS   200U     /* Previous vSeatButtonTask period */
+
+typedef enum { SIM_POLLING, SIM_EDGE } Sim_InputType;
+
+/* Only the button of the seat is simulated */
+static const Seat_ConfigType Sim_SeatConfig = { 0, 0, PWM_TIMER0A_PB6, 0, (const uint8 *)"Sim", "Invalid Temperature Sensor Range ", { 5U, 2U } };
+
+/* Button level (TRUE = pressed) for every ms of the run, and the start of every press */
+static boolean *Sim_Level;
+static uint32 Sim_PressStart[SIM_PRESSES];
+static uint32 Sim_Length;
+
+static uint32 Sim_Random(uint32 ulMin, uint32 ulMax)
+{
+    return ulMin + (uint32)(rand() % (int)(ulMax - ulMin + 1U));
+}
+
+/* Writes ulLength ms of bLevel starting at ulTime, the first ms bounce between both levels */
+static uint32 Sim_Segment(uint32 ulTime, uint32 ulLength, boolean bLevel)
+{
+    uint32 ulBounce = Sim_Random(0U, SIM_MAX_BOUNCE_MS);
+    uint32 ulStep;
+
+    for (ulStep = 0; ulStep < ulLength; ulStep++)
+    {
+        Sim_Level[ulTime + ulStep] = (ulStep < ulBounce) ? (boolean)((ulStep & 1U) ? !bLevel : bLevel) : bLevel;
+    }
+    return ulTime + ulLength;
+}
+
+static void Sim_Generate(void)
+{
+    uint32 ulTime = 0;
+    uint32 ulPress;
+
+    Sim_Length = SIM_PRESSES * (SIM_MAX_PRESS_MS + SIM_MAX_GAP_MS) + SIM_MAX_GAP_MS;
+    Sim_Level = calloc(Sim_Length, sizeof(boolean));
+    ulTime = Sim_Segment(ulTime, SIM_MAX_GAP_MS, FALSE);
+    for (ulPress = 0; ulPress < SIM_PRESSES; ulPress++)
+    {
+        Sim_PressStart[ulPress] = ulTime;
+        ulTime = Sim_Segment(ulTime, Sim_Random(SIM_MIN_PRESS_MS, SIM_MAX_PRESS_MS), TRUE);
+        ulTime = Sim_Segment(ulTime, Sim_Random(SIM_MIN_GAP_MS, SIM_MAX_GAP_MS), FALSE);
+    }
+    Sim_Length = ulTime;
+}
+
+static void Sim_Run(Sim_InputType Input, const char *pName)
+{
+    const PidController_ConfigType xPidConfig = HEATER_PID_CONFIG;
+    Seat_StateType xSeat;
+    uint32 ulPollPhase = Sim_Random(0U, SIM_POLL_PERIOD_MS - 1U);
+    uint32 ulPress = 0;
+    uint32 ulLatencySum = 0;
+    uint32 ulLatencyMax = 0;
+    uint32 ulServed = 0;
+    uint32 ulMissed = 0;
+    boolean bServed = FALSE;
+    boolean bHeld = FALSE;
+    boolean bArmed = TRUE;
+    uint32 ulNextScan = 0;
+    boolean bScanning = FALSE;
+    Debounce_StateType xDebounce;
+    Debounce_EventsType xEvents;
+    uint32 ulSample;
+    boolean bChanged;
+    uint32 ulTime;
+
+    Seat_Init(&Sim_SeatConfig, &xSeat, &xPidConfig);
+    Debounce_Init(&xDebounce, 1U, (uint8)(BUTTON_LONG_PRESS_MS / BUTTON_SCAN_PERIOD_MS));
+
+    for (ulTime = 1; ulTime < Sim_Length; ulTime++)
+    {
+        if ((ulPress < SIM_PRESSES) && (ulTime == Sim_PressStart[ulPress]))
+        {
+            if ((ulPress > 0U) && (FALSE == bServed))
+            {
+                ulMissed++;
+            }
+            ulPress++;
+            bServed = FALSE;
+        }
+
+        bChanged = FALSE;
+        if (SIM_POLLING == Input)
+        {
+            /* Only the press itself counted, holding the button did not repeat */
+            if ((ulTime % SIM_POLL_PERIOD_MS) == ulPollPhase)
+            {
+                if ((TRUE == Sim_Level[ulTime]) && (FALSE == bHeld))
+                {
+                    bChanged = Seat_HandlePress(&xSeat);
+                }
+                bHeld = Sim_Level[ulTime];
+            }
+        }
+        else
+        {
+            /* Port F interrupt: the first edge masks the button and (re)starts the scan timer */
+            if ((TRUE == bArmed) && (Sim_Level[ulTime] != Sim_Level[ulTime - 1U]))
+            {
+                bArmed = FALSE;
+                bScanning = TRUE;
+                ulNextScan = ulTime + BUTTON_SCAN_PERIOD_MS;
+            }
+            /* Scan timer callback: debounce, publish the press, stop and re-arm once idle */
+            if ((TRUE == bScanning) && (ulTime == ulNextScan))
+            {
+                ulSample = (uint32)Sim_Level[ulTime];
+                Debounce_Scan(&xDebounce, &ulSample, &xEvents);
+                if (0U != xEvents.aulPressed[0])
+                {
+                    bChanged = Seat_HandlePress(&xSeat);
+                }
+                ulNextScan = ulTime + BUTTON_SCAN_PERIOD_MS;
+                if (TRUE == Debounce_IsIdle(&xDebounce, &ulSample))
+                {
+                    bScanning = FALSE;
+                    bArmed = TRUE;
+                }
+            }
+        }
+
+        if ((TRUE == bChanged) && (ulPress > 0U) && (FALSE == bServed))
+        {
+            bServed = TRUE;
+            ulServed++;
+            ulLatencySum += ulTime - Sim_PressStart[ulPress - 1U];
+            if ((ulTime - Sim_PressStart[ulPress - 1U]) > ulLatencyMax)
+            {
+                ulLatencyMax = ulTime - Sim_PressStart[ulPress - 1U];
+            }
+        }
+    }
+    if (FALSE == bServed)
+    {
+        ulMissed++;
+    }
+
+    printf("%-22s latency mean %6.1f ms  worst %4lu ms  missed %5lu of %u presses\n", pName,
+           (ulServed > 0U) ? (double)ulLatencySum / ulServed : 0.0, (unsigned long)ulLatencyMax,
+           (unsigned long)ulMissed, SIM_PRESSES);
+}
+
+int main(void)
+{
+    srand(1);
+    TempConv_Init();
+    Sim_Generate();
+
+    printf("presses %u..%u ms, gaps %u..%u ms, bounce up to %u ms, %u scans of %u ms\n",
+           SIM_MIN_PRESS_MS, SIM_MAX_PRESS_MS, SIM_MIN_GAP_MS, SIM_MAX_GAP_MS,
+           SIM_MAX_BOUNCE_MS, DEBOUNCE_STABLE_SCANS, (unsigned)BUTTON_SCAN_PERIOD_MS);
+    Sim_Run(SIM_POLLING, "200 ms polling");
+    Sim_Run(SIM_EDGE, "edge irq + scan");
+
+    free(Sim_Level);
+    return 0;
+}
@@ -0,0 +1,151 @@
+/******************************************************************************
+ *
+ * Tool: cpu_load_sim
+ *
+ * File Name: cpu_load_sim.c
+ *
+ * Description: Host check of the sliding-window CPU load (Services/CpuLoad.c
+ *              is compiled in unchanged) on a synthetic hour of run time:
+ *              a steady 20 % background load, a 3 s spike to 95 % after
+ *              30 minutes and one sample the runtime task was starved for
+ *              2.5 s. Prints the old load (busy time since boot over uptime)
+ *              next to the three windows around the spike, then checks the
+ *              windows against the load that was actually applied.
+ *
+ *              Build: gcc -O2 -I../FreeRTOS_Project_SeatControllerSystem
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Common
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Services
+ *                         -o cpu_load_sim cpu_load_sim.c
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+
+/* One task updates and reads, no writer serialization needed */
+#define SEQLOCK_WRITER_ENTER()
+#define SEQLOCK_WRITER_EXIT()
+
+#include "SeqLock.c"
+#include "CpuLoad.c"
+
+#define SIM_SECONDS             3600U
+#define SIM_SPIKE_START         1800U       /* Sample index of the first spike second */
+#define SIM_SPIKE_SECONDS       3U
+#define SIM_STARVED_SAMPLE      2400U       /* This sample lasts SIM_STARVED_TICKS */
+#define SIM_STARVED_TICKS       (2500UL * TIMEBASE_TICKS_PER_MS)
+#define SIM_BACKGROUND_LOAD     200U        /* 0.1 % */
+#define SIM_SPIKE_LOAD          950U
+
+/* How the busy time splits over the task tags 1..7, in parts of 16 */
+static const uint8 Sim_TaskParts[CPULOAD_NUMBER_OF_TASKS] = { 0U, 2U, 3U, 1U, 4U, 2U, 3U, 1U };
+
+static const char *Sim_WindowNames[CPULOAD_NUMBER_OF_WINDOWS] = { "1 s", "10 s", "60 s" };
+
+/* Applied load of sample ulSample in 0.1 % */
+static uint32 Sim_AppliedLoad(uint32 ulSample)
+{
+    return ((ulSample >= SIM_SPIKE_START) && (ulSample < SIM_SPIKE_START + SIM_SPIKE_SECONDS)) ? SIM_SPIKE_LOAD : SIM_BACKGROUND_LOAD;
+}
+
+int main(void)
+{
+    uint64 ullTotals[CPULOAD_NUMBER_OF_TASKS] = { 0 };
+    uint64 ullApplied[SIM_SECONDS];          /* Busy ticks of every sample */
+    uint64 ullLengths[SIM_SECONDS];
+    Timebase_TicksType ullNow = 0;
+    CpuLoad_WindowStatsType xStats;
+    uint64 ullBusy;
+    uint64 ullBusySum;
+    uint64 ullLengthSum;
+    uint64 ullElapsed;
+    uint32 ulExpected;
+    uint32 ulSample;
+    uint32 ulBack;
+    uint32 ulShareSum;
+    uint32 ulErrors = 0;
+    uint8 ucWindow;
+    uint8 ucTask;
+
+    srand(1);
+    CpuLoad_Init(ullTotals, ullNow);
+
+    printf("   t  lifetime      1 s     10 s     60 s\n");
+    for (ulSample = 0; ulSample < SIM_SECONDS; ulSample++)
+    {
+        /* A sample is one period give or take the wake-up jitter of the runtime task */
+        ullElapsed = (ulSample == SIM_STARVED_SAMPLE) ? SIM_STARVED_TICKS :
+                     ((uint64)CPULOAD_SAMPLE_PERIOD_MS * TIMEBASE_TICKS_PER_MS) + (uint64)(rand() % 200) - 100U;
+        ullBusy = (ullElapsed * Sim_AppliedLoad(ulSample)) / CPULOAD_FULL_SCALE;
+        for (ucTask = 1; ucTask < CPULOAD_NUMBER_OF_TASKS; ucTask++)
+        {
+            ullTotals[ucTask] += (ullBusy * Sim_TaskParts[ucTask]) / 16U;
+        }
+        ullTotals[CPULOAD_IDLE_TASK] += ullElapsed - ullBusy;
+        ullNow += ullElapsed;
+        ullApplied[ulSample] = ullBusy;
+        ullLengths[ulSample] = (ullElapsed > CPULOAD_MAX_SAMPLE_TICKS) ? CPULOAD_MAX_SAMPLE_TICKS : ullElapsed;
+
+        CpuLoad_Update(ullTotals, ullNow);
+
+        if ((ulSample + 2U >= SIM_SPIKE_START) && (ulSample < SIM_SPIKE_START + 12U))
+        {
+            ullBusySum = 0;
+            for (ucTask = 1; ucTask < CPULOAD_NUMBER_OF_TASKS; ucTask++)
+            {
+                ullBusySum += ullTotals[ucTask];
+            }
+            printf("%4lu  %6.1f %%", (unsigned long)ulSample + 1U, (double)ullBusySum * 100.0 / (double)ullNow);
+            for (ucWindow = 0; ucWindow < CPULOAD_NUMBER_OF_WINDOWS; ucWindow++)
+            {
+                printf("  %5.1f %%", CpuLoad_GetLoad((CpuLoad_WindowType)ucWindow) / 10.0);
+            }
+            printf("\n");
+        }
+
+        /* Every window must match the load applied over its samples within rounding, scaling an
+         * overlong sample keeps its load, and the shares must add up to the whole window */
+        for (ucWindow = 0; ucWindow < CPULOAD_NUMBER_OF_WINDOWS; ucWindow++)
+        {
+            ullBusySum = 0;
+            ullLengthSum = 0;
+            for (ulBack = 0; (ulBack < CpuLoad_WindowSamples[ucWindow]) && (ulBack <= ulSample); ulBack++)
+            {
+                ullBusySum += (ullApplied[ulSample - ulBack] * ullLengths[ulSample - ulBack]) /
+                              ((ulSample - ulBack == SIM_STARVED_SAMPLE) ? SIM_STARVED_TICKS : ullLengths[ulSample - ulBack]);
+                ullLengthSum += ullLengths[ulSample - ulBack];
+            }
+            ulExpected = (uint32)((ullBusySum * CPULOAD_FULL_SCALE + ullLengthSum / 2U) / ullLengthSum);
+
+            CpuLoad_GetWindow((CpuLoad_WindowType)ucWindow, &xStats);
+            ulShareSum = 0;
+            for (ucTask = 0; ucTask < CPULOAD_NUMBER_OF_TASKS; ucTask++)
+            {
+                ulShareSum += xStats.usTaskShare[ucTask];
+            }
+            if ((abs((int)xStats.usLoad - (int)ulExpected) > 1) || (abs((int)ulShareSum - (int)CPULOAD_FULL_SCALE) > CPULOAD_NUMBER_OF_TASKS))
+            {
+                if (ulErrors++ < 10U)
+                {
+                    printf("sample %lu, %s window: load %u, expected %lu, shares add up to %lu\n", (unsigned long)ulSample,
+                           Sim_WindowNames[ucWindow], xStats.usLoad, (unsigned long)ulExpected, (unsigned long)ulShareSum);
+                }
+            }
+        }
+    }
+
+    printf("\npeak load      1 s      10 s      60 s\n         ");
+    for (ucWindow = 0; ucWindow < CPULOAD_NUMBER_OF_WINDOWS; ucWindow++)
+    {
+        CpuLoad_GetWindow((CpuLoad_WindowType)ucWindow, &xStats);
+        printf("  %5.1f %%", xStats.usPeakLoad / 10.0);
+    }
+    printf("\nat t (s)   ");
+    for (ucWindow = 0; ucWindow < CPULOAD_NUMBER_OF_WINDOWS; ucWindow++)
+    {
+        CpuLoad_GetWindow((CpuLoad_WindowType)ucWindow, &xStats);
+        printf("  %7.1f", (double)xStats.ullPeakTime / TIMEBASE_TICKS_PER_SECOND);
+    }
+    printf("\n\n%lu samples, %lu errors\n", (unsigned long)SIM_SECONDS, (unsigned long)ulErrors);
+    return (0U == ulErrors) ? 0 : 1;
+}
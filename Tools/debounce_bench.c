@@ -0,0 +1,229 @@
+/******************************************************************************
+ *
+ * Tool: debounce_bench
+ *
+ * File Name: debounce_bench.c
+ *
+ * Description: Host benchmark of the bit-sliced debounce engine
+ *              (Services/Debounce.c is compiled in unchanged) against a
+ *              per-pin counter debounce doing the same job (4 stable scans,
+ *              press / release / long press events) one pin at a time.
+ *              Reports the cost per scan of 8, 32 and 64 inputs (TSC on x86,
+ *              nanoseconds elsewhere, best of BENCH_ROUNDS rounds) and checks
+ *              that both publish the same events on the same scans.
+ *
+ *              Build: gcc -O2 -I../FreeRTOS_Project_SeatControllerSystem
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Common
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Services
+ *                         -o debounce_bench debounce_bench.c
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "Debounce.c"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_UNIT "cycles"
+static unsigned long long Bench_Now(void)
+{
+    return __rdtsc();
+}
+#else
+#define BENCH_UNIT "ns"
+static unsigned long long Bench_Now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ULL + (unsigned long long)now.tv_nsec;
+}
+#endif
+
+#define BENCH_MAX_INPUTS   (DEBOUNCE_MAX_WORDS * DEBOUNCE_LANES_PER_WORD)
+#define BENCH_SCANS        4096U    /* Recorded input pattern, scans */
+#define BENCH_ROUNDS       50U
+#define BENCH_LONG_SCANS   200U     /* 1 s at 5 ms per scan */
+
+/* Per-pin reference: one counter and one hold count per input */
+typedef struct
+{
+    uint8 aucCount[BENCH_MAX_INPUTS];
+    uint8 aucHold[BENCH_MAX_INPUTS];
+    boolean abState[BENCH_MAX_INPUTS];
+    boolean abLongSent[BENCH_MAX_INPUTS];
+} Bench_PerPinType;
+
+static uint32 Bench_Samples[BENCH_SCANS][DEBOUNCE_MAX_WORDS];
+static volatile uint32 Bench_Sink;
+
+static void Bench_PerPinScan(Bench_PerPinType *pState, uint8 ucInputs, const uint32 *pulSamples, Debounce_EventsType *pEvents)
+{
+    boolean bRaw;
+    uint32 ulMask;
+    uint8 ucWord;
+    uint8 ucPin;
+
+    for (ucWord = 0; ucWord < DEBOUNCE_MAX_WORDS; ucWord++)
+    {
+        pEvents->aulPressed[ucWord] = 0;
+        pEvents->aulReleased[ucWord] = 0;
+        pEvents->aulLongPressed[ucWord] = 0;
+    }
+    for (ucPin = 0; ucPin < ucInputs; ucPin++)
+    {
+        ucWord = DEBOUNCE_LANE_WORD(ucPin);
+        ulMask = DEBOUNCE_LANE_MASK(ucPin);
+        bRaw = (boolean)(0U != (pulSamples[ucWord] & ulMask));
+        if (bRaw == pState->abState[ucPin])
+        {
+            pState->aucCount[ucPin] = 0;
+        }
+        else if (++pState->aucCount[ucPin] >= DEBOUNCE_STABLE_SCANS)
+        {
+            pState->aucCount[ucPin] = 0;
+            pState->abState[ucPin] = bRaw;
+            pState->aucHold[ucPin] = 0;
+            pState->abLongSent[ucPin] = FALSE;
+            if (TRUE == bRaw)
+            {
+                pEvents->aulPressed[ucWord] |= ulMask;
+            }
+            else
+            {
+                pEvents->aulReleased[ucWord] |= ulMask;
+            }
+        }
+        if ((TRUE == pState->abState[ucPin]) && (FALSE == pState->abLongSent[ucPin]) &&
+            (++pState->aucHold[ucPin] == BENCH_LONG_SCANS))
+        {
+            pState->abLongSent[ucPin] = TRUE;
+            pEvents->aulLongPressed[ucWord] |= ulMask;
+        }
+    }
+}
+
+/* Every input flips now and then, with a few scans of bounce, and is held for up to 2 s */
+static void Bench_Generate(void)
+{
+    uint32 aulLevel[DEBOUNCE_MAX_WORDS] = {0};
+    uint32 ulScan;
+    uint32 ulBounce;
+    uint8 ucWord;
+    uint8 ucPin;
+
+    for (ulScan = 0; ulScan < BENCH_SCANS; ulScan++)
+    {
+        for (ucPin = 0; ucPin < BENCH_MAX_INPUTS; ucPin++)
+        {
+            if ((rand() % 300) == 0)
+            {
+                aulLevel[DEBOUNCE_LANE_WORD(ucPin)] ^= DEBOUNCE_LANE_MASK(ucPin);
+            }
+        }
+        for (ucWord = 0; ucWord < DEBOUNCE_MAX_WORDS; ucWord++)
+        {
+            ulBounce = ((rand() % 4) == 0) ? ((uint32)rand() & (uint32)rand() & (uint32)rand()) : 0U;
+            Bench_Samples[ulScan][ucWord] = aulLevel[ucWord] ^ ulBounce;
+        }
+    }
+}
+
+/* Both engines must agree event for event over the whole pattern */
+static boolean Bench_Check(uint8 ucInputs)
+{
+    Debounce_StateType xSliced;
+    Bench_PerPinType xPerPin;
+    Debounce_EventsType xSlicedEvents;
+    Debounce_EventsType xPerPinEvents;
+    uint32 ulScan;
+    uint32 ulMask;
+    uint8 ucWord;
+    uint8 ucWords = (uint8)((ucInputs + DEBOUNCE_LANES_PER_WORD - 1U) / DEBOUNCE_LANES_PER_WORD);
+
+    Debounce_Init(&xSliced, ucWords, BENCH_LONG_SCANS);
+    memset(&xPerPin, 0, sizeof(xPerPin));
+    for (ulScan = 0; ulScan < BENCH_SCANS; ulScan++)
+    {
+        Debounce_Scan(&xSliced, Bench_Samples[ulScan], &xSlicedEvents);
+        Bench_PerPinScan(&xPerPin, ucInputs, Bench_Samples[ulScan], &xPerPinEvents);
+        for (ucWord = 0; ucWord < ucWords; ucWord++)
+        {
+            ulMask = ((ucInputs - (ucWord * DEBOUNCE_LANES_PER_WORD)) >= DEBOUNCE_LANES_PER_WORD)
+                         ? 0xFFFFFFFFUL : ((1UL << (ucInputs % DEBOUNCE_LANES_PER_WORD)) - 1U);
+            if ((((xSlicedEvents.aulPressed[ucWord] ^ xPerPinEvents.aulPressed[ucWord]) |
+                  (xSlicedEvents.aulReleased[ucWord] ^ xPerPinEvents.aulReleased[ucWord]) |
+                  (xSlicedEvents.aulLongPressed[ucWord] ^ xPerPinEvents.aulLongPressed[ucWord])) & ulMask) != 0U)
+            {
+                return FALSE;
+            }
+        }
+    }
+    return TRUE;
+}
+
+static double Bench_Time(uint8 ucInputs, boolean bSliced)
+{
+    Debounce_StateType xSliced;
+    Bench_PerPinType xPerPin;
+    Debounce_EventsType xEvents;
+    unsigned long long ullStart;
+    unsigned long long ullCost;
+    unsigned long long ullBest = ~0ULL;
+    uint32 ulScan;
+    unsigned uRound;
+    uint8 ucWords = (uint8)((ucInputs + DEBOUNCE_LANES_PER_WORD - 1U) / DEBOUNCE_LANES_PER_WORD);
+
+    for (uRound = 0; uRound < BENCH_ROUNDS; uRound++)
+    {
+        Debounce_Init(&xSliced, ucWords, BENCH_LONG_SCANS);
+        memset(&xPerPin, 0, sizeof(xPerPin));
+        ullStart = Bench_Now();
+        for (ulScan = 0; ulScan < BENCH_SCANS; ulScan++)
+        {
+            if (TRUE == bSliced)
+            {
+                Debounce_Scan(&xSliced, Bench_Samples[ulScan], &xEvents);
+            }
+            else
+            {
+                Bench_PerPinScan(&xPerPin, ucInputs, Bench_Samples[ulScan], &xEvents);
+            }
+            Bench_Sink = xEvents.aulPressed[0] ^ xEvents.aulLongPressed[ucWords - 1U];
+        }
+        ullCost = Bench_Now() - ullStart;
+        if (ullCost < ullBest)
+        {
+            ullBest = ullCost;
+        }
+    }
+    return (double)ullBest / BENCH_SCANS;
+}
+
+int main(void)
+{
+    const uint8 aucInputs[] = {8, 32, 64};
+    unsigned uIndex;
+    boolean bMatch = TRUE;
+    boolean bSame;
+
+    srand(1);
+    Bench_Generate();
+
+    printf("inputs  bit-sliced %s/scan  per-pin %s/scan  events match\n", BENCH_UNIT, BENCH_UNIT);
+    for (uIndex = 0; uIndex < sizeof(aucInputs); uIndex++)
+    {
+        bSame = Bench_Check(aucInputs[uIndex]);
+        if (FALSE == bSame)
+        {
+            bMatch = FALSE;
+        }
+        printf("%6u  %17.1f  %14.1f  %s\n", (unsigned)aucInputs[uIndex],
+               Bench_Time(aucInputs[uIndex], TRUE), Bench_Time(aucInputs[uIndex], FALSE),
+               (TRUE == bSame) ? "yes" : "NO");
+    }
+    return (TRUE == bMatch) ? 0 : 1;
+}
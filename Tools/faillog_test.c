@@ -0,0 +1,367 @@
+/******************************************************************************
+ *
+ * Tool: faillog_test
+ *
+ * File Name: faillog_test.c
+ *
+ * Description: Host test of the EEPROM failure journal (Services/FailureLog.c
+ *              is compiled in unchanged) against a model of the EEPROM driver
+ *              kept in a file mapped into memory, so the journal outlives the
+ *              run like the real EEPROM outlives a reset. The model counts the
+ *              writes of every word and can lose power after a given number of
+ *              word writes, refusing every write after it.
+ *
+ *              Every check is made after a reboot: the RAM state of the
+ *              journal is wiped and FailureLog_Init has to find it again in
+ *              the EEPROM. Checked are:
+ *              1. An empty journal, then a few records.
+ *              2. Fills of the journal around every lap boundary and over
+ *                 several laps, newest record first, the oldest overwritten.
+ *              3. A power loss after 0 to 3 of the 4 word writes of a record,
+ *                 in the first lap, in a full journal and at slot 0: the
+ *                 journal ends at the record before, the overwritten record is
+ *                 reported broken and the next record takes the slot.
+ *              4. The EEPROM file unmapped and mapped again.
+ *              It reports the reads of the boot scan and the spread of the
+ *              writes over the words of the journal.
+ *
+ *              Build: gcc -O2 -I../FreeRTOS_Project_SeatControllerSystem
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Common
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Services
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/EEPROM
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/UART
+ *                         -o faillog_test faillog_test.c
+ *              Usage: faillog_test [eeprom file]
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "FailureLog.c"
+
+#define TEST_DEFAULT_FILE    "faillog_eeprom.bin"
+#define TEST_EEPROM_BYTES    (EEPROM_SIZE_WORDS * sizeof(uint32_t))
+#define TEST_NO_POWER_LOSS   (-1)
+
+/* Boot scan reads: slot 0, the last slot when slot 0 is not in use, and a binary search */
+#define TEST_MAX_BOOT_READS  (2U + 7U)
+typedef char Test_BootReadsMatchRecords[(FAILURELOG_NUMBER_OF_RECORDS <= (1U << (TEST_MAX_BOOT_READS - 2U))) ? 1 : -1];
+
+/* EEPROM model, 32-bit words whatever the width of uint32 on the host */
+static const char *Test_FileName;
+static uint32_t *Test_Eeprom;
+static uint32 Test_WordWrites[EEPROM_SIZE_WORDS];
+static uint32 Test_Reads;
+static int Test_WritesBeforePowerLoss = TEST_NO_POWER_LOSS;
+
+/* Every record logged, by sequence, and the sequences whose slot a power loss broke */
+#define TEST_MAX_RECORDS     (4096U)
+static FailureLog_RecordType Test_Logged[TEST_MAX_RECORDS];
+static boolean Test_Broken[TEST_MAX_RECORDS];
+static uint32 Test_Total;               /* Records logged */
+
+static uint32 Test_Failures;
+static uint32 Test_MaxBootReads;
+static uint32 Test_Reboots;
+
+/*******************************************************************************
+ *                          EEPROM driver and UART0 model                      *
+ *******************************************************************************/
+
+Std_ReturnType Eeprom_Init(void)
+{
+    return E_OK;
+}
+
+void Eeprom_ReadWords(uint16 usAddress, uint32 *pData, uint16 usCount)
+{
+    uint16 usIndex;
+
+    Test_Reads++;
+    for (usIndex = 0; usIndex < usCount; usIndex++)
+    {
+        pData[usIndex] = Test_Eeprom[usAddress + usIndex];
+    }
+}
+
+Std_ReturnType Eeprom_WriteWord(uint16 usAddress, uint32 ulData)
+{
+    if (0 == Test_WritesBeforePowerLoss)
+    {
+        return E_NOT_OK;
+    }
+    if (Test_WritesBeforePowerLoss > 0)
+    {
+        Test_WritesBeforePowerLoss--;
+    }
+    Test_Eeprom[usAddress] = (uint32_t)ulData;
+    Test_WordWrites[usAddress]++;
+    return E_OK;
+}
+
+void UART0_SendString(const uint8 *pData)
+{
+    fputs((const char *)pData, stdout);
+}
+
+void UART0_SendInteger(sint64 sNumber)
+{
+    printf("%lld", (long long)sNumber);
+}
+
+/*******************************************************************************
+ *                                 Test helpers                                *
+ *******************************************************************************/
+
+/* Map the EEPROM file, bErase starts it like a new device */
+static void Test_Map(boolean bErase)
+{
+    int file = open(Test_FileName, O_RDWR | O_CREAT, 0644);
+    uint32 ulIndex;
+
+    if ((file < 0) || (0 != ftruncate(file, TEST_EEPROM_BYTES)))
+    {
+        perror(Test_FileName);
+        exit(2);
+    }
+    Test_Eeprom = (uint32_t *)mmap(NULL, TEST_EEPROM_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    close(file);
+    if (MAP_FAILED == (void *)Test_Eeprom)
+    {
+        perror("mmap");
+        exit(2);
+    }
+    if (TRUE == bErase)
+    {
+        for (ulIndex = 0; ulIndex < EEPROM_SIZE_WORDS; ulIndex++)
+        {
+            Test_Eeprom[ulIndex] = (uint32_t)EEPROM_ERASED_WORD;
+        }
+    }
+}
+
+static void Test_Unmap(void)
+{
+    msync(Test_Eeprom, TEST_EEPROM_BYTES, MS_SYNC);
+    munmap(Test_Eeprom, TEST_EEPROM_BYTES);
+    Test_Eeprom = NULL;
+}
+
+static void Test_Fail(const char *pWhat, uint32 ulValue)
+{
+    printf("FAIL after %lu records: %s (%lu)\n", (unsigned long)Test_Total, pWhat, (unsigned long)ulValue);
+    Test_Failures++;
+}
+
+/* Lose the RAM state and find the journal again */
+static void Test_Reboot(void)
+{
+    FailureLog_NextSequence = 0x5A5AUL;
+    FailureLog_Count = 0xA5A5UL;
+    Test_WritesBeforePowerLoss = TEST_NO_POWER_LOSS;
+    Test_Reads = 0;
+    FailureLog_Init();
+    Test_Reboots++;
+    if (Test_Reads > Test_MaxBootReads)
+    {
+        Test_MaxBootReads = Test_Reads;
+    }
+    if (Test_Reads > TEST_MAX_BOOT_READS)
+    {
+        Test_Fail("boot scan reads", Test_Reads);
+    }
+}
+
+/* The journal holds the last records logged, newest first, and reports the broken ones */
+static void Test_Check(void)
+{
+    FailureLog_RecordType xRecord;
+    uint32 ulExpected = (Test_Total < FAILURELOG_NUMBER_OF_RECORDS) ? Test_Total : FAILURELOG_NUMBER_OF_RECORDS;
+    uint32 ulIndex;
+    uint32 ulSequence;
+    const FailureLog_RecordType *pLogged;
+
+    if (FailureLog_GetCount() != ulExpected)
+    {
+        Test_Fail("record count", FailureLog_GetCount());
+        return;
+    }
+    for (ulIndex = 0; ulIndex < ulExpected; ulIndex++)
+    {
+        ulSequence = Test_Total - 1U - ulIndex;
+        pLogged = &Test_Logged[ulSequence];
+        if (E_OK != FailureLog_Read(ulIndex, &xRecord))
+        {
+            if (FALSE == Test_Broken[ulSequence])
+            {
+                Test_Fail("record lost", ulSequence);
+            }
+        }
+        else if (TRUE == Test_Broken[ulSequence])
+        {
+            Test_Fail("broken record read back", ulSequence);
+        }
+        else if ((xRecord.ulSequence != ulSequence) || (xRecord.ullTimestamp != pLogged->ullTimestamp) ||
+                 (xRecord.usAdcValue != pLogged->usAdcValue) || (xRecord.ucSeat != pLogged->ucSeat) ||
+                 (xRecord.ucCode != pLogged->ucCode) || (xRecord.ucLevel != pLogged->ucLevel))
+        {
+            Test_Fail("record differs", ulSequence);
+        }
+    }
+    if (E_NOT_OK != FailureLog_Read(ulExpected, &xRecord))
+    {
+        Test_Fail("read past the count", ulExpected);
+    }
+}
+
+static void Test_MakeRecord(FailureLog_RecordType *pRecord)
+{
+    pRecord->ullTimestamp = ((uint64)rand() << 20) ^ (uint64)rand();
+    pRecord->usAdcValue = (uint16)(rand() % 4096);
+    pRecord->ucSeat = (uint8)(rand() % 2);
+    pRecord->ucCode = (uint8)((rand() % 2) + FAILURELOG_CODE_SENSOR_LOW);
+    pRecord->ucLevel = (uint8)((rand() % 4) + 1);
+}
+
+/* Log records until Test_Total reaches ulTotal */
+static void Test_AppendUpTo(uint32 ulTotal)
+{
+    FailureLog_RecordType xRecord;
+
+    while (Test_Total < ulTotal)
+    {
+        Test_MakeRecord(&xRecord);
+        if (E_OK != FailureLog_Append(&xRecord))
+        {
+            Test_Fail("append", Test_Total);
+        }
+        if (xRecord.ulSequence != Test_Total)
+        {
+            Test_Fail("sequence", xRecord.ulSequence);
+        }
+        Test_Logged[Test_Total] = xRecord;
+        Test_Broken[Test_Total] = FALSE;
+        Test_Total++;
+    }
+}
+
+/* Lose power after ulWrites word writes of the next record, then reboot */
+static void Test_PowerLoss(uint32 ulWrites)
+{
+    FailureLog_RecordType xRecord;
+    uint32 ulOverwritten = Test_Total - FAILURELOG_NUMBER_OF_RECORDS;
+
+    Test_MakeRecord(&xRecord);
+    Test_WritesBeforePowerLoss = (int)ulWrites;
+    if (E_OK == FailureLog_Append(&xRecord))
+    {
+        Test_Fail("append with no power", ulWrites);
+    }
+
+    /* The record of the slot is gone once one of its words is written, the sequence is written last */
+    if ((Test_Total >= FAILURELOG_NUMBER_OF_RECORDS) && (ulWrites > 0U))
+    {
+        Test_Broken[ulOverwritten] = TRUE;
+    }
+    Test_Reboot();
+    Test_Check();
+}
+
+/*******************************************************************************
+ *                                     Main                                    *
+ *******************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    static const uint32 aFills[] = {127U, 128U, 129U, 130U, 255U, 256U, 257U, 3U * 128U + 7U, 1000U};
+    uint32 ulWrites;
+    uint32 ulFill;
+    uint32 ulWord;
+    uint32 ulMin = 0xFFFFFFFFUL;
+    uint32 ulMax = 0;
+    uint32 ulTorn = 0;
+
+    Test_FileName = (argc > 1) ? argv[1] : TEST_DEFAULT_FILE;
+    srand(1);
+    Test_Map(TRUE);
+
+    /* 1. Empty, then a few records */
+    Test_Reboot();
+    Test_Check();
+    Test_AppendUpTo(5U);
+    Test_Reboot();
+    Test_Check();
+
+    /* 3. Power losses in the first lap, where the next slot is erased */
+    for (ulWrites = 0; ulWrites < FAILURELOG_WORDS_PER_RECORD; ulWrites++)
+    {
+        Test_PowerLoss(ulWrites);
+        ulTorn++;
+        Test_AppendUpTo(Test_Total + 1U);
+        Test_Reboot();
+        Test_Check();
+    }
+
+    /* 2. Fills around the lap boundaries and over several laps */
+    for (ulFill = 0; ulFill < (sizeof(aFills) / sizeof(aFills[0])); ulFill++)
+    {
+        Test_AppendUpTo(aFills[ulFill]);
+        Test_Reboot();
+        Test_Check();
+    }
+
+    /* 3. Power losses in a full journal, then at slot 0 */
+    for (ulWrites = 0; ulWrites < FAILURELOG_WORDS_PER_RECORD; ulWrites++)
+    {
+        Test_AppendUpTo(Test_Total + 3U);
+        Test_PowerLoss(ulWrites);
+        ulTorn++;
+        Test_AppendUpTo(Test_Total + 1U);
+        Test_Reboot();
+        Test_Check();
+    }
+    for (ulWrites = 0; ulWrites < FAILURELOG_WORDS_PER_RECORD; ulWrites++)
+    {
+        Test_AppendUpTo(((Test_Total / FAILURELOG_NUMBER_OF_RECORDS) + 1U) * FAILURELOG_NUMBER_OF_RECORDS);
+        Test_PowerLoss(ulWrites);
+        ulTorn++;
+        Test_AppendUpTo(Test_Total + 1U);
+        Test_Reboot();
+        Test_Check();
+    }
+
+    /* 4. The journal comes back from the file */
+    Test_AppendUpTo(Test_Total + 17U);
+    Test_Unmap();
+    Test_Map(FALSE);
+    Test_Reboot();
+    Test_Check();
+
+    for (ulWord = 0; ulWord < FAILURELOG_NUMBER_OF_BLOCKS * EEPROM_WORDS_PER_BLOCK; ulWord++)
+    {
+        ulWrites = Test_WordWrites[FAILURELOG_FIRST_WORD + ulWord];
+        ulMin = (ulWrites < ulMin) ? ulWrites : ulMin;
+        ulMax = (ulWrites > ulMax) ? ulWrites : ulMax;
+    }
+    /* Each word is written once a lap, a torn record writes some of its words once more */
+    if ((ulMax - ulMin) > (1U + ulTorn))
+    {
+        Test_Fail("uneven wear", ulMax - ulMin);
+    }
+
+    printf("records logged %lu, journal %lu records, %lu reboots\n", (unsigned long)Test_Total,
+           (unsigned long)FAILURELOG_NUMBER_OF_RECORDS, (unsigned long)Test_Reboots);
+    printf("boot scan: at most %lu record reads (one per slot would be %lu)\n", (unsigned long)Test_MaxBootReads,
+           (unsigned long)FAILURELOG_NUMBER_OF_RECORDS);
+    printf("wear: %lu to %lu writes per word, %lu power losses\n", (unsigned long)ulMin, (unsigned long)ulMax,
+           (unsigned long)ulTorn);
+    Test_Unmap();
+
+    printf("%s: %lu failures\n", (0U == Test_Failures) ? "PASS" : "FAIL", (unsigned long)Test_Failures);
+    return (0U == Test_Failures) ? 0 : 1;
+}
@@ -0,0 +1,1593 @@
+/******************************************************************************
+ *
+ * Tool: firmware_sim
+ *
+ * File Name: firmware_sim.c
+ *
+ * Description: Runs the whole firmware on the Linux host in virtual time:
+ *              main.c, the FreeRTOS kernel on the host simulation port
+ *              (FreeRTOS/Source/portable/GCC/HostSim), the MCAL drivers, the
+ *              HAL and the services, all compiled unchanged with
+ *              TM4C_HOST_SIM. This file is the board they run on. It sits in
+ *              front of the emulated peripheral block (MCAL/hw_sim.c) and owns
+ *              the clock, counted in system clocks at 16 MHz.
+ *
+ *              Every register access costs BOARD_ACCESS_CLOCKS and is an
+ *              instruction boundary: the clock moves on, the peripheral events
+ *              that fell due are applied, and the interrupts the emulated NVIC
+ *              asserts preempt the running code by priority. A sleep (WFI)
+ *              jumps the clock to the next event, so the run costs host time
+ *              only for what the firmware executes: two hours of seat heating
+ *              take seconds, the same every run. Modelled are:
+ *              - SysTick with PENDSTSET/PENDSTCLR, for the tick and the
+ *                tickless idle of LowPower.c
+ *              - the NVIC enables and priorities of the handlers below
+ *              - WTimer0 (Timebase), WTimer1 (tickless wake-up) and Timer2
+ *                (ADC trigger) counting down from their load and prescaler
+ *              - ADC0 sequencer 0, processor or timer triggered, 16 clocks per
+ *                sample times the hardware averaging, the results in its FIFO
+ *              - UART0 at the programmed baud rate with its 16-byte transmit
+ *                FIFO and trigger level interrupt, keys into the receive FIFO
+ *              - the Port F buttons with contact bounce and their edge
+ *                interrupts
+ *              - the EEPROM words and the busy time of a write
+ *              Each seat is a first-order thermal model heated by the duty of
+ *              its PWM timer and read by its LM35 on the ADC.
+ *
+ *              A register is read at its access and written by the driver
+ *              after Sim_PeripheralAddress returned, so the board presents the
+ *              value of a register at its access and takes the write at the
+ *              next one: a word that differs from the presented value was
+ *              written. The few registers a read changes (UARTDR, SSFIFO0)
+ *              present values a write cannot repeat.
+ *
+ *              The script presses SW1 three times (driver 35 C) and SW2 once
+ *              (passenger 25 C), SW2 again at 40 min (30 C), opens the
+ *              passenger sensor for a minute at 60 min, switches the driver
+ *              off with a long press at 90 min and sends the failure journal
+ *              key at 115 min. Checked are:
+ *              1. Both seats settle within BOARD_TEMP_TOLERANCE of their
+ *                 setpoint, and the firmware reads the seat temperature.
+ *              2. The open sensor is a failure: heater off, fault LED on, one
+ *                 SENSOR_LOW record in the EEPROM journal, LED off again once
+ *                 the sensor is back.
+ *              3. The long press switches the driver heater off.
+ *              4. The journal dump reaches UART0, with no record dropped or
+ *                 lost on the way to the EEPROM.
+ *              5. After two hours of tickless idle the kernel tick is no more
+ *                 than BOARD_TICKLESS_LAG_CLOCKS per sleep behind the clock.
+ *              It prints the seats every BOARD_REPORT_MINUTES, the interrupt
+ *              and sleep counts and how much faster than real time it ran.
+ *              -u copies the UART0 output to stdout.
+ *
+ *              Build: gcc -O2 -DTM4C_HOST_SIM
+ *                         -I../FreeRTOS_Project_SeatControllerSystem
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Common
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/PORT
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/DIO
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/ADC
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/GPTM
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/PWM
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/UART
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/EEPROM
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/HAL
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Services
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/FreeRTOS/Source/include
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/FreeRTOS/Source/portable/GCC/HostSim
+ *                         firmware_sim.c
+ *                         ../FreeRTOS_Project_SeatControllerSystem/FreeRTOS/Source/[a-z]*.c
+ *                         ../FreeRTOS_Project_SeatControllerSystem/FreeRTOS/Source/portable/MemMang/heap_2.c
+ *                         ../FreeRTOS_Project_SeatControllerSystem/FreeRTOS/Source/portable/MemMang/heap_tlsf.c
+ *                         ../FreeRTOS_Project_SeatControllerSystem/FreeRTOS/Source/portable/GCC/HostSim/port.c
+ *                         ../FreeRTOS_Project_SeatControllerSystem/MCAL/PORT/Port.c
+ *                         ../FreeRTOS_Project_SeatControllerSystem/MCAL/PORT/Port_PBcfg.c
+ *                         ../FreeRTOS_Project_SeatControllerSystem/MCAL/DIO/Dio.c
+ *                         ../FreeRTOS_Project_SeatControllerSystem/MCAL/DIO/Dio_PBcfg.c
+ *                         ../FreeRTOS_Project_SeatControllerSystem/MCAL/ADC/adc.c
+ *                         ../FreeRTOS_Project_SeatControllerSystem/MCAL/GPTM/GPTM.c
+ *                         ../FreeRTOS_Project_SeatControllerSystem/MCAL/PWM/PWM.c
+ *                         ../FreeRTOS_Project_SeatControllerSystem/MCAL/UART/uart0.c
+ *                         ../FreeRTOS_Project_SeatControllerSystem/MCAL/EEPROM/Eeprom.c
+ *                         ../FreeRTOS_Project_SeatControllerSystem/HAL/[A-Za-z]*.c
+ *                         ../FreeRTOS_Project_SeatControllerSystem/Services/[A-Z]*.c
+ *                         -o firmware_sim
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* hw_sim.c backs the registers, the board sits in front of it */
+#define Sim_PeripheralAddress Sim_PageAddress
+#include "hw_sim.c"
+#undef Sim_PeripheralAddress
+volatile uint32 * Sim_PeripheralAddress(uint32 address);
+
+/* The firmware, its main() becomes Firmware_Main() */
+#define main Firmware_Main
+#include "main.c"
+#undef main
+
+/* Vector table entries without a header, as in tm4c123gh6pm_startup_ccs.c */
+extern void xPortSysTickHandler(void);
+extern void GPIOPortF_Handler(void);
+
+#define BOARD_CLOCK_HZ              (16000000ULL)
+#define BOARD_MS(ms)                ((uint64)(ms) * (BOARD_CLOCK_HZ / 1000ULL))
+#define BOARD_MIN(min)              ((uint32)(min) * 60000UL)     /* Script times are in ms */
+#define BOARD_CLOCKS_PER_TICK       (BOARD_CLOCK_HZ / configTICK_RATE_HZ)
+#define BOARD_NEVER                 (0xFFFFFFFFFFFFFFFFULL)
+#define BOARD_RUN_MINUTES           (120U)
+#define BOARD_REPORT_MINUTES        (10U)
+
+/* Clocks charged to the firmware, it executes in no time between them */
+#define BOARD_ACCESS_CLOCKS         (4U)        /* Per register access */
+#define BOARD_EXCEPTION_CLOCKS      (24U)       /* Exception entry and return */
+#define BOARD_IDLE_LOOP_CLOCKS      (64U)       /* One turn of the idle task that does not sleep */
+
+/* The tickless idle restarts the SysTick a few register accesses further after reading the
+ * timebase than it stopped it, the kernel tick falls behind by those clocks on every sleep */
+#define BOARD_TICKLESS_LAG_CLOCKS   (8U * BOARD_ACCESS_CLOCKS)
+
+/* Core peripherals */
+#define BOARD_CORE_PAGE             (0xE000E000UL)
+#define BOARD_SYSTICK_CTRL          (0x010U)
+#define BOARD_SYSTICK_RELOAD        (0x014U)
+#define BOARD_SYSTICK_CURRENT       (0x018U)
+#define BOARD_NVIC_EN0              (0x100U)
+#define BOARD_NVIC_DIS0             (0x180U)
+#define BOARD_NVIC_PRI0             (0x400U)
+#define BOARD_NVIC_REGISTERS        (4U)
+#define BOARD_ICSR                  (0xD04U)
+#define BOARD_SHPR3                 (0xD20U)
+#define BOARD_SYSTICK_ENABLE        (1UL << 0)
+#define BOARD_SYSTICK_TICKINT       (1UL << 1)
+#define BOARD_ICSR_PENDSTSET        (1UL << 26)
+#define BOARD_ICSR_PENDSTCLR        (1UL << 25)
+#define BOARD_PRIORITY_MASK         (0xE0U)     /* 3 priority bits */
+
+/* GPTM */
+#define BOARD_GPTM_TAMR             (0x004U)
+#define BOARD_GPTM_CTL              (0x00CU)
+#define BOARD_GPTM_IMR              (0x018U)
+#define BOARD_GPTM_RIS              (0x01CU)
+#define BOARD_GPTM_MIS              (0x020U)
+#define BOARD_GPTM_ICR              (0x024U)
+#define BOARD_GPTM_TAILR            (0x028U)
+#define BOARD_GPTM_TAPR             (0x038U)
+#define BOARD_GPTM_TAR              (0x048U)
+#define BOARD_GPTM_TAEN             (1UL << 0)
+#define BOARD_GPTM_TAOTE            (1UL << 5)
+#define BOARD_GPTM_PERIODIC         (0x2U)
+#define BOARD_WTIMER0               (0U)
+#define BOARD_WTIMER1               (1U)
+#define BOARD_TIMER2                (2U)
+#define BOARD_NUMBER_OF_TIMERS      (3U)
+
+/* ADC0 */
+#define BOARD_ADC0_PAGE             (0x40038000UL)
+#define BOARD_ADC_ACTSS             (0x000U)
+#define BOARD_ADC_RIS               (0x004U)
+#define BOARD_ADC_IM                (0x008U)
+#define BOARD_ADC_ISC               (0x00CU)
+#define BOARD_ADC_EMUX              (0x014U)
+#define BOARD_ADC_PSSI              (0x028U)
+#define BOARD_ADC_SAC               (0x030U)
+#define BOARD_ADC_SSMUX0            (0x040U)
+#define BOARD_ADC_SSCTL0            (0x044U)
+#define BOARD_ADC_SSFIFO0           (0x048U)
+#define BOARD_ADC_FIFO_SIZE         (8U)
+#define BOARD_ADC_CLOCKS_PER_SAMPLE (16U)       /* 1 Msps */
+#define BOARD_ADC_TRIGGER_PROCESSOR (0x0U)
+#define BOARD_ADC_TRIGGER_TIMER     (0x5U)
+
+/* UART0 */
+#define BOARD_UART0_PAGE            (0x4000C000UL)
+#define BOARD_UART_DR               (0x000U)
+#define BOARD_UART_FR               (0x018U)
+#define BOARD_UART_IBRD             (0x024U)
+#define BOARD_UART_FBRD             (0x028U)
+#define BOARD_UART_CTL              (0x030U)
+#define BOARD_UART_IFLS             (0x034U)
+#define BOARD_UART_IM               (0x038U)
+#define BOARD_UART_RIS              (0x03CU)
+#define BOARD_UART_MIS              (0x040U)
+#define BOARD_UART_ICR              (0x044U)
+#define BOARD_UART_FIFO_SIZE        (16U)
+#define BOARD_UART_FR_BUSY          (0x08U)
+#define BOARD_UART_DR_READ          (0xFFFFF000UL) /* Above any byte a driver writes */
+#define BOARD_UART_LINE_SIZE        (128U)
+
+/* GPIO */
+#define BOARD_GPIOA_PAGE            (0x40004000UL)
+#define BOARD_GPIOF_PAGE            (0x40025000UL)
+#define BOARD_GPIO_DATA             (0x3FCU)
+#define BOARD_GPIO_DIR              (0x400U)
+#define BOARD_GPIO_IS               (0x404U)
+#define BOARD_GPIO_IBE              (0x408U)
+#define BOARD_GPIO_IEV              (0x40CU)
+#define BOARD_GPIO_IM               (0x410U)
+#define BOARD_GPIO_RIS              (0x414U)
+#define BOARD_GPIO_MIS              (0x418U)
+#define BOARD_GPIO_ICR              (0x41CU)
+#define BOARD_SW1                   (1U << DioConf_SW1_CHANNEL_NUM)
+#define BOARD_SW2                   (1U << DioConf_SW2_CHANNEL_NUM)
+#define BOARD_PIN_EVENTS            (32U)
+
+/* EEPROM */
+#define BOARD_EEPROM_PAGE           (0x400AF000UL)
+#define BOARD_EEPROM_EEBLOCK        (0x004U)
+#define BOARD_EEPROM_EEOFFSET       (0x008U)
+#define BOARD_EEPROM_EERDWR         (0x010U)
+#define BOARD_EEPROM_EEDONE         (0x018U)
+#define BOARD_EEPROM_WRITE_CLOCKS   (1760U)     /* 110 us per word */
+
+/* Seat heating: ambient, heater rise at 100 % duty and time constant */
+#define BOARD_AMBIENT_C             (15.0)
+#define BOARD_HEATER_RISE_C         (24.0)
+#define BOARD_SEAT_TAU_S            (90.0)
+#define BOARD_PLANT_STEP_MS         (100U)
+#define BOARD_SENSOR_NOISE_LSB      (2)
+#define BOARD_TEMP_TOLERANCE_C      (1.0)
+
+/* Emulated interrupt lines, in exception number order so the lower one wins a priority tie */
+#define BOARD_LINE_SYSTICK          (0U)
+#define BOARD_LINE_UART0            (1U)
+#define BOARD_LINE_ADC0             (2U)
+#define BOARD_LINE_GPIOF            (3U)
+#define BOARD_LINE_WTIMER0          (4U)
+#define BOARD_LINE_WTIMER1          (5U)
+#define BOARD_NUMBER_OF_LINES       (6U)
+#define BOARD_NO_IRQ                (0xFFFFFFFFUL)
+
+typedef struct
+{
+    uint32 ulIrq;                     /* NVIC interrupt number, BOARD_NO_IRQ for the SysTick */
+    void (*pHandler)(void);
+    const char *pName;
+    uint32 ulTaken;
+} Board_LineType;
+
+typedef struct
+{
+    uint32 ulBase;
+    const char *pName;
+    boolean bRunning;
+    boolean bPeriodic;
+    uint32 ulLoad;
+    uint32 ulClocksPerCount;          /* Prescaler + 1 */
+    uint64 ullStart;                  /* Clock the load was counted from */
+    uint64 ullTimeout;                /* Clock the count reaches 0 */
+    uint32 ulStopped;                 /* Count while stopped */
+    uint32 ulRis;
+} Board_TimerType;
+
+typedef struct
+{
+    uint32 ulCtl;                     /* CTL address and enable bit of the PWM timer */
+    uint32 ulEnable;
+    uint32 ulLoad;                    /* TnILR and TnMATCHR addresses */
+    uint32 ulMatch;
+} Board_HeaterType;
+
+typedef struct
+{
+    uint32 ulData;                    /* GPIODATA address and pin of the LED */
+    uint32 ulPin;
+} Board_LedType;
+
+typedef struct
+{
+    double dTemp;                     /* C */
+    boolean bOpen;                    /* Sensor disconnected, reads 0 */
+} Board_SeatType;
+
+typedef struct
+{
+    uint64 ullTime;
+    uint8 ucPins;
+    uint8 ucLevel;
+} Board_PinEventType;
+
+typedef enum
+{
+    BOARD_PRESS, BOARD_SENSOR_OPEN, BOARD_SENSOR_CLOSE, BOARD_KEY, BOARD_CHECK, BOARD_END
+} Board_ActionType;
+
+typedef struct
+{
+    uint32 ulTimeMs;
+    Board_ActionType eAction;
+    uint32 ulArg;                     /* Pins, seat, key or check */
+    uint32 ulHoldMs;                  /* BOARD_PRESS */
+} Board_StepType;
+
+/* The drive of the run. Presses bounce (see Board_Press), a press longer than
+ * BUTTON_LONG_PRESS_MS is a long press */
+static const Board_StepType Board_Script[] =
+{
+    {             1000U, BOARD_PRESS,        BOARD_SW1,  150U },  /* Driver LOW */
+    {             1500U, BOARD_PRESS,        BOARD_SW1,  150U },  /* MEDIUM */
+    {             2000U, BOARD_PRESS,        BOARD_SW1,  150U },  /* HIGH, 35 C */
+    {             2500U, BOARD_PRESS,        BOARD_SW2,  150U },  /* Passenger LOW, 25 C */
+    { BOARD_MIN(39),     BOARD_CHECK,        1U,           0U },
+    { BOARD_MIN(40),     BOARD_PRESS,        BOARD_SW2,  150U },  /* Passenger MEDIUM, 30 C */
+    { BOARD_MIN(59),     BOARD_CHECK,        2U,           0U },
+    { BOARD_MIN(60),     BOARD_SENSOR_OPEN,  1U,           0U },
+    { BOARD_MIN(60) + 30000U, BOARD_CHECK,   3U,           0U },
+    { BOARD_MIN(61),     BOARD_SENSOR_CLOSE, 1U,           0U },
+    { BOARD_MIN(62),     BOARD_CHECK,        4U,           0U },
+    { BOARD_MIN(90),     BOARD_PRESS,        BOARD_SW1, 1500U },  /* Long press, driver off */
+    { BOARD_MIN(91),     BOARD_CHECK,        5U,           0U },
+    { BOARD_MIN(115),    BOARD_KEY,          DASHBOARD_FAILURE_LOG_KEY, 0U },
+    { BOARD_MIN(116),    BOARD_KEY,          ' ',          0U },  /* Back to the dashboard */
+    { BOARD_MIN(BOARD_RUN_MINUTES), BOARD_END, 0U,         0U }
+};
+#define BOARD_SCRIPT_STEPS          (sizeof(Board_Script) / sizeof(Board_Script[0]))
+
+/* Where the PWM (PWM.c) and the fault LEDs (Dio_Cfg.h) of the seats of Seat_PBcfg.c are */
+static const Board_HeaterType Board_Heaters[NUMBER_OF_SEATS] =
+{
+    { 0x4003100CUL, 1UL << 8, 0x4003102CUL, 0x40031034UL },  /* Driver: Timer1B on PF3 */
+    { 0x4003000CUL, 1UL << 0, 0x40030028UL, 0x40030030UL }   /* Passenger: Timer0A on PB6 */
+};
+static const Board_LedType Board_FaultLeds[NUMBER_OF_SEATS] =
+{
+    { BOARD_GPIOF_PAGE + BOARD_GPIO_DATA, 1UL << DioConf_RED_LED_CHANNEL_NUM },
+    { BOARD_GPIOA_PAGE + BOARD_GPIO_DATA, 1UL << DioConf_RED_LED_OUT_CHANNEL_NUM }
+};
+static const uint8 Board_ScanChannels[ADC0_NUMBER_OF_CHANNELS] = ADC0_SCAN_CHANNELS;
+
+/* Clock and register accesses */
+static uint64 Board_Now;                      /* System clocks since reset */
+static uint64 Board_Accesses;
+static volatile uint32 *Board_PendingWord;    /* Register of the last access, its write is taken at the next */
+static uint32 Board_PendingAddress;
+static uint32 Board_PendingValue;
+static boolean Board_Finished = FALSE;        /* Checks done, the registers stop moving */
+
+/* Core */
+static boolean Board_SysTickRunning;
+static uint64 Board_SysTickZero;              /* Clock the counter reaches 0 */
+static uint32 Board_SysTickStopped;
+static boolean Board_SysTickPending;
+static uint64 Board_TickStart = BOARD_NEVER;  /* First SysTick enable, by the scheduler */
+static uint32 Board_NvicEnabled[BOARD_NVIC_REGISTERS];
+static Board_LineType Board_Lines[BOARD_NUMBER_OF_LINES] =
+{
+    { BOARD_NO_IRQ, xPortSysTickHandler, "SysTick", 0U },
+    { UART0_INTERRUPT_NUMBER, UART0_Handler, "UART0", 0U },
+    { ADC0_SS0_INTERRUPT_NUMBER, ADC0_Seq0_Handler, "ADC0SS0", 0U },
+    { BUTTON_PORTF_INTERRUPT_NUMBER, GPIOPortF_Handler, "GPIOF", 0U },
+    { GPTM_WTIMER0A_INTERRUPT_NUMBER, WTimer0A_Handler, "WTimer0A", 0U },
+    { GPTM_WTIMER1A_INTERRUPT_NUMBER, WTimer1A_Handler, "WTimer1A", 0U }
+};
+
+/* Timers */
+static Board_TimerType Board_Timers[BOARD_NUMBER_OF_TIMERS] =
+{
+    { 0x40036000UL, "WTimer0", FALSE, FALSE, 0U, 1U, 0U, 0U, 0U, 0U },
+    { 0x40037000UL, "WTimer1", FALSE, FALSE, 0U, 1U, 0U, 0U, 0U, 0U },
+    { 0x40032000UL, "Timer2", FALSE, FALSE, 0U, 1U, 0U, 0U, 0U, 0U }
+};
+
+/* ADC0 sequencer 0 */
+static boolean Board_AdcBusy;
+static uint64 Board_AdcDone;
+static uint16 Board_AdcFifo[BOARD_ADC_FIFO_SIZE];
+static uint32 Board_AdcFifoHead;
+static uint32 Board_AdcFifoLevel;
+static uint32 Board_AdcRis;
+static uint32 Board_AdcScans;
+static uint32 Board_AdcLostTriggers;          /* Trigger while converting */
+static uint32 Board_NoiseSeed = 12345U;
+
+/* UART0 */
+static uint8 Board_UartTx[BOARD_UART_FIFO_SIZE];
+static uint32 Board_UartTxHead;
+static uint32 Board_UartTxLevel;
+static boolean Board_UartShifting;
+static uint8 Board_UartShiftByte;
+static uint64 Board_UartShiftDone;
+static uint8 Board_UartRx[BOARD_UART_FIFO_SIZE];
+static uint32 Board_UartRxHead;
+static uint32 Board_UartRxLevel;
+static uint32 Board_UartRis;
+static uint64 Board_UartBytes;
+static uint32 Board_UartOverruns;             /* UARTDR written with the FIFO full */
+static boolean Board_UartEcho = FALSE;
+static char Board_UartLine[BOARD_UART_LINE_SIZE];
+static char Board_UartPreviousLine[BOARD_UART_LINE_SIZE];
+static uint32 Board_UartLineLength;
+static boolean Board_UartJournalSeen;
+static char Board_UartJournalErrors[BOARD_UART_LINE_SIZE]; /* Line after "queue_drops,write_errors" */
+
+/* Port F buttons, pulled up, pressed low */
+static uint8 Board_ButtonLevels = BOARD_SW1 | BOARD_SW2;
+static uint32 Board_GpioRis;
+static Board_PinEventType Board_PinEvents[BOARD_PIN_EVENTS];
+static uint32 Board_PinEventCount;
+
+/* EEPROM */
+static uint32 Board_EepromWords[EEPROM_SIZE_WORDS];
+static uint64 Board_EepromBusyUntil;
+static uint32 Board_EepromWrites;
+
+/* Seats, script and results */
+static Board_SeatType Board_Seats[NUMBER_OF_SEATS];
+static uint64 Board_NextPlantStep;
+static uint64 Board_NextReport;
+static uint32 Board_Step;
+static boolean Board_EndDue = FALSE;
+static uint64 Board_Sleeps;
+static uint64 Board_SleepClocks;
+static uint32 Board_Failures;
+static struct timespec Board_HostStart;
+
+static void Board_Expect(const char *pName, boolean bOk)
+{
+    if (FALSE == bOk)
+    {
+        printf("FAIL %s (at %.3f s)\n", pName, (double)Board_Now / (double)BOARD_CLOCK_HZ);
+        Board_Failures++;
+    }
+}
+
+static volatile uint32 * Board_Word(uint32 address)
+{
+    return Sim_PageAddress(address);
+}
+
+static uint64 Board_Min(uint64 ullA, uint64 ullB)
+{
+    return (ullA < ullB) ? ullA : ullB;
+}
+
+/*******************************************************************************
+ *                                  SysTick                                    *
+ *******************************************************************************/
+
+static uint32 Board_SysTickCount(void)
+{
+    return (TRUE == Board_SysTickRunning) ? (uint32)(Board_SysTickZero - Board_Now) : Board_SysTickStopped;
+}
+
+static uint32 Board_SysTickReload(void)
+{
+    return *Board_Word(BOARD_CORE_PAGE + BOARD_SYSTICK_RELOAD) & 0x00FFFFFFUL;
+}
+
+static void Board_SysTickControl(uint32 ulOld, uint32 ulNew)
+{
+    if ((0U == (ulOld & BOARD_SYSTICK_ENABLE)) && (0U != (ulNew & BOARD_SYSTICK_ENABLE)))
+    {
+        /* A cleared counter loads the reload value on the next clock */
+        Board_SysTickZero = Board_Now + ((0U == Board_SysTickStopped) ? (1ULL + Board_SysTickReload()) : Board_SysTickStopped);
+        Board_SysTickRunning = TRUE;
+        if (BOARD_NEVER == Board_TickStart)
+        {
+            Board_TickStart = Board_Now;
+        }
+    }
+    else if ((0U != (ulOld & BOARD_SYSTICK_ENABLE)) && (0U == (ulNew & BOARD_SYSTICK_ENABLE)))
+    {
+        Board_SysTickStopped = Board_SysTickCount();
+        Board_SysTickRunning = FALSE;
+    }
+    else
+    {
+        /* Enable unchanged */
+    }
+}
+
+static void Board_SysTickEvent(void)
+{
+    if (0U != (*Board_Word(BOARD_CORE_PAGE + BOARD_SYSTICK_CTRL) & BOARD_SYSTICK_TICKINT))
+    {
+        Board_SysTickPending = TRUE;
+    }
+    Board_SysTickZero += 1ULL + Board_SysTickReload();
+}
+
+/*******************************************************************************
+ *                                   GPTM                                      *
+ *******************************************************************************/
+
+static Board_TimerType * Board_TimerAt(uint32 base)
+{
+    uint8 ucTimer;
+
+    for (ucTimer = 0; ucTimer < BOARD_NUMBER_OF_TIMERS; ucTimer++)
+    {
+        if (Board_Timers[ucTimer].ulBase == base)
+        {
+            return &Board_Timers[ucTimer];
+        }
+    }
+    return NULL;
+}
+
+static uint32 Board_TimerCount(const Board_TimerType *pTimer)
+{
+    uint64 ullCounts;
+
+    if (FALSE == pTimer->bRunning)
+    {
+        return pTimer->ulStopped;
+    }
+    ullCounts = (Board_Now - pTimer->ullStart) / pTimer->ulClocksPerCount;
+    if (TRUE == pTimer->bPeriodic)
+    {
+        return pTimer->ulLoad - (uint32)(ullCounts % ((uint64)pTimer->ulLoad + 1ULL));
+    }
+    return (ullCounts >= pTimer->ulLoad) ? 0U : (pTimer->ulLoad - (uint32)ullCounts);
+}
+
+static void Board_TimerControl(Board_TimerType *pTimer, uint32 ulOld, uint32 ulNew)
+{
+    if ((0U == (ulOld & BOARD_GPTM_TAEN)) && (0U != (ulNew & BOARD_GPTM_TAEN)))
+    {
+        /* Counts down from the load, time-out at 0 */
+        pTimer->ulLoad = *Board_Word(pTimer->ulBase + BOARD_GPTM_TAILR);
+        pTimer->ulClocksPerCount = (*Board_Word(pTimer->ulBase + BOARD_GPTM_TAPR) & 0xFFFFU) + 1U;
+        pTimer->bPeriodic = (boolean)(BOARD_GPTM_PERIODIC == (*Board_Word(pTimer->ulBase + BOARD_GPTM_TAMR) & 0x3U));
+        pTimer->ullStart = Board_Now;
+        pTimer->ullTimeout = Board_Now + ((uint64)pTimer->ulLoad * pTimer->ulClocksPerCount);
+        pTimer->bRunning = TRUE;
+    }
+    else if ((0U != (ulOld & BOARD_GPTM_TAEN)) && (0U == (ulNew & BOARD_GPTM_TAEN)))
+    {
+        pTimer->ulStopped = Board_TimerCount(pTimer);
+        pTimer->bRunning = FALSE;
+    }
+    else
+    {
+        /* Enable unchanged */
+    }
+}
+
+static void Board_AdcTrigger(uint32 ulSource);
+
+static void Board_TimerEvent(Board_TimerType *pTimer)
+{
+    volatile uint32 *pCtl = Board_Word(pTimer->ulBase + BOARD_GPTM_CTL);
+
+    pTimer->ulRis |= 1U;
+    if (0U != (*pCtl & BOARD_GPTM_TAOTE))
+    {
+        Board_AdcTrigger(BOARD_ADC_TRIGGER_TIMER);
+    }
+    if (TRUE == pTimer->bPeriodic)
+    {
+        pTimer->ullTimeout += ((uint64)pTimer->ulLoad + 1ULL) * pTimer->ulClocksPerCount;
+    }
+    else
+    {
+        /* A one-shot timer disables itself */
+        pTimer->bRunning = FALSE;
+        pTimer->ulStopped = 0U;
+        *pCtl &= ~BOARD_GPTM_TAEN;
+    }
+}
+
+/*******************************************************************************
+ *                              Seats and ADC0                                 *
+ *******************************************************************************/
+
+/* Heater duty of a seat, 0 .. 1, as the PWM timer drives it */
+static double Board_HeaterDuty(uint8 ucSeat)
+{
+    const Board_HeaterType *pHeater = &Board_Heaters[ucSeat];
+    uint32 ulLoad = *Board_Word(pHeater->ulLoad);
+    uint32 ulMatch = *Board_Word(pHeater->ulMatch);
+
+    if ((0U == (*Board_Word(pHeater->ulCtl) & pHeater->ulEnable)) || (0U == ulLoad) || (ulMatch >= ulLoad))
+    {
+        return 0.0;
+    }
+    return (double)(ulLoad - ulMatch) / (double)ulLoad;
+}
+
+static boolean Board_FaultLedOn(uint8 ucSeat)
+{
+    return (boolean)(0U != (*Board_Word(Board_FaultLeds[ucSeat].ulData) & Board_FaultLeds[ucSeat].ulPin));
+}
+
+static void Board_PlantStep(void)
+{
+    const double dStep = ((double)BOARD_PLANT_STEP_MS / 1000.0) / BOARD_SEAT_TAU_S;
+    double dTarget;
+    uint8 ucSeat;
+
+    for (ucSeat = 0; ucSeat < NUMBER_OF_SEATS; ucSeat++)
+    {
+        dTarget = BOARD_AMBIENT_C + (BOARD_HEATER_RISE_C * Board_HeaterDuty(ucSeat));
+        Board_Seats[ucSeat].dTemp += (dTarget - Board_Seats[ucSeat].dTemp) * dStep;
+    }
+}
+
+/* LM35 of the seat on an ADC input: 10 mV per C, TempConversion's span over the full scale */
+static uint16 Board_SensorSample(uint32 ulChannel)
+{
+    sint32 lRaw = 0;
+    uint8 ucSeat;
+
+    Board_NoiseSeed = (Board_NoiseSeed * 1103515245U) + 12345U;
+    for (ucSeat = 0; ucSeat < NUMBER_OF_SEATS; ucSeat++)
+    {
+        if ((Board_ScanChannels[Seat_Configuration[ucSeat].ucAdcStep] == ulChannel) && (FALSE == Board_Seats[ucSeat].bOpen))
+        {
+            lRaw = (sint32)((Board_Seats[ucSeat].dTemp * 10.0 * (double)TEMP_CONV_ADC_FULL_SCALE) / (double)TEMP_CONV_SPAN_DECI_CELSIUS);
+            lRaw += (sint32)((Board_NoiseSeed >> 16) % (2U * BOARD_SENSOR_NOISE_LSB + 1U)) - BOARD_SENSOR_NOISE_LSB;
+        }
+    }
+    if (lRaw < 0)
+    {
+        lRaw = 0;
+    }
+    if (lRaw > (sint32)TEMP_CONV_ADC_FULL_SCALE)
+    {
+        lRaw = (sint32)TEMP_CONV_ADC_FULL_SCALE;
+    }
+    return (uint16)lRaw;
+}
+
+/* Number of steps of sequencer 0, up to the one with END */
+static uint32 Board_AdcSteps(void)
+{
+    uint32 ulCtl = *Board_Word(BOARD_ADC0_PAGE + BOARD_ADC_SSCTL0);
+    uint32 ulStep;
+
+    for (ulStep = 0; ulStep < BOARD_ADC_FIFO_SIZE; ulStep++)
+    {
+        if (0U != ((ulCtl >> (4U * ulStep)) & ADC_SSCTL_END))
+        {
+            return ulStep + 1U;
+        }
+    }
+    return BOARD_ADC_FIFO_SIZE;
+}
+
+static void Board_AdcTrigger(uint32 ulSource)
+{
+    uint32 ulAveraging = 1UL << (*Board_Word(BOARD_ADC0_PAGE + BOARD_ADC_SAC) & 0x7U);
+
+    if ((0U == (*Board_Word(BOARD_ADC0_PAGE + BOARD_ADC_ACTSS) & 0x1U)) ||
+        (ulSource != (*Board_Word(BOARD_ADC0_PAGE + BOARD_ADC_EMUX) & ADC_EM0_MASK)))
+    {
+        return;
+    }
+    if (TRUE == Board_AdcBusy)
+    {
+        Board_AdcLostTriggers++;
+        return;
+    }
+    Board_AdcBusy = TRUE;
+    Board_AdcDone = Board_Now + ((uint64)Board_AdcSteps() * BOARD_ADC_CLOCKS_PER_SAMPLE * ulAveraging);
+}
+
+static void Board_AdcEvent(void)
+{
+    uint32 ulCtl = *Board_Word(BOARD_ADC0_PAGE + BOARD_ADC_SSCTL0);
+    uint32 ulMux = *Board_Word(BOARD_ADC0_PAGE + BOARD_ADC_SSMUX0);
+    uint32 ulSteps = Board_AdcSteps();
+    uint32 ulStep;
+
+    for (ulStep = 0; ulStep < ulSteps; ulStep++)
+    {
+        if (Board_AdcFifoLevel < BOARD_ADC_FIFO_SIZE)
+        {
+            Board_AdcFifo[(Board_AdcFifoHead + Board_AdcFifoLevel) % BOARD_ADC_FIFO_SIZE] =
+                Board_SensorSample((ulMux >> (4U * ulStep)) & 0xFU);
+            Board_AdcFifoLevel++;
+        }
+        if (0U != ((ulCtl >> (4U * ulStep)) & ADC_SSCTL_IE))
+        {
+            Board_AdcRis |= 1U;
+        }
+    }
+    Board_AdcBusy = FALSE;
+    Board_AdcScans++;
+}
+
+/*******************************************************************************
+ *                                   UART0                                     *
+ *******************************************************************************/
+
+/* Transmit FIFO level the interrupt fires at when the FIFO drains through it (UARTIFLS TXIFLSEL) */
+static uint32 Board_UartTxTrigger(void)
+{
+    static const uint8 aLevels[5] = {2U, 4U, 8U, 12U, 14U};
+    uint32 ulSelect = *Board_Word(BOARD_UART0_PAGE + BOARD_UART_IFLS) & 0x7U;
+
+    return (ulSelect < 5U) ? aLevels[ulSelect] : 8U;
+}
+
+/* 10 bit times of 16 sample clocks at the divisor IBRD + FBRD / 64 */
+static uint64 Board_UartByteClocks(void)
+{
+    uint64 ullDivisor64 = ((uint64)*Board_Word(BOARD_UART0_PAGE + BOARD_UART_IBRD) * 64ULL) +
+                          (*Board_Word(BOARD_UART0_PAGE + BOARD_UART_FBRD) & 0x3FU);
+
+    return (ullDivisor64 * 160ULL) / 64ULL;
+}
+
+/* Move the next byte from the FIFO into the shift register */
+static void Board_UartShiftNext(void)
+{
+    uint32 ulCtl = *Board_Word(BOARD_UART0_PAGE + BOARD_UART_CTL);
+    uint32 ulTrigger = Board_UartTxTrigger();
+
+    if ((0U == Board_UartTxLevel) || ((UART_CTL_UARTEN_MASK | UART_CTL_TXE_MASK) != (ulCtl & (UART_CTL_UARTEN_MASK | UART_CTL_TXE_MASK))))
+    {
+        Board_UartShifting = FALSE;
+        return;
+    }
+    Board_UartShiftByte = Board_UartTx[Board_UartTxHead];
+    Board_UartTxHead = (Board_UartTxHead + 1U) % BOARD_UART_FIFO_SIZE;
+    Board_UartTxLevel--;
+    if ((Board_UartTxLevel + 1U) > ulTrigger && (Board_UartTxLevel <= ulTrigger))
+    {
+        Board_UartRis |= UART_IM_TXIM_MASK;
+    }
+    Board_UartShifting = TRUE;
+    Board_UartShiftDone = Board_Now + Board_UartByteClocks();
+}
+
+static void Board_UartWrite(uint8 ucByte)
+{
+    if (BOARD_UART_FIFO_SIZE == Board_UartTxLevel)
+    {
+        Board_UartOverruns++;
+        return;
+    }
+    Board_UartTx[(Board_UartTxHead + Board_UartTxLevel) % BOARD_UART_FIFO_SIZE] = ucByte;
+    Board_UartTxLevel++;
+    if (FALSE == Board_UartShifting)
+    {
+        Board_UartShiftNext();
+    }
+}
+
+/* A byte left the line: watch the failure journal dump go by, line by line */
+static void Board_UartOutput(uint8 ucByte)
+{
+    Board_UartBytes++;
+    if (TRUE == Board_UartEcho)
+    {
+        putchar(ucByte);
+    }
+    if ('\n' != ucByte)
+    {
+        if (Board_UartLineLength < (BOARD_UART_LINE_SIZE - 1U))
+        {
+            Board_UartLine[Board_UartLineLength++] = (char)ucByte;
+        }
+        return;
+    }
+    Board_UartLine[Board_UartLineLength] = '\0';
+    if (0 == strncmp(Board_UartLine, "failure_log,records", 19))
+    {
+        Board_UartJournalSeen = TRUE;
+    }
+    if (0 == strcmp(Board_UartPreviousLine, "queue_drops,write_errors\r"))
+    {
+        strcpy(Board_UartJournalErrors, Board_UartLine);
+    }
+    strcpy(Board_UartPreviousLine, Board_UartLine);
+    Board_UartLineLength = 0;
+}
+
+static void Board_UartEvent(void)
+{
+    Board_UartOutput(Board_UartShiftByte);
+    Board_UartShiftNext();
+}
+
+static void Board_UartKey(uint8 ucKey)
+{
+    if (Board_UartRxLevel < BOARD_UART_FIFO_SIZE)
+    {
+        Board_UartRx[(Board_UartRxHead + Board_UartRxLevel) % BOARD_UART_FIFO_SIZE] = ucKey;
+        Board_UartRxLevel++;
+    }
+}
+
+static uint32 Board_UartFlags(void)
+{
+    return ((BOARD_UART_FIFO_SIZE == Board_UartTxLevel) ? UART_FR_TXFF_MASK : 0U) |
+           ((0U == Board_UartTxLevel) ? UART_FR_TXFE_MASK : 0U) |
+           ((0U == Board_UartRxLevel) ? UART_FR_RXFE_MASK : 0U) |
+           ((TRUE == Board_UartShifting) ? BOARD_UART_FR_BUSY : 0U);
+}
+
+/*******************************************************************************
+ *                               Port F buttons                                *
+ *******************************************************************************/
+
+/* Input pins take the button levels, the outputs keep what the drivers wrote */
+static void Board_GpioMerge(void)
+{
+    volatile uint32 *pData = Board_Word(BOARD_GPIOF_PAGE + BOARD_GPIO_DATA);
+    uint32 ulDir = *Board_Word(BOARD_GPIOF_PAGE + BOARD_GPIO_DIR);
+
+    *pData = (*pData & ulDir) | ((uint32)Board_ButtonLevels & ~ulDir & 0xFFU);
+}
+
+static void Board_SetPins(uint8 ucPins, uint8 ucLevel)
+{
+    uint32 ulIs = *Board_Word(BOARD_GPIOF_PAGE + BOARD_GPIO_IS);
+    uint32 ulIbe = *Board_Word(BOARD_GPIOF_PAGE + BOARD_GPIO_IBE);
+    uint32 ulIev = *Board_Word(BOARD_GPIOF_PAGE + BOARD_GPIO_IEV);
+    uint32 ulDir = *Board_Word(BOARD_GPIOF_PAGE + BOARD_GPIO_DIR);
+    uint8 ucOld = Board_ButtonLevels;
+    uint32 ulChanged;
+    uint32 ulRising;
+
+    Board_ButtonLevels = (0U != ucLevel) ? (uint8)(ucOld | ucPins) : (uint8)(ucOld & ~ucPins);
+    ulChanged = (uint32)(ucOld ^ Board_ButtonLevels) & ~ulIs & ~ulDir;
+    ulRising = ulChanged & Board_ButtonLevels;
+    Board_GpioRis |= ulChanged & (ulIbe | (ulIev & ulRising) | (~ulIev & ~ulRising));
+    Board_GpioMerge();
+}
+
+static void Board_AddPinEvent(uint64 ullTime, uint8 ucPins, uint8 ucLevel)
+{
+    uint32 ulIndex = Board_PinEventCount;
+
+    if (BOARD_PIN_EVENTS == Board_PinEventCount)
+    {
+        printf("FAIL more than %u pending pin changes, raise BOARD_PIN_EVENTS\n", (unsigned)BOARD_PIN_EVENTS);
+        exit(1);
+    }
+    while ((ulIndex > 0U) && (Board_PinEvents[ulIndex - 1U].ullTime > ullTime))
+    {
+        Board_PinEvents[ulIndex] = Board_PinEvents[ulIndex - 1U];
+        ulIndex--;
+    }
+    Board_PinEvents[ulIndex].ullTime = ullTime;
+    Board_PinEvents[ulIndex].ucPins = ucPins;
+    Board_PinEvents[ulIndex].ucLevel = ucLevel;
+    Board_PinEventCount++;
+}
+
+/* A press and its release, both bouncing for about a millisecond */
+static void Board_Press(uint8 ucPins, uint32 ulHoldMs)
+{
+    static const uint32 aPressUs[] = {0U, 200U, 500U, 800U, 1200U};
+    static const uint32 aReleaseUs[] = {0U, 300U, 600U};
+    uint64 ullRelease = Board_Now + BOARD_MS(ulHoldMs);
+    uint32 ulEdge;
+
+    for (ulEdge = 0; ulEdge < (sizeof(aPressUs) / sizeof(aPressUs[0])); ulEdge++)
+    {
+        Board_AddPinEvent(Board_Now + ((uint64)aPressUs[ulEdge] * (BOARD_CLOCK_HZ / 1000000ULL)), ucPins, (uint8)(ulEdge & 1U));
+    }
+    for (ulEdge = 0; ulEdge < (sizeof(aReleaseUs) / sizeof(aReleaseUs[0])); ulEdge++)
+    {
+        Board_AddPinEvent(ullRelease + ((uint64)aReleaseUs[ulEdge] * (BOARD_CLOCK_HZ / 1000000ULL)), ucPins, (uint8)(1U - (ulEdge & 1U)));
+    }
+}
+
+/*******************************************************************************
+ *                                  Script                                     *
+ *******************************************************************************/
+
+static void Board_Report(void)
+{
+    uint8 ucSeat;
+
+    printf("%6.1f min", (double)Board_Now / (double)BOARD_CLOCK_HZ / 60.0);
+    for (ucSeat = 0; ucSeat < NUMBER_OF_SEATS; ucSeat++)
+    {
+        printf("  %s %5.2f C (read %5.1f, set %2u, duty %3.0f %%)", (const char *)Seat_Configuration[ucSeat].pName,
+               Board_Seats[ucSeat].dTemp, (double)xSeats[ucSeat].xShared.sCurrentTemp / 10.0,
+               (unsigned)xSeats[ucSeat].xShared.ucDesiredTemp, 100.0 * Board_HeaterDuty(ucSeat));
+    }
+    printf("\n");
+}
+
+/* The seat is at its setpoint and the firmware reads it there */
+static void Board_ExpectSettled(uint8 ucSeat, uint8 ucSetpoint)
+{
+    char aName[96];
+    double dRead = (double)xSeats[ucSeat].xShared.sCurrentTemp / 10.0;
+
+    snprintf(aName, sizeof(aName), "%s set to %u C", (const char *)Seat_Configuration[ucSeat].pName, (unsigned)ucSetpoint);
+    Board_Expect(aName, ucSetpoint == xSeats[ucSeat].xShared.ucDesiredTemp);
+    snprintf(aName, sizeof(aName), "%s at %u C within %.1f C", (const char *)Seat_Configuration[ucSeat].pName,
+             (unsigned)ucSetpoint, BOARD_TEMP_TOLERANCE_C);
+    Board_Expect(aName, (Board_Seats[ucSeat].dTemp > ((double)ucSetpoint - BOARD_TEMP_TOLERANCE_C)) &&
+                        (Board_Seats[ucSeat].dTemp < ((double)ucSetpoint + BOARD_TEMP_TOLERANCE_C)));
+    snprintf(aName, sizeof(aName), "%s temperature read within 0.5 C", (const char *)Seat_Configuration[ucSeat].pName);
+    Board_Expect(aName, (dRead > (Board_Seats[ucSeat].dTemp - 0.5)) && (dRead < (Board_Seats[ucSeat].dTemp + 0.5)));
+}
+
+static void Board_Check(uint32 ulCheck)
+{
+    switch (ulCheck)
+    {
+    case 1U:
+        Board_ExpectSettled(0U, HIGH_SEAT_HEATING_TEMPERATURE);
+        Board_ExpectSettled(1U, LOW_SEAT_HEATING_TEMPERATURE);
+        break;
+    case 2U:
+        Board_ExpectSettled(1U, MEDIUM_SEAT_HEATING_TEMPERATURE);
+        break;
+    case 3U:
+        Board_Expect("open passenger sensor is a failure", TRUE == xSeats[1].xShared.bSensorFailure);
+        Board_Expect("passenger heater off with the sensor open", 0.0 == Board_HeaterDuty(1U));
+        Board_Expect("passenger fault LED on", TRUE == Board_FaultLedOn(1U));
+        Board_Expect("driver fault LED off", FALSE == Board_FaultLedOn(0U));
+        break;
+    case 4U:
+        Board_Expect("passenger sensor recovered", FALSE == xSeats[1].xShared.bSensorFailure);
+        Board_Expect("passenger fault LED off again", FALSE == Board_FaultLedOn(1U));
+        Board_Expect("passenger heater back on", Board_HeaterDuty(1U) > 0.0);
+        break;
+    default:
+        Board_Expect("driver switched off by the long press", SEAT_HEATING_OFF == xSeats[0].xShared.ucDesiredTemp);
+        Board_Expect("driver heater off", 0.0 == Board_HeaterDuty(0U));
+        break;
+    }
+}
+
+static void Board_RunStep(const Board_StepType *pStep)
+{
+    switch (pStep->eAction)
+    {
+    case BOARD_PRESS:
+        Board_Press((uint8)pStep->ulArg, pStep->ulHoldMs);
+        break;
+    case BOARD_SENSOR_OPEN:
+        Board_Seats[pStep->ulArg].bOpen = TRUE;
+        break;
+    case BOARD_SENSOR_CLOSE:
+        Board_Seats[pStep->ulArg].bOpen = FALSE;
+        break;
+    case BOARD_KEY:
+        Board_UartKey((uint8)pStep->ulArg);
+        break;
+    case BOARD_CHECK:
+        Board_Check(pStep->ulArg);
+        break;
+    default:
+        Board_EndDue = TRUE;    /* The idle task ends the run, see vApplicationIdleHook */
+        break;
+    }
+}
+
+/*******************************************************************************
+ *                                Event queue                                  *
+ *******************************************************************************/
+
+static uint64 Board_NextEvent(void)
+{
+    uint64 ullNext = Board_Min(Board_NextPlantStep, Board_NextReport);
+    uint8 ucTimer;
+
+    if (Board_Step < BOARD_SCRIPT_STEPS)
+    {
+        ullNext = Board_Min(ullNext, BOARD_MS(Board_Script[Board_Step].ulTimeMs));
+    }
+    if (TRUE == Board_SysTickRunning)
+    {
+        ullNext = Board_Min(ullNext, Board_SysTickZero);
+    }
+    for (ucTimer = 0; ucTimer < BOARD_NUMBER_OF_TIMERS; ucTimer++)
+    {
+        if (TRUE == Board_Timers[ucTimer].bRunning)
+        {
+            ullNext = Board_Min(ullNext, Board_Timers[ucTimer].ullTimeout);
+        }
+    }
+    if (TRUE == Board_AdcBusy)
+    {
+        ullNext = Board_Min(ullNext, Board_AdcDone);
+    }
+    if (TRUE == Board_UartShifting)
+    {
+        ullNext = Board_Min(ullNext, Board_UartShiftDone);
+    }
+    if (0U != Board_PinEventCount)
+    {
+        ullNext = Board_Min(ullNext, Board_PinEvents[0].ullTime);
+    }
+    return ullNext;
+}
+
+/* Apply every event due at Board_Now. Never runs firmware code */
+static void Board_RunEvents(void)
+{
+    uint8 ucTimer;
+
+    if ((TRUE == Board_SysTickRunning) && (Board_SysTickZero <= Board_Now))
+    {
+        Board_SysTickEvent();
+    }
+    for (ucTimer = 0; ucTimer < BOARD_NUMBER_OF_TIMERS; ucTimer++)
+    {
+        if ((TRUE == Board_Timers[ucTimer].bRunning) && (Board_Timers[ucTimer].ullTimeout <= Board_Now))
+        {
+            Board_TimerEvent(&Board_Timers[ucTimer]);
+        }
+    }
+    if ((TRUE == Board_AdcBusy) && (Board_AdcDone <= Board_Now))
+    {
+        Board_AdcEvent();
+    }
+    if ((TRUE == Board_UartShifting) && (Board_UartShiftDone <= Board_Now))
+    {
+        Board_UartEvent();
+    }
+    while ((0U != Board_PinEventCount) && (Board_PinEvents[0].ullTime <= Board_Now))
+    {
+        Board_SetPins(Board_PinEvents[0].ucPins, Board_PinEvents[0].ucLevel);
+        Board_PinEventCount--;
+        memmove(&Board_PinEvents[0], &Board_PinEvents[1], Board_PinEventCount * sizeof(Board_PinEvents[0]));
+    }
+    if (Board_NextPlantStep <= Board_Now)
+    {
+        Board_PlantStep();
+        Board_NextPlantStep += BOARD_MS(BOARD_PLANT_STEP_MS);
+    }
+    if (Board_NextReport <= Board_Now)
+    {
+        Board_Report();
+        Board_NextReport += BOARD_MS(BOARD_MIN(BOARD_REPORT_MINUTES));
+    }
+    while ((Board_Step < BOARD_SCRIPT_STEPS) && (BOARD_MS(Board_Script[Board_Step].ulTimeMs) <= Board_Now))
+    {
+        Board_RunStep(&Board_Script[Board_Step++]);
+    }
+}
+
+/* Move the clock on, only called with the last register write taken */
+static void Board_Advance(uint64 ullClocks)
+{
+    uint64 ullTarget = Board_Now + ullClocks;
+    uint64 ullNext;
+
+    while ((ullNext = Board_NextEvent()) <= ullTarget)
+    {
+        if (ullNext > Board_Now)
+        {
+            Board_Now = ullNext;
+        }
+        Board_RunEvents();
+    }
+    Board_Now = ullTarget;
+
+    if ((TRUE == Board_EndDue) && (Board_Now > BOARD_MS(BOARD_MIN(BOARD_RUN_MINUTES) + 10000U)))
+    {
+        printf("FAIL the idle task did not run for 10 s\n");
+        exit(1);
+    }
+}
+
+/*******************************************************************************
+ *                              Register accesses                              *
+ *******************************************************************************/
+
+/* Value the register reads as at this access */
+static void Board_Present(uint32 address, volatile uint32 *pWord)
+{
+    uint32 base = address & ~(SIM_PAGE_SIZE_BYTES - 1U);
+    uint32 offset = address & (SIM_PAGE_SIZE_BYTES - 1U);
+    Board_TimerType *pTimer = Board_TimerAt(base);
+    uint32 ulIndex;
+
+    if (NULL != pTimer)
+    {
+        switch (offset)
+        {
+        case BOARD_GPTM_RIS: *pWord = pTimer->ulRis; break;
+        case BOARD_GPTM_MIS: *pWord = pTimer->ulRis & *Board_Word(base + BOARD_GPTM_IMR); break;
+        case BOARD_GPTM_ICR: *pWord = 0U; break;
+        case BOARD_GPTM_TAR: *pWord = Board_TimerCount(pTimer); break;
+        default: break;
+        }
+    }
+    else if (BOARD_CORE_PAGE == base)
+    {
+        if (BOARD_SYSTICK_CURRENT == offset)
+        {
+            *pWord = Board_SysTickCount();
+        }
+        else if (BOARD_ICSR == offset)
+        {
+            *pWord = (TRUE == Board_SysTickPending) ? BOARD_ICSR_PENDSTSET : 0U;
+        }
+        else if ((offset >= BOARD_NVIC_EN0) && (offset < (BOARD_NVIC_EN0 + (4U * BOARD_NVIC_REGISTERS))))
+        {
+            *pWord = Board_NvicEnabled[(offset - BOARD_NVIC_EN0) / 4U];
+        }
+        else if ((offset >= BOARD_NVIC_DIS0) && (offset < (BOARD_NVIC_DIS0 + (4U * BOARD_NVIC_REGISTERS))))
+        {
+            *pWord = 0U;
+        }
+        else
+        {
+            /* Plain register */
+        }
+    }
+    else if (BOARD_ADC0_PAGE == base)
+    {
+        switch (offset)
+        {
+        case BOARD_ADC_RIS: *pWord = Board_AdcRis; break;
+        case BOARD_ADC_ISC: *pWord = 0U; break;
+        case BOARD_ADC_PSSI: *pWord = 0U; break;
+        case BOARD_ADC_SSFIFO0: *pWord = (0U != Board_AdcFifoLevel) ? Board_AdcFifo[Board_AdcFifoHead] : 0U; break;
+        default: break;
+        }
+    }
+    else if (BOARD_UART0_PAGE == base)
+    {
+        switch (offset)
+        {
+        case BOARD_UART_DR: *pWord = BOARD_UART_DR_READ | ((0U != Board_UartRxLevel) ? Board_UartRx[Board_UartRxHead] : 0U); break;
+        case BOARD_UART_FR: *pWord = Board_UartFlags(); break;
+        case BOARD_UART_RIS: *pWord = Board_UartRis; break;
+        case BOARD_UART_MIS: *pWord = Board_UartRis & *Board_Word(base + BOARD_UART_IM); break;
+        case BOARD_UART_ICR: *pWord = 0U; break;
+        default: break;
+        }
+    }
+    else if (BOARD_GPIOF_PAGE == base)
+    {
+        switch (offset)
+        {
+        case BOARD_GPIO_DATA: Board_GpioMerge(); break;
+        case BOARD_GPIO_RIS: *pWord = Board_GpioRis; break;
+        case BOARD_GPIO_MIS: *pWord = Board_GpioRis & *Board_Word(base + BOARD_GPIO_IM); break;
+        case BOARD_GPIO_ICR: *pWord = 0U; break;
+        default: break;
+        }
+    }
+    else if (BOARD_EEPROM_PAGE == base)
+    {
+        ulIndex = (*Board_Word(base + BOARD_EEPROM_EEBLOCK) * EEPROM_WORDS_PER_BLOCK) + *Board_Word(base + BOARD_EEPROM_EEOFFSET);
+        if (BOARD_EEPROM_EERDWR == offset)
+        {
+            *pWord = (ulIndex < EEPROM_SIZE_WORDS) ? Board_EepromWords[ulIndex] : 0U;
+        }
+        else if (BOARD_EEPROM_EEDONE == offset)
+        {
+            *pWord = (Board_Now < Board_EepromBusyUntil) ? 1U : 0U;
+        }
+        else
+        {
+            /* Plain register */
+        }
+    }
+    else
+    {
+        /* Plain peripheral page */
+    }
+
+    Board_PendingWord = pWord;
+    Board_PendingAddress = address;
+    Board_PendingValue = *pWord;
+}
+
+/* Take the write of the last access, or the read of a register a read changes */
+static void Board_Commit(void)
+{
+    volatile uint32 *pWord = Board_PendingWord;
+    uint32 base = Board_PendingAddress & ~(SIM_PAGE_SIZE_BYTES - 1U);
+    uint32 offset = Board_PendingAddress & (SIM_PAGE_SIZE_BYTES - 1U);
+    uint32 ulValue;
+    boolean bWritten;
+    Board_TimerType *pTimer;
+    uint32 ulIndex;
+
+    if (NULL == pWord)
+    {
+        return;
+    }
+    Board_PendingWord = NULL;
+    ulValue = *pWord;
+    bWritten = (boolean)(ulValue != Board_PendingValue);
+    pTimer = Board_TimerAt(base);
+
+    if (NULL != pTimer)
+    {
+        if ((BOARD_GPTM_CTL == offset) && (TRUE == bWritten))
+        {
+            Board_TimerControl(pTimer, Board_PendingValue, ulValue);
+        }
+        else if (BOARD_GPTM_ICR == offset)
+        {
+            pTimer->ulRis &= ~ulValue;
+            *pWord = 0U;
+        }
+        else
+        {
+            /* Plain register */
+        }
+    }
+    else if (BOARD_CORE_PAGE == base)
+    {
+        if ((BOARD_SYSTICK_CTRL == offset) && (TRUE == bWritten))
+        {
+            Board_SysTickControl(Board_PendingValue, ulValue);
+        }
+        else if ((BOARD_SYSTICK_CURRENT == offset) && (TRUE == bWritten))
+        {
+            /* Any write clears the counter, the reload value is loaded on the next clock */
+            Board_SysTickStopped = 0U;
+            if (TRUE == Board_SysTickRunning)
+            {
+                Board_SysTickZero = Board_Now + 1ULL + Board_SysTickReload();
+            }
+        }
+        else if ((BOARD_ICSR == offset) && (TRUE == bWritten))
+        {
+            if (0U != (ulValue & BOARD_ICSR_PENDSTCLR))
+            {
+                Board_SysTickPending = FALSE;
+            }
+            if (0U != (ulValue & BOARD_ICSR_PENDSTSET))
+            {
+                Board_SysTickPending = TRUE;
+            }
+        }
+        else if ((offset >= BOARD_NVIC_EN0) && (offset < (BOARD_NVIC_EN0 + (4U * BOARD_NVIC_REGISTERS))))
+        {
+            ulIndex = (offset - BOARD_NVIC_EN0) / 4U;
+            Board_NvicEnabled[ulIndex] |= ulValue;
+            *pWord = Board_NvicEnabled[ulIndex];
+        }
+        else if ((offset >= BOARD_NVIC_DIS0) && (offset < (BOARD_NVIC_DIS0 + (4U * BOARD_NVIC_REGISTERS))))
+        {
+            Board_NvicEnabled[(offset - BOARD_NVIC_DIS0) / 4U] &= ~ulValue;
+            *pWord = 0U;
+        }
+        else
+        {
+            /* Plain register */
+        }
+    }
+    else if (BOARD_ADC0_PAGE == base)
+    {
+        if (BOARD_ADC_ISC == offset)
+        {
+            Board_AdcRis &= ~ulValue;
+            *pWord = 0U;
+        }
+        else if (BOARD_ADC_PSSI == offset)
+        {
+            if (0U != (ulValue & 0x1U))
+            {
+                Board_AdcTrigger(BOARD_ADC_TRIGGER_PROCESSOR);
+            }
+            *pWord = 0U;
+        }
+        else if ((BOARD_ADC_SSFIFO0 == offset) && (FALSE == bWritten) && (0U != Board_AdcFifoLevel))
+        {
+            Board_AdcFifoHead = (Board_AdcFifoHead + 1U) % BOARD_ADC_FIFO_SIZE;
+            Board_AdcFifoLevel--;
+        }
+        else
+        {
+            /* Plain register */
+        }
+    }
+    else if (BOARD_UART0_PAGE == base)
+    {
+        if (BOARD_UART_DR == offset)
+        {
+            if (TRUE == bWritten)
+            {
+                Board_UartWrite((uint8)ulValue);
+            }
+            else if (0U != Board_UartRxLevel)
+            {
+                Board_UartRxHead = (Board_UartRxHead + 1U) % BOARD_UART_FIFO_SIZE;
+                Board_UartRxLevel--;
+            }
+            else
+            {
+                /* Read of an empty receive FIFO */
+            }
+        }
+        else if (BOARD_UART_ICR == offset)
+        {
+            Board_UartRis &= ~ulValue;
+            *pWord = 0U;
+        }
+        else
+        {
+            /* Plain register */
+        }
+    }
+    else if (BOARD_GPIOF_PAGE == base)
+    {
+        if (BOARD_GPIO_DATA == offset)
+        {
+            Board_GpioMerge();
+        }
+        else if (BOARD_GPIO_ICR == offset)
+        {
+            Board_GpioRis &= ~ulValue;
+            *pWord = 0U;
+        }
+        else
+        {
+            /* Plain register */
+        }
+    }
+    else if ((BOARD_EEPROM_PAGE == base) && (BOARD_EEPROM_EERDWR == offset) && (TRUE == bWritten))
+    {
+        ulIndex = (*Board_Word(base + BOARD_EEPROM_EEBLOCK) * EEPROM_WORDS_PER_BLOCK) + *Board_Word(base + BOARD_EEPROM_EEOFFSET);
+        if (ulIndex < EEPROM_SIZE_WORDS)
+        {
+            Board_EepromWords[ulIndex] = ulValue;
+            Board_EepromBusyUntil = Board_Now + BOARD_EEPROM_WRITE_CLOCKS;
+            Board_EepromWrites++;
+        }
+    }
+    else
+    {
+        /* Plain peripheral page */
+    }
+}
+
+volatile uint32 * Sim_PeripheralAddress(uint32 address)
+{
+    volatile uint32 *pRegister;
+
+    Board_Commit();
+    if (FALSE == Board_Finished)
+    {
+        Board_Accesses++;
+        Board_Advance(BOARD_ACCESS_CLOCKS);
+        vPortSimInterruptPoint();       /* Commits the last access of the handlers it ran */
+    }
+    Board_Commit();                     /* Or of the task that ran before this one was switched back in */
+    pRegister = Sim_PageAddress(address);
+    Board_Present(address, pRegister);
+    return pRegister;
+}
+
+/*******************************************************************************
+ *                             Emulated Cortex-M4                              *
+ *******************************************************************************/
+
+static uint32 Board_LineStatus(uint8 ucLine)
+{
+    switch (ucLine)
+    {
+    case BOARD_LINE_SYSTICK: return (uint32)Board_SysTickPending;
+    case BOARD_LINE_UART0:   return Board_UartRis & *Board_Word(BOARD_UART0_PAGE + BOARD_UART_IM);
+    case BOARD_LINE_ADC0:    return Board_AdcRis & *Board_Word(BOARD_ADC0_PAGE + BOARD_ADC_IM) & 0x1U;
+    case BOARD_LINE_GPIOF:   return Board_GpioRis & *Board_Word(BOARD_GPIOF_PAGE + BOARD_GPIO_IM);
+    case BOARD_LINE_WTIMER0: return Board_Timers[BOARD_WTIMER0].ulRis & *Board_Word(Board_Timers[BOARD_WTIMER0].ulBase + BOARD_GPTM_IMR);
+    default:                 return Board_Timers[BOARD_WTIMER1].ulRis & *Board_Word(Board_Timers[BOARD_WTIMER1].ulBase + BOARD_GPTM_IMR);
+    }
+}
+
+static boolean Board_LineAsserted(uint8 ucLine)
+{
+    uint32 ulIrq = Board_Lines[ucLine].ulIrq;
+
+    if ((BOARD_NO_IRQ != ulIrq) && (0U == (Board_NvicEnabled[ulIrq / 32U] & (1UL << (ulIrq % 32U)))))
+    {
+        return FALSE;
+    }
+    return (boolean)(0U != Board_LineStatus(ucLine));
+}
+
+static uint32 Board_LinePriority(uint8 ucLine)
+{
+    uint32 ulIrq = Board_Lines[ucLine].ulIrq;
+
+    if (BOARD_NO_IRQ == ulIrq)
+    {
+        return (*Board_Word(BOARD_CORE_PAGE + BOARD_SHPR3) >> 24) & BOARD_PRIORITY_MASK;
+    }
+    return (*Board_Word(BOARD_CORE_PAGE + BOARD_NVIC_PRI0 + (4U * (ulIrq / 4U))) >> (8U * (ulIrq % 4U))) & BOARD_PRIORITY_MASK;
+}
+
+void vApplicationSimTakeInterrupts(void)
+{
+    uint32 ulBest;
+    uint32 ulPriority;
+    uint8 ucBest;
+    uint8 ucLine;
+
+    Board_Commit();
+    if (TRUE == Board_Finished)
+    {
+        return;
+    }
+    for (;;)
+    {
+        /* Highest priority asserted line that preempts, the lower exception number on a tie */
+        ucBest = BOARD_NUMBER_OF_LINES;
+        ulBest = ulPortSimExecutionPriority();
+        for (ucLine = 0; ucLine < BOARD_NUMBER_OF_LINES; ucLine++)
+        {
+            if (TRUE == Board_LineAsserted(ucLine))
+            {
+                ulPriority = Board_LinePriority(ucLine);
+                if (ulPriority < ulBest)
+                {
+                    ucBest = ucLine;
+                    ulBest = ulPriority;
+                }
+            }
+        }
+        if (BOARD_NUMBER_OF_LINES == ucBest)
+        {
+            return;
+        }
+        if (BOARD_LINE_SYSTICK == ucBest)
+        {
+            Board_SysTickPending = FALSE;   /* Cleared on exception entry */
+        }
+        Board_Lines[ucBest].ulTaken++;
+        Board_Advance(BOARD_EXCEPTION_CLOCKS);
+        vPortSimRunHandler(Board_Lines[ucBest].pHandler, ulBest);
+        Board_Commit();
+    }
+}
+
+void Sim_DisableInterrupts(void)
+{
+    vPortSimSetPRIMASK(1U);
+}
+
+void Sim_EnableInterrupts(void)
+{
+    vPortSimSetPRIMASK(0U);
+}
+
+/* WFI: wakes on any asserted interrupt, even one PRIMASK holds back */
+void Sim_WaitForInterrupt(void)
+{
+    uint64 ullStart;
+    uint64 ullNext;
+    uint8 ucLine;
+
+    Board_Commit();
+    ullStart = Board_Now;
+    for (;;)
+    {
+        for (ucLine = 0; ucLine < BOARD_NUMBER_OF_LINES; ucLine++)
+        {
+            if (TRUE == Board_LineAsserted(ucLine))
+            {
+                Board_Sleeps++;
+                Board_SleepClocks += Board_Now - ullStart;
+                return;
+            }
+        }
+        ullNext = Board_NextEvent();
+        Board_Advance((ullNext > Board_Now) ? (ullNext - Board_Now) : 0U);
+    }
+}
+
+/*******************************************************************************
+ *                           Firmware hooks and end                            *
+ *******************************************************************************/
+
+static void Board_Finish(void)
+{
+    FailureLog_RecordType xRecord;
+    LowPower_StatsType xSleep;
+    struct timespec xHostEnd;
+    sint64 sllLag;
+    double dLagPerSleep;
+    uint32 ulRecord;
+    boolean bLogged = FALSE;
+    double dVirtualS;
+    double dHostS;
+    uint8 ucLine;
+
+    /* From here the firmware only runs for the checks, nothing moves under it */
+    Board_Finished = TRUE;
+    clock_gettime(CLOCK_MONOTONIC, &xHostEnd);
+
+    /* Clocks the kernel time is behind the board: the ticks counted and how far the SysTick is into the next */
+    LowPower_GetStats(&xSleep);
+    sllLag = (sint64)(Board_Now - Board_TickStart) -
+             (sint64)(((uint64)xTaskGetTickCount() * BOARD_CLOCKS_PER_TICK) + (1U + Board_SysTickReload() - Board_SysTickCount()));
+    dLagPerSleep = (double)sllLag / (double)((0U != xSleep.ulSleeps) ? xSleep.ulSleeps : 1U);
+    Board_Expect("kernel tick keeps its phase across the tickless idle",
+                 (dLagPerSleep > -(double)BOARD_TICKLESS_LAG_CLOCKS) && (dLagPerSleep < (double)BOARD_TICKLESS_LAG_CLOCKS));
+
+    for (ulRecord = 0; ulRecord < FailureLog_GetCount(); ulRecord++)
+    {
+        if ((E_OK == FailureLog_Read(ulRecord, &xRecord)) && (1U == xRecord.ucSeat) && (FAILURELOG_CODE_SENSOR_LOW == xRecord.ucCode))
+        {
+            bLogged = TRUE;
+        }
+    }
+    Board_Expect("passenger SENSOR_LOW record in the EEPROM journal", bLogged);
+    Board_Expect("no failure record dropped or lost", (0U == ulFailureLogDrops) && (0U == ulFailureLogWriteErrors));
+    Board_Expect("failure journal sent over UART0", TRUE == Board_UartJournalSeen);
+    Board_Expect("UART0 reports no record dropped or lost", 0 == strcmp(Board_UartJournalErrors, "0,0\r"));
+    Board_Expect("UARTDR never written with the FIFO full", 0U == Board_UartOverruns);
+    Board_Expect("no ADC trigger during a conversion", 0U == Board_AdcLostTriggers);
+
+    dVirtualS = (double)Board_Now / (double)BOARD_CLOCK_HZ;
+    dHostS = (double)(xHostEnd.tv_sec - Board_HostStart.tv_sec) + ((double)(xHostEnd.tv_nsec - Board_HostStart.tv_nsec) / 1e9);
+
+    printf("\n%.1f min of firmware in %.2f s, %.0fx real time\n", dVirtualS / 60.0, dHostS, dVirtualS / dHostS);
+    printf("  register accesses      %12llu\n", (unsigned long long)Board_Accesses);
+    printf("  interrupts            ");
+    for (ucLine = 0; ucLine < BOARD_NUMBER_OF_LINES; ucLine++)
+    {
+        printf(" %s %lu", Board_Lines[ucLine].pName, (unsigned long)Board_Lines[ucLine].ulTaken);
+    }
+    printf("\n  asleep                 %11.2f %%, %llu sleeps\n", 100.0 * (double)Board_SleepClocks / (double)Board_Now,
+           (unsigned long long)Board_Sleeps);
+    printf("  kernel ticks           %12lu, %lu suppressed by the tickless idle\n", (unsigned long)xTaskGetTickCount(),
+           (unsigned long)xSleep.ulSuppressedTicks);
+    printf("  kernel tick lag        %12lld clocks, %.1f per sleep\n", (long long)sllLag, dLagPerSleep);
+    printf("  ADC0 scans             %12lu\n", (unsigned long)Board_AdcScans);
+    printf("  UART0 bytes            %12llu\n", (unsigned long long)Board_UartBytes);
+    printf("  EEPROM words written   %12lu, %lu failure records\n", (unsigned long)Board_EepromWrites,
+           (unsigned long)FailureLog_GetCount());
+
+    printf("%s\n", (0U == Board_Failures) ? "PASS" : "FAIL");
+    exit((0U == Board_Failures) ? 0 : 1);
+}
+
+/* Every turn of the idle task that does not sleep takes some clocks, and the
+ * run ends here, in a task, with the tick the tickless idle stepped up to date */
+void vApplicationIdleHook(void)
+{
+    if (TRUE == Board_EndDue)
+    {
+        Board_Finish();
+    }
+    Board_Commit();
+    Board_Advance(BOARD_IDLE_LOOP_CLOCKS);
+    vPortSimInterruptPoint();
+}
+
+void vAssertCalled(const char *pcFile, unsigned long ulLine)
+{
+    printf("FAIL assert %s:%lu (at %.3f s)\n", pcFile, ulLine, (double)Board_Now / (double)BOARD_CLOCK_HZ);
+    exit(1);
+}
+
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+    printf("FAIL Det module %u instance %u api %u error %u\n", (unsigned)ModuleId, (unsigned)InstanceId,
+           (unsigned)ApiId, (unsigned)ErrorId);
+    exit(1);
+    return E_NOT_OK;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32 ulWord;
+    uint8 ucSeat;
+
+    if ((argc > 1) && (0 == strcmp(argv[1], "-u")))
+    {
+        Board_UartEcho = TRUE;
+    }
+    for (ulWord = 0; ulWord < EEPROM_SIZE_WORDS; ulWord++)
+    {
+        Board_EepromWords[ulWord] = EEPROM_ERASED_WORD;
+    }
+    for (ucSeat = 0; ucSeat < NUMBER_OF_SEATS; ucSeat++)
+    {
+        Board_Seats[ucSeat].dTemp = BOARD_AMBIENT_C;
+    }
+    Board_NextPlantStep = BOARD_MS(BOARD_PLANT_STEP_MS);
+    Board_NextReport = BOARD_MS(BOARD_MIN(BOARD_REPORT_MINUTES));
+    setvbuf(stdout, NULL, _IOFBF, 0);
+    clock_gettime(CLOCK_MONOTONIC, &Board_HostStart);
+
+    Firmware_Main();                    /* Does not return, Board_Finish() exits */
+    return 1;
+}
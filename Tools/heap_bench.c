@@ -0,0 +1,416 @@
+/******************************************************************************
+ *
+ * Tool: heap_bench
+ *
+ * File Name: heap_bench.c
+ *
+ * Description: Host comparison of the kernel heaps heap_2.c and heap_tlsf.c
+ *              (FreeRTOS/Source/portable/MemMang, both compiled in unchanged
+ *              with the kernel calls stubbed) on one random trace of
+ *              variable-size allocations and frees: short failure messages,
+ *              telemetry frames and a few large buffers, with the size mix
+ *              changing every SIM_PHASE_OPERATIONS operations. The trace never
+ *              holds more than SIM_LOAD_PERCENT of the heap, so an allocator
+ *              without fragmentation would serve every request.
+ *
+ *              For each heap it reports:
+ *              - the failed allocations, and those failed although the free
+ *                bytes were enough (fragmentation)
+ *              - the fragmentation, 1 - largest free block / free bytes,
+ *                average and worst, and the most free blocks seen
+ *              - the malloc and free latency, 99.9 % and worst, in ns
+ *
+ *              The host has 64-bit pointers, so a block header takes 16 bytes
+ *              instead of 8 on the target, for both heaps alike. Latencies are
+ *              wall clock: the worst case includes the host preempting the
+ *              bench, the 99.9 % one is the better comparison. heap_2 walks
+ *              its free list on malloc and free, up to the most free blocks
+ *              seen, TLSF takes the same steps whatever the heap holds.
+ *
+ *              Build: gcc -O2 -I../FreeRTOS_Project_SeatControllerSystem/FreeRTOS/Source/include
+ *                         -o heap_bench heap_bench.c
+ *              Usage: heap_bench [seed] [operations]
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include <time.h>
+
+#define SIM_HEAP_SIZE           8000U       /* configTOTAL_HEAP_SIZE of the target */
+#define SIM_LOAD_PERCENT        70U         /* Most requested bytes live at once */
+#define SIM_MAX_LIVE            256U
+#define SIM_PHASE_OPERATIONS    5000U
+#define SIM_SAMPLE_OPERATIONS   16U         /* Fragmentation sampled every this many operations */
+#define SIM_LATENCY_BUCKETS     100000U     /* 1 ns each, the last one takes everything above */
+
+/* The kernel as the heaps see it: no scheduler to suspend, asserts checked */
+#define INC_FREERTOS_H
+#define INC_TASK_H
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+#define pdFALSE                             ( ( BaseType_t ) 0 )
+#define pdTRUE                              ( ( BaseType_t ) 1 )
+#define PRIVILEGED_DATA
+#define PRIVILEGED_FUNCTION
+#define portBYTE_ALIGNMENT                  8
+#define portBYTE_ALIGNMENT_MASK             ( 0x0007 )
+#define portPOINTER_SIZE_TYPE               uintptr_t
+#define configTOTAL_HEAP_SIZE               ( ( size_t ) SIM_HEAP_SIZE )
+#define configSUPPORT_DYNAMIC_ALLOCATION    1
+#define configUSE_MALLOC_FAILED_HOOK        0
+#define configAPPLICATION_ALLOCATED_HEAP    0
+#define configASSERT( x )                   assert( x )
+#define traceMALLOC( pvAddress, uiSize )
+#define traceFREE( pvAddress, uiSize )
+#define mtCOVERAGE_TEST_MARKER()
+#define taskENTER_CRITICAL()
+#define taskEXIT_CRITICAL()
+static void vTaskSuspendAll( void ) {}
+static BaseType_t xTaskResumeAll( void ) { return pdFALSE; }
+/* Declared once per heap, after its renames: three of the members share the names of heap counters */
+#define SIM_HEAP_STATS_TYPE                                 \
+    typedef struct                                          \
+    {                                                       \
+        size_t xAvailableHeapSpaceInBytes;                  \
+        size_t xSizeOfLargestFreeBlockInBytes;              \
+        size_t xSizeOfSmallestFreeBlockInBytes;             \
+        size_t xNumberOfFreeBlocks;                         \
+        size_t xMinimumEverFreeBytesRemaining;              \
+        size_t xNumberOfSuccessfulAllocations;              \
+        size_t xNumberOfSuccessfulFrees;                    \
+    } HeapStats_t;
+
+/* Both heaps in one program, every name renamed per heap */
+#define configUSE_HEAP_TLSF                 0
+#define pvPortMalloc                        Heap2_Malloc
+#define vPortFree                           Heap2_Free
+#define pvPortCalloc                        Heap2_Calloc
+#define xPortGetFreeHeapSize                Heap2_GetFreeHeapSize
+#define xPortGetMinimumEverFreeHeapSize     Heap2_GetMinimumEverFreeHeapSize
+#define vPortGetHeapStats                   Heap2_GetHeapStats
+#define vPortInitialiseBlocks               Heap2_InitialiseBlocks
+#define ucHeap                              Heap2_ucHeap
+#define xFreeBytesRemaining                 Heap2_xFreeBytesRemaining
+#define xMinimumEverFreeBytesRemaining      Heap2_xMinimumEverFreeBytesRemaining
+#define xNumberOfSuccessfulAllocations      Heap2_xNumberOfSuccessfulAllocations
+#define xNumberOfSuccessfulFrees            Heap2_xNumberOfSuccessfulFrees
+#define prvHeapInit                         Heap2_prvHeapInit
+#define HeapStats_t                         Heap2_HeapStats_t
+SIM_HEAP_STATS_TYPE
+#include "../FreeRTOS_Project_SeatControllerSystem/FreeRTOS/Source/portable/MemMang/heap_2.c"
+#undef configUSE_HEAP_TLSF
+#undef pvPortMalloc
+#undef vPortFree
+#undef pvPortCalloc
+#undef xPortGetFreeHeapSize
+#undef xPortGetMinimumEverFreeHeapSize
+#undef vPortGetHeapStats
+#undef vPortInitialiseBlocks
+#undef ucHeap
+#undef xFreeBytesRemaining
+#undef xMinimumEverFreeBytesRemaining
+#undef xNumberOfSuccessfulAllocations
+#undef xNumberOfSuccessfulFrees
+#undef prvHeapInit
+#undef HeapStats_t
+#undef heapMINIMUM_BLOCK_SIZE
+#undef configHEAP_CLEAR_MEMORY_ON_FREE
+
+#define configUSE_HEAP_TLSF                 1
+#define pvPortMalloc                        Tlsf_Malloc
+#define vPortFree                           Tlsf_Free
+#define pvPortCalloc                        Tlsf_Calloc
+#define xPortGetFreeHeapSize                Tlsf_GetFreeHeapSize
+#define xPortGetMinimumEverFreeHeapSize     Tlsf_GetMinimumEverFreeHeapSize
+#define vPortGetHeapStats                   Tlsf_GetHeapStats
+#define vPortInitialiseBlocks               Tlsf_InitialiseBlocks
+SIM_HEAP_STATS_TYPE
+#include "../FreeRTOS_Project_SeatControllerSystem/FreeRTOS/Source/portable/MemMang/heap_tlsf.c"
+
+/*******************************************************************************
+ *                                  Trace                                      *
+ *******************************************************************************/
+typedef struct
+{
+    uint32_t size;              /* 0 frees the allocation of slot */
+    uint32_t slot;
+} Operation;
+
+typedef struct
+{
+    const char *pName;
+    void *(*pMalloc)(size_t);
+    void (*pFree)(void *);
+    size_t (*pFreeBytes)(void);
+    void (*pFreeBlocks)(size_t *pLargest, size_t *pCount);
+} Heap;
+
+static uint64_t RandomState;
+
+static uint32_t Random(void)
+{
+    /* xorshift64* */
+    RandomState ^= RandomState >> 12;
+    RandomState ^= RandomState << 25;
+    RandomState ^= RandomState >> 27;
+    return (uint32_t)((RandomState * 2685821657736338717ULL) >> 32);
+}
+
+static uint32_t RandomBetween(uint32_t low, uint32_t high)
+{
+    return low + Random() % (high - low + 1U);
+}
+
+/* Request size of the current phase mix */
+static uint32_t RandomSize(uint32_t phase)
+{
+    uint32_t draw = Random() % 100U;
+    uint32_t largeShare = (phase % 2U == 0U) ? 5U : 20U;
+    uint32_t frameShare = (phase % 2U == 0U) ? 25U : 50U;
+
+    if (draw < largeShare)
+    {
+        return RandomBetween(256U, 1024U);      /* Large buffers */
+    }
+    if (draw < largeShare + frameShare)
+    {
+        return RandomBetween(64U, 240U);        /* Telemetry frames */
+    }
+    return RandomBetween(12U, 64U);             /* Failure messages */
+}
+
+/* Allocations and frees that never hold more than SIM_LOAD_PERCENT of the heap */
+static uint32_t MakeTrace(Operation *pTrace, uint32_t operations)
+{
+    uint32_t liveSize[SIM_MAX_LIVE] = { 0 };
+    uint32_t liveSlots[SIM_MAX_LIVE];
+    uint32_t numberLive = 0;
+    uint32_t liveBytes = 0;
+    uint32_t budget = SIM_HEAP_SIZE * SIM_LOAD_PERCENT / 100U;
+    uint32_t i;
+    uint32_t pick;
+    uint32_t size;
+    uint32_t slot;
+
+    for (i = 0; i < SIM_MAX_LIVE; i++)
+    {
+        liveSlots[i] = i;
+    }
+    for (i = 0; i < operations; i++)
+    {
+        size = RandomSize(i / SIM_PHASE_OPERATIONS);
+        if (numberLive < SIM_MAX_LIVE && liveBytes + size <= budget && (numberLive == 0U || Random() % 2U == 0U))
+        {
+            slot = liveSlots[numberLive++];
+            liveSize[slot] = size;
+            liveBytes += size;
+            pTrace[i].size = size;
+            pTrace[i].slot = slot;
+        }
+        else
+        {
+            /* Free a random live allocation */
+            pick = Random() % numberLive;
+            slot = liveSlots[pick];
+            liveSlots[pick] = liveSlots[--numberLive];
+            liveSlots[numberLive] = slot;
+            liveBytes -= liveSize[slot];
+            pTrace[i].size = 0U;
+            pTrace[i].slot = slot;
+        }
+    }
+    return operations;
+}
+
+/*******************************************************************************
+ *                               Heap walkers                                  *
+ *******************************************************************************/
+static void Heap2_FreeBlocks(size_t *pLargest, size_t *pCount)
+{
+    BlockLink_t *pBlock;
+
+    *pLargest = 0;
+    *pCount = 0;
+    for (pBlock = xStart.pxNextFreeBlock; pBlock != NULL && pBlock != &xEnd; pBlock = pBlock->pxNextFreeBlock)
+    {
+        /* Sorted by size, the last one is the largest */
+        *pLargest = pBlock->xBlockSize;
+        (*pCount)++;
+    }
+}
+
+static void Tlsf_FreeBlocks(size_t *pLargest, size_t *pCount)
+{
+    TlsfBlock_t *pBlock;
+
+    *pLargest = 0;
+    *pCount = 0;
+    if (pxHeapEnd == NULL)
+    {
+        return;
+    }
+    for (pBlock = pxHeapEnd; pBlock->pxPrevPhysicalBlock != NULL; pBlock = pBlock->pxPrevPhysicalBlock)
+    {
+        /* Every block must end where the next one starts */
+        assert(heapNEXT_PHYSICAL_BLOCK(pBlock->pxPrevPhysicalBlock) == pBlock);
+        if (heapBLOCK_IS_FREE(pBlock->pxPrevPhysicalBlock))
+        {
+            /* Two free neighbours would have been merged */
+            assert(!heapBLOCK_IS_FREE(pBlock));
+            if (heapBLOCK_SIZE(pBlock->pxPrevPhysicalBlock) > *pLargest)
+            {
+                *pLargest = heapBLOCK_SIZE(pBlock->pxPrevPhysicalBlock);
+            }
+            (*pCount)++;
+        }
+    }
+}
+
+/*******************************************************************************
+ *                                  Replay                                     *
+ *******************************************************************************/
+static uint32_t MallocLatency[SIM_LATENCY_BUCKETS];
+static uint32_t FreeLatency[SIM_LATENCY_BUCKETS];
+
+static uint64_t NowNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+static void Record(uint32_t *pHistogram, uint64_t ns)
+{
+    pHistogram[(ns < SIM_LATENCY_BUCKETS) ? ns : (SIM_LATENCY_BUCKETS - 1U)]++;
+}
+
+static uint32_t Percentile(const uint32_t *pHistogram, double fraction)
+{
+    uint64_t total = 0;
+    uint64_t seen = 0;
+    uint32_t i;
+
+    for (i = 0; i < SIM_LATENCY_BUCKETS; i++)
+    {
+        total += pHistogram[i];
+    }
+    for (i = 0; i < SIM_LATENCY_BUCKETS; i++)
+    {
+        seen += pHistogram[i];
+        if (seen > 0U && (double)seen >= fraction * (double)total)
+        {
+            return i;
+        }
+    }
+    return SIM_LATENCY_BUCKETS - 1U;
+}
+
+static void Replay(const Heap *pHeap, const Operation *pTrace, uint32_t operations)
+{
+    static void *Pointers[SIM_MAX_LIVE];
+    uint64_t start;
+    uint64_t elapsed;
+    size_t largest;
+    size_t blocks;
+    size_t freeBytes;
+    size_t mostBlocks = 0;
+    double fragmentation;
+    double fragmentationSum = 0.0;
+    double worstFragmentation = 0.0;
+    uint32_t samples = 0;
+    uint32_t allocations = 0;
+    uint32_t failed = 0;
+    uint32_t failedFragmented = 0;
+    uint32_t i;
+
+    memset(Pointers, 0, sizeof(Pointers));
+    memset(MallocLatency, 0, sizeof(MallocLatency));
+    memset(FreeLatency, 0, sizeof(FreeLatency));
+
+    for (i = 0; i < operations; i++)
+    {
+        if (pTrace[i].size != 0U)
+        {
+            allocations++;
+            start = NowNs();
+            Pointers[pTrace[i].slot] = pHeap->pMalloc(pTrace[i].size);
+            elapsed = NowNs() - start;
+            Record(MallocLatency, elapsed);
+            if (Pointers[pTrace[i].slot] == NULL)
+            {
+                failed++;
+                /* A header and alignment more than the request would have been enough */
+                if (pHeap->pFreeBytes() >= pTrace[i].size + 2U * sizeof(BlockLink_t))
+                {
+                    failedFragmented++;
+                }
+            }
+            else
+            {
+                memset(Pointers[pTrace[i].slot], 0xA5, pTrace[i].size);
+            }
+        }
+        else if (Pointers[pTrace[i].slot] != NULL)
+        {
+            start = NowNs();
+            pHeap->pFree(Pointers[pTrace[i].slot]);
+            elapsed = NowNs() - start;
+            Record(FreeLatency, elapsed);
+            Pointers[pTrace[i].slot] = NULL;
+        }
+
+        if (i % SIM_SAMPLE_OPERATIONS == 0U)
+        {
+            pHeap->pFreeBlocks(&largest, &blocks);
+            freeBytes = pHeap->pFreeBytes();
+            fragmentation = (freeBytes != 0U) ? 1.0 - (double)largest / (double)freeBytes : 0.0;
+            fragmentationSum += fragmentation;
+            worstFragmentation = (fragmentation > worstFragmentation) ? fragmentation : worstFragmentation;
+            mostBlocks = (blocks > mostBlocks) ? blocks : mostBlocks;
+            samples++;
+        }
+    }
+
+    printf("%-8s %9u %7u %12u %9.1f %% %7.1f %% %8zu %8u %8u %8u %8u\n", pHeap->pName, allocations, failed,
+           failedFragmented, 100.0 * fragmentationSum / samples, 100.0 * worstFragmentation, mostBlocks,
+           Percentile(MallocLatency, 0.999), Percentile(MallocLatency, 1.0),
+           Percentile(FreeLatency, 0.999), Percentile(FreeLatency, 1.0));
+}
+
+int main(int argc, char **argv)
+{
+    static const Heap Heaps[] = {
+        { "heap_2", Heap2_Malloc, Heap2_Free, Heap2_GetFreeHeapSize, Heap2_FreeBlocks },
+        { "tlsf", Tlsf_Malloc, Tlsf_Free, Tlsf_GetFreeHeapSize, Tlsf_FreeBlocks }
+    };
+    uint64_t seed = (argc > 1) ? strtoull(argv[1], NULL, 0) : 1U;
+    uint32_t operations = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 1000000U;
+    Operation *pTrace = malloc(sizeof(Operation) * operations);
+    uint32_t i;
+
+    if (pTrace == NULL || operations == 0U)
+    {
+        fprintf(stderr, "usage: %s [seed] [operations]\n", argv[0]);
+        return 1;
+    }
+    RandomState = (seed != 0U) ? seed : 1U;
+    MakeTrace(pTrace, operations);
+
+    printf("heap %u bytes, load up to %u %%, %u operations, seed %llu\n\n", SIM_HEAP_SIZE, SIM_LOAD_PERCENT,
+           operations, (unsigned long long)seed);
+    printf("%-8s %9s %7s %12s %11s %9s %8s %8s %8s %8s %8s\n", "heap", "allocs", "failed", "fragmented",
+           "frag avg", "frag max", "blocks", "malloc", "malloc", "free", "free");
+    printf("%-8s %9s %7s %12s %11s %9s %8s %8s %8s %8s %8s\n", "", "", "", "failures", "", "", "max",
+           "p99.9 ns", "max ns", "p99.9 ns", "max ns");
+    for (i = 0; i < sizeof(Heaps) / sizeof(Heaps[0]); i++)
+    {
+        Replay(&Heaps[i], pTrace, operations);
+    }
+    free(pTrace);
+    return 0;
+}
@@ -0,0 +1,118 @@
+/******************************************************************************
+ *
+ * Tool: hw_sim_smoke
+ *
+ * File Name: hw_sim_smoke.c
+ *
+ * Description: Host build of the MCAL drivers on the emulated peripheral
+ *              block (MCAL/hw_sim.c), the drivers are compiled in unchanged
+ *              with TM4C_HOST_SIM. Runs the start-up of Port, Dio, ADC0, the
+ *              GPTM timers, PWM and EEPROM as prvSetupHardware does, then
+ *              checks the registers they leave behind against the values the
+ *              datasheet and their configuration call for, and drives a Dio
+ *              output and a PWM duty through the registers.
+ *
+ *              This covers the drivers only, with the registers standing
+ *              still. firmware_sim.c runs them with main.c and the kernel on
+ *              a board that moves the registers in virtual time.
+ *
+ *              Build: gcc -O2 -DTM4C_HOST_SIM
+ *                         -I../FreeRTOS_Project_SeatControllerSystem
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Common
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/PORT
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/DIO
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/ADC
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/GPTM
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/PWM
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/EEPROM
+ *                         -o hw_sim_smoke hw_sim_smoke.c
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "hw_sim.c"
+#include "Port.c"
+#include "Port_PBcfg.c"
+#include "Dio.c"
+#include "Dio_PBcfg.c"
+#include "adc.c"
+#include "GPTM.c"
+#include "PWM.c"
+#include "Eeprom.c"
+
+static uint32 Smoke_Failures;
+static uint32 Smoke_Checks;
+static uint32 Smoke_DetErrors;
+
+/* Det.c stops in a loop, a configuration error is counted instead */
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+    printf("Det error: module %u instance %u api %u error %u\n", ModuleId, InstanceId, ApiId, ErrorId);
+    Smoke_DetErrors++;
+    return E_OK;
+}
+
+static void Smoke_Expect(const char *pName, uint32 ulValue, uint32 ulExpected)
+{
+    Smoke_Checks++;
+    if (ulValue != ulExpected)
+    {
+        printf("FAIL %s: 0x%08x, expected 0x%08x\n", pName, ulValue, ulExpected);
+        Smoke_Failures++;
+    }
+}
+
+static void Smoke_TimeoutCallback(void)
+{
+}
+
+int main(void)
+{
+    Port_Init(&Port_Configuration);
+    Dio_Init(&Dio_Configuration);
+    ADC0_Init();
+    GPTM_WTimer0Init(0, Smoke_TimeoutCallback);
+    GPTM_WTimer1Init(Smoke_TimeoutCallback);
+    PWM_Init();
+    Smoke_Expect("Eeprom_Init", Eeprom_Init(), E_OK);
+
+    /* Port: PF1-PF3 LEDs out, PF0/PF4 switches in, PB6 on T0CCP0 (PCTL 7) */
+    Smoke_Expect("GPIOF DIR LEDs", GPIO_PORTF_DIR_REG & 0x1FU, 0x0EU);
+    Smoke_Expect("GPIOF DEN", GPIO_PORTF_DEN_REG & 0x1FU, 0x1FU);
+    Smoke_Expect("GPIOB PCTL PB6", (GPIO_PORTB_PCTL_REG >> 24) & 0xFU, 7U);
+
+    /* Dio: the red LED through the masked data register */
+    Dio_WriteChannel(DioConf_RED_LED_CHANNEL_ID_INDEX, STD_HIGH);
+    Smoke_Expect("red LED on", (GPIO_PORTF_DATA_REG >> 1) & 1U, 1U);
+    Smoke_Expect("red LED read", Dio_ReadChannel(DioConf_RED_LED_CHANNEL_ID_INDEX), STD_HIGH);
+    Dio_WriteChannel(DioConf_RED_LED_CHANNEL_ID_INDEX, STD_LOW);
+    Smoke_Expect("red LED off", (GPIO_PORTF_DATA_REG >> 1) & 1U, 0U);
+
+    /* ADC0 sequencer 0: AIN0 then AIN1, the interrupt on the last step, averaging */
+    Smoke_Expect("ADC0 SSMUX0", ADC0_ADCSSMUX0_REG, 0x10U);
+    Smoke_Expect("ADC0 SSCTL0", ADC0_ADCSSCTL0_REG, 0x60U);
+    Smoke_Expect("ADC0 SAC", ADC0_ADCSAC_REG, ADC0_SAMPLE_AVERAGING);
+    Smoke_Expect("ADC0 ACTSS", ADC0_ADCACTSS_REG & 1U, 1U);
+    Smoke_Expect("NVIC EN0 ADC0 SS0", (NVIC_EN0_REG >> ADC0_SS0_INTERRUPT_NUMBER) & 1U, 1U);
+
+    /* Timebase: WTimer0A free running from the top */
+    Smoke_Expect("WTimer0 TAILR", WTIMER0_TAILR_REG, 0xFFFFFFFFU);
+
+    /* PWM: Timer0A 16-bit PWM at PWM_FREQUENCY_HZ, 0% then 50% duty */
+    Smoke_Expect("Timer0 CFG", TIMER0_CFG_REG, 0x4U);
+    Smoke_Expect("Timer0 TAILR", TIMER0_TAILR_REG, PWM_PERIOD_TICKS - 1U);
+    Smoke_Expect("Timer0 TAMATCHR 0%", TIMER0_TAMATCHR_REG, PWM_PERIOD_TICKS - 1U);
+    PWM_SetDutyCycle(PWM_TIMER0A_PB6, 50U);
+    Smoke_Expect("Timer0 TAMATCHR 50%", TIMER0_TAMATCHR_REG, (PWM_PERIOD_TICKS - 1U) - ((PWM_PERIOD_TICKS - 1U) / 2U));
+
+    /* EEPROM: clocked and taken through its reset */
+    Smoke_Expect("EEPROM clock", SYSCTL_RCGCEEPROM_REG & 1U, 1U);
+
+    Smoke_Expect("Det errors", Smoke_DetErrors, 0U);
+    printf("%s: %u checks, %u failures, %u emulated peripheral pages\n", (0U == Smoke_Failures) ? "PASS" : "FAIL",
+           Smoke_Checks, Smoke_Failures, (uint32)Sim_PageCount);
+    return (0U == Smoke_Failures) ? 0 : 1;
+}
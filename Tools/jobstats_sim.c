@@ -0,0 +1,214 @@
+/******************************************************************************
+ *
+ * Tool: jobstats_sim
+ *
+ * File Name: jobstats_sim.c
+ *
+ * Description: Host check of the job statistics (Services/JobStats.c is
+ *              compiled in unchanged) driven the way the trace macros in
+ *              FreeRTOSConfig.h drive them, by a 1 us step model of a
+ *              preemptive scheduler running:
+ *              - tag 2, high priority: released every 1 ms with jitter,
+ *                runs 50 to 150 us
+ *              - tag 1, low priority: released every 10 ms, runs 2 to 4 ms,
+ *                preempted by tag 2
+ *              - tag 0, the idle task
+ *              The model steps in microseconds and hands the hooks Timebase
+ *              ticks, as the kernel would. The true execution time (preemptions
+ *              excluded) and wake latency of every job are tracked next to the
+ *              hooks. Count, min, max and
+ *              average have to match exactly, every bucket has to hold the
+ *              jobs in its range and p99 has to lie between the true p99 and
+ *              its bucket bound. Ends with the UART dump of the histograms.
+ *
+ *              Build: gcc -O2 -I../FreeRTOS_Project_SeatControllerSystem
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Common
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Services
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/UART
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/FreeRTOS/Source/include
+ *                         -o jobstats_sim jobstats_sim.c
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+
+/* The kernel and UART0 are replaced by the model below, their headers are skipped */
+#define INC_FREERTOS_H
+#define INC_TASK_H
+#define UART0_H_
+#define taskENTER_CRITICAL()
+#define taskEXIT_CRITICAL()
+
+#include "std_types.h"
+
+static void UART0_SendString(const uint8 *pData)
+{
+    fputs((const char *)pData, stdout);
+}
+
+static void UART0_SendInteger(sint64 sNumber)
+{
+    printf("%lld", (long long)sNumber);
+}
+
+#include "JobStats.c"
+
+#define SIM_DURATION_US     20000000UL  /* 20 s */
+#define SIM_TASKS           3U
+#define SIM_MAX_JOBS        25000U
+
+/* Model time to Timebase ticks */
+#define SIM_TICKS(Us)       ((uint64)(Us) * TIMEBASE_TICKS_PER_US)
+
+typedef struct
+{
+    uint32 ulPeriod;
+    uint32 ulJitter;
+    uint32 ulMinRun;
+    uint32 ulMaxRun;
+    uint32 ulNextRelease;
+    uint32 ulRemaining;        /* Run time left of the current job, 0 when blocked */
+    uint32 ulReleaseTime;
+    uint32 ulRunTime;          /* Of the current job so far */
+    boolean bStarted;          /* Switched in since its release */
+    uint32 ulJobs[JOBSTATS_NUMBER_OF_KINDS];
+    uint32 ulTruth[JOBSTATS_NUMBER_OF_KINDS][SIM_MAX_JOBS];
+} Sim_TaskType;
+
+/* Indexed by tag, the higher the tag the higher the priority, tag 0 idles */
+static Sim_TaskType Sim_Tasks[SIM_TASKS] =
+{
+    { 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, FALSE, {0}, {{0}} },
+    { 10000U, 0U, 2000U, 4000U, 0U, 0U, 0U, 0U, FALSE, {0}, {{0}} },
+    { 1000U, 200U, 50U, 150U, 0U, 0U, 0U, 0U, FALSE, {0}, {{0}} }
+};
+
+static uint32 Sim_Random(uint32 ulMin, uint32 ulMax)
+{
+    return ulMin + (uint32)(rand() % (int)(ulMax - ulMin + 1U));
+}
+
+static int Sim_Compare(const void *pA, const void *pB)
+{
+    uint32 ulA = *(const uint32 *)pA;
+    uint32 ulB = *(const uint32 *)pB;
+    return (ulA > ulB) - (ulA < ulB);
+}
+
+/* Compare one histogram against the true durations, returns the number of mismatches */
+static uint32 Sim_Check(uint8 ucTag, JobStats_KindType Kind)
+{
+    Sim_TaskType *pTask = &Sim_Tasks[ucTag];
+    uint32 *pTruth = pTask->ulTruth[Kind];
+    uint32 ulCount = pTask->ulJobs[Kind];
+    uint32 ulBuckets[JOBSTATS_NUMBER_OF_BUCKETS] = { 0 };
+    JobStats_HistogramType xHistogram;
+    JobStats_SummaryType xSummary;
+    uint64 ullSum = 0;
+    uint32 ulTrueP99;
+    uint32 ulBucket;
+    uint32 ulJob;
+    uint32 ulErrors = 0;
+
+    for (ulJob = 0; ulJob < ulCount; ulJob++)
+    {
+        ullSum += pTruth[ulJob];
+        ulBucket = 32U - JOBSTATS_CLZ(pTruth[ulJob]);
+        ulBuckets[(ulBucket < JOBSTATS_NUMBER_OF_BUCKETS) ? ulBucket : (JOBSTATS_NUMBER_OF_BUCKETS - 1U)]++;
+    }
+    qsort(pTruth, ulCount, sizeof(uint32), Sim_Compare);
+    ulTrueP99 = pTruth[((ulCount * 99U) + 99U) / 100U - 1U];
+
+    JobStats_GetHistogram(ucTag, Kind, &xHistogram);
+    JobStats_GetSummary(ucTag, Kind, &xSummary);
+    for (ulBucket = 0; ulBucket < JOBSTATS_NUMBER_OF_BUCKETS; ulBucket++)
+    {
+        ulErrors += (xHistogram.ulBuckets[ulBucket] != ulBuckets[ulBucket]) ? 1U : 0U;
+    }
+    ulErrors += (xSummary.ulCount != ulCount) ? 1U : 0U;
+    ulErrors += (xSummary.ulMin != pTruth[0]) ? 1U : 0U;
+    ulErrors += (xSummary.ulMax != pTruth[ulCount - 1U]) ? 1U : 0U;
+    ulErrors += (xSummary.ulAverage != (uint32)(ullSum / ulCount)) ? 1U : 0U;
+    ulErrors += ((xSummary.ulP99 < ulTrueP99) || (xSummary.ulP99 > ((ulTrueP99 * 2U) | 1U))) ? 1U : 0U;
+
+    printf("tag %u %-4s %6lu jobs  min %5lu  avg %5lu  p99 %5lu (true %5lu)  max %5lu us  %s\n", ucTag, JobStats_KindNames[Kind],
+           (unsigned long)xSummary.ulCount, (unsigned long)TIMEBASE_TO_US(xSummary.ulMin),
+           (unsigned long)TIMEBASE_TO_US(xSummary.ulAverage), (unsigned long)TIMEBASE_TO_US(xSummary.ulP99),
+           (unsigned long)TIMEBASE_TO_US(ulTrueP99), (unsigned long)TIMEBASE_TO_US(xSummary.ulMax),
+           (0U == ulErrors) ? "ok" : "MISMATCH");
+    return ulErrors;
+}
+
+int main(void)
+{
+    Sim_TaskType *pTask;
+    uint32 ulNow;
+    uint32 ulSwitchIn = 0;
+    uint32 ulErrors = 0;
+    uint8 ucRunning = 0;
+    uint8 ucNext;
+    uint8 ucTag;
+
+    srand(1);
+    JobStats_Reset();
+    JobStats_TaskSwitchedIn(0U, 0U);
+
+    for (ulNow = 0; ulNow < SIM_DURATION_US; ulNow++)
+    {
+        /* Releases, as an interrupt giving a notification would make the task ready */
+        for (ucTag = 1; ucTag < SIM_TASKS; ucTag++)
+        {
+            pTask = &Sim_Tasks[ucTag];
+            if ((ulNow >= pTask->ulNextRelease) && (0U == pTask->ulRemaining))
+            {
+                pTask->ulRemaining = Sim_Random(pTask->ulMinRun, pTask->ulMaxRun);
+                pTask->ulReleaseTime = ulNow;
+                pTask->ulRunTime = 0;
+                pTask->bStarted = FALSE;
+                pTask->ulNextRelease += pTask->ulPeriod + ((0U != pTask->ulJitter) ? Sim_Random(0U, pTask->ulJitter) : 0U);
+                JobStats_TaskReady(ucTag, SIM_TICKS(ulNow));
+            }
+        }
+
+        /* Highest ready task runs, a context switch calls both hooks */
+        for (ucNext = SIM_TASKS - 1U; (ucNext > 0U) && (0U == Sim_Tasks[ucNext].ulRemaining); ucNext--)
+        {
+        }
+        if (ucNext != ucRunning)
+        {
+            JobStats_TaskSwitchedOut(ucRunning, SIM_TICKS(ulNow - ulSwitchIn), ((0U != ucRunning) && (0U == Sim_Tasks[ucRunning].ulRemaining)) ? TRUE : FALSE);
+            JobStats_TaskSwitchedIn(ucNext, SIM_TICKS(ulNow));
+            ulSwitchIn = ulNow;
+            ucRunning = ucNext;
+
+            pTask = &Sim_Tasks[ucRunning];
+            if ((0U != ucRunning) && (FALSE == pTask->bStarted))
+            {
+                pTask->bStarted = TRUE;
+                pTask->ulTruth[JOBSTATS_WAKE_LATENCY][pTask->ulJobs[JOBSTATS_WAKE_LATENCY]++] = (uint32)SIM_TICKS(ulNow - pTask->ulReleaseTime);
+            }
+        }
+
+        /* One microsecond of work, a finished job blocks its task */
+        pTask = &Sim_Tasks[ucRunning];
+        if (0U != ucRunning)
+        {
+            pTask->ulRunTime++;
+            if (0U == --pTask->ulRemaining)
+            {
+                pTask->ulTruth[JOBSTATS_EXECUTION][pTask->ulJobs[JOBSTATS_EXECUTION]++] = (uint32)SIM_TICKS(pTask->ulRunTime);
+            }
+        }
+    }
+
+    for (ucTag = 1; ucTag < SIM_TASKS; ucTag++)
+    {
+        ulErrors += Sim_Check(ucTag, JOBSTATS_EXECUTION);
+        ulErrors += Sim_Check(ucTag, JOBSTATS_WAKE_LATENCY);
+    }
+
+    JobStats_Dump();
+    printf("\n%lu mismatches\n", (unsigned long)ulErrors);
+    return (0U == ulErrors) ? 0 : 1;
+}
@@ -0,0 +1,347 @@
+/******************************************************************************
+ *
+ * Tool: map_ram_report
+ *
+ * File Name: map_ram_report.c
+ *
+ * Description: RAM report from the TI ARM linker map file of the project
+ *              (Debug/FreeRTOS_Project.map). Reads the memory configuration
+ *              and the section allocation map and prints, for the writable
+ *              memories only:
+ *              - used and free bytes of every RAM memory
+ *              - bytes of every output section (.bss, .data, .stack, .sysmem)
+ *              - bytes every object file placed in RAM, largest first, with
+ *                uninitialized common symbols and the unclaimed bytes of a
+ *                section (holes, the system stack) on lines of their own
+ *              - the kernel heap, every heap_*.obj contribution
+ *              Given two maps, e.g. the heap build and the static allocation
+ *              build (configSUPPORT_STATIC_ALLOCATION in FreeRTOSConfig.h),
+ *              every line shows both and the difference.
+ *
+ *              Build: gcc -O2 -o map_ram_report map_ram_report.c
+ *              Usage: map_ram_report first.map [second.map]
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_LINE             512U
+#define MAX_NAME             64U
+#define MAX_MEMORIES         8U
+#define MAX_SECTIONS         32U
+#define MAX_MODULES          128U
+
+/* Object files of the kernel heap implementations start with this */
+#define HEAP_MODULE_PREFIX   "heap_"
+
+typedef struct
+{
+    char name[MAX_NAME];
+    unsigned long bytes[2];             /* In the first and the second map */
+} Entry;
+
+typedef struct
+{
+    unsigned long origin;
+    unsigned long length;
+} Range;
+
+static Entry Memories[MAX_MEMORIES];    /* bytes[] holds the used bytes, Free[] the rest */
+static unsigned long Free[MAX_MEMORIES][2];
+static unsigned NumberOfMemories = 0;
+static Entry Sections[MAX_SECTIONS];
+static unsigned NumberOfSections = 0;
+static Entry Modules[MAX_MODULES];
+static unsigned NumberOfModules = 0;
+
+/* Writable memories of the map being read */
+static Range RamRanges[MAX_MEMORIES];
+static unsigned NumberOfRamRanges = 0;
+
+static Entry *Find(Entry *pEntries, unsigned *pCount, unsigned max, const char *pName)
+{
+    unsigned i;
+
+    for (i = 0; i < *pCount; i++)
+    {
+        if (strcmp(pEntries[i].name, pName) == 0)
+        {
+            return &pEntries[i];
+        }
+    }
+    if (*pCount == max)
+    {
+        fprintf(stderr, "more than %u entries, %s not counted\n", max, pName);
+        return NULL;
+    }
+    memset(&pEntries[*pCount], 0, sizeof(Entry));
+    strncpy(pEntries[*pCount].name, pName, MAX_NAME - 1U);
+    return &pEntries[(*pCount)++];
+}
+
+static void Add(Entry *pEntries, unsigned *pCount, unsigned max, const char *pName, int map, unsigned long bytes)
+{
+    Entry *pEntry = Find(pEntries, pCount, max, pName);
+
+    if (pEntry != NULL)
+    {
+        pEntry->bytes[map] += bytes;
+    }
+}
+
+static int InRam(unsigned long origin)
+{
+    unsigned i;
+
+    for (i = 0; i < NumberOfRamRanges; i++)
+    {
+        if (origin >= RamRanges[i].origin && origin < RamRanges[i].origin + RamRanges[i].length)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Object file an input section came from, "heap_2.obj (.bss:ucHeap)" -> "heap_2.obj",
+ * "rtsv7M4_T_le_v4SPD16_eabi.lib : boot_cortex_m.c.obj (.stack)" -> "boot_cortex_m.c.obj" */
+static void ModuleName(const char *pDescription, const char *pSection, char *pName)
+{
+    const char *pStart = pDescription;
+    const char *pLibrary = strstr(pDescription, " : ");
+    size_t length;
+
+    if (strncmp(pDescription, "--HOLE--", 8) == 0)
+    {
+        /* Mostly the part of the system stack no object file claims */
+        snprintf(pName, MAX_NAME, "(unclaimed %s)", pSection);
+        return;
+    }
+    if (strncmp(pDescription, "(.common:", 9) == 0)
+    {
+        strcpy(pName, "(common symbols)");
+        return;
+    }
+    if (pLibrary != NULL)
+    {
+        pStart = pLibrary + 3;
+    }
+    length = strcspn(pStart, " \t\r\n");
+    if (length >= MAX_NAME)
+    {
+        length = MAX_NAME - 1U;
+    }
+    memcpy(pName, pStart, length);
+    pName[length] = '\0';
+}
+
+static int ReadMap(const char *pPath, int map)
+{
+    enum { OTHER, MEMORY_CONFIGURATION, SECTION_ALLOCATION } part = OTHER;
+    FILE *pFile = fopen(pPath, "r");
+    char line[MAX_LINE];
+    char name[MAX_NAME];
+    char section[MAX_NAME] = "";
+    char pending[MAX_NAME] = "";
+    char attributes[16];
+    unsigned long origin;
+    unsigned long length;
+    unsigned long used;
+    unsigned long unused;
+    int inRam = 0;
+    int offset;
+    Entry *pMemory;
+
+    if (pFile == NULL)
+    {
+        perror(pPath);
+        return 0;
+    }
+
+    NumberOfRamRanges = 0;
+    while (fgets(line, sizeof(line), pFile) != NULL)
+    {
+        if (strncmp(line, "MEMORY CONFIGURATION", 20) == 0)
+        {
+            part = MEMORY_CONFIGURATION;
+            continue;
+        }
+        if (strncmp(line, "SECTION ALLOCATION MAP", 22) == 0)
+        {
+            part = SECTION_ALLOCATION;
+            continue;
+        }
+        if (strncmp(line, "SEGMENT ALLOCATION MAP", 22) == 0 || strncmp(line, "MODULE SUMMARY", 14) == 0)
+        {
+            part = OTHER;
+            continue;
+        }
+
+        if (part == MEMORY_CONFIGURATION)
+        {
+            /* "  SRAM   20000000   00008000  00002302  00005cfe  RW X", writable memories only */
+            if (sscanf(line, "%63s %lx %lx %lx %lx %15s", name, &origin, &length, &used, &unused, attributes) == 6 &&
+                strchr(attributes, 'W') != NULL && NumberOfRamRanges < MAX_MEMORIES)
+            {
+                RamRanges[NumberOfRamRanges].origin = origin;
+                RamRanges[NumberOfRamRanges++].length = length;
+                pMemory = Find(Memories, &NumberOfMemories, MAX_MEMORIES, name);
+                if (pMemory != NULL)
+                {
+                    pMemory->bytes[map] = used;
+                    Free[pMemory - Memories][map] = unused;
+                }
+            }
+        }
+        else if (part == SECTION_ALLOCATION && line[0] != '\n' && line[0] != '\r')
+        {
+            if (line[0] != ' ')
+            {
+                /* Output section: ".bss  0  20000000  000020a4  UNINITIALIZED", a long name
+                 * stands alone and the rest follows on the next line behind a '*' */
+                if (line[0] == '*' && pending[0] != '\0' &&
+                    sscanf(line + 1, "%*u %lx %lx", &origin, &length) == 2)
+                {
+                    strcpy(name, pending);
+                }
+                else if (sscanf(line, "%63s %*u %lx %lx", name, &origin, &length) != 3)
+                {
+                    if (sscanf(line, "%63s", pending) != 1 || strcmp(pending, "output") == 0 ||
+                        strcmp(pending, "section") == 0 || pending[0] == '-')
+                    {
+                        pending[0] = '\0';
+                    }
+                    inRam = 0;
+                    continue;
+                }
+                pending[0] = '\0';
+                inRam = InRam(origin) && length != 0UL;
+                strcpy(section, name);
+                if (inRam)
+                {
+                    Add(Sections, &NumberOfSections, MAX_SECTIONS, name, map, length);
+                }
+            }
+            else if (inRam && sscanf(line, " %lx %lx %n", &origin, &length, &offset) == 2)
+            {
+                /* Input section: "   20000000    00001f40     heap_2.obj (.bss:ucHeap)" */
+                ModuleName(line + offset, section, name);
+                Add(Modules, &NumberOfModules, MAX_MODULES, name, map, length);
+            }
+        }
+    }
+    fclose(pFile);
+
+    if (NumberOfRamRanges == 0U)
+    {
+        fprintf(stderr, "%s: no writable memory in the memory configuration, not a TI linker map?\n", pPath);
+        return 0;
+    }
+    return 1;
+}
+
+static int Larger(const void *pA, const void *pB)
+{
+    const Entry *a = (const Entry *)pA;
+    const Entry *b = (const Entry *)pB;
+    unsigned long sizeA = (a->bytes[0] > a->bytes[1]) ? a->bytes[0] : a->bytes[1];
+    unsigned long sizeB = (b->bytes[0] > b->bytes[1]) ? b->bytes[0] : b->bytes[1];
+
+    return (sizeA < sizeB) ? 1 : (sizeA > sizeB) ? -1 : strcmp(a->name, b->name);
+}
+
+static void PrintRow(const char *pName, const unsigned long *pBytes, int maps)
+{
+    if (maps == 1)
+    {
+        printf("  %-32s %8lu\n", pName, pBytes[0]);
+    }
+    else
+    {
+        printf("  %-32s %8lu %8lu %+9ld\n", pName, pBytes[0], pBytes[1], (long)pBytes[1] - (long)pBytes[0]);
+    }
+}
+
+static void PrintHeader(const char *pTitle, int maps)
+{
+    if (maps == 1)
+    {
+        printf("\n  %-32s %8s\n", pTitle, "bytes");
+    }
+    else
+    {
+        printf("\n  %-32s %8s %8s %9s\n", pTitle, "first", "second", "change");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int maps = argc - 1;
+    unsigned long heap[2] = { 0UL, 0UL };
+    unsigned long total[2] = { 0UL, 0UL };
+    unsigned long rest[2];
+    unsigned i;
+    int map;
+
+    if (maps < 1 || maps > 2)
+    {
+        fprintf(stderr, "usage: %s first.map [second.map]\n", argv[0]);
+        return 2;
+    }
+    for (map = 0; map < maps; map++)
+    {
+        if (!ReadMap(argv[map + 1], map))
+        {
+            return 1;
+        }
+    }
+
+    printf("RAM report of %s", argv[1]);
+    if (maps == 2)
+    {
+        printf(" (first) and %s (second)", argv[2]);
+    }
+    printf("\n");
+
+    PrintHeader("memory used", maps);
+    for (i = 0; i < NumberOfMemories; i++)
+    {
+        PrintRow(Memories[i].name, Memories[i].bytes, maps);
+    }
+    PrintHeader("memory free", maps);
+    for (i = 0; i < NumberOfMemories; i++)
+    {
+        PrintRow(Memories[i].name, Free[i], maps);
+    }
+
+    qsort(Sections, NumberOfSections, sizeof(Entry), Larger);
+    PrintHeader("output section", maps);
+    for (i = 0; i < NumberOfSections; i++)
+    {
+        PrintRow(Sections[i].name, Sections[i].bytes, maps);
+    }
+
+    qsort(Modules, NumberOfModules, sizeof(Entry), Larger);
+    PrintHeader("object file", maps);
+    for (i = 0; i < NumberOfModules; i++)
+    {
+        PrintRow(Modules[i].name, Modules[i].bytes, maps);
+        for (map = 0; map < maps; map++)
+        {
+            total[map] += Modules[i].bytes[map];
+            if (strncmp(Modules[i].name, HEAP_MODULE_PREFIX, strlen(HEAP_MODULE_PREFIX)) == 0)
+            {
+                heap[map] += Modules[i].bytes[map];
+            }
+        }
+    }
+    printf("  --------------------------------\n");
+    PrintRow("total", total, maps);
+    PrintRow("kernel heap (" HEAP_MODULE_PREFIX "*.obj)", heap, maps);
+    rest[0] = total[0] - heap[0];
+    rest[1] = total[1] - heap[1];
+    PrintRow("everything else", rest, maps);
+    return 0;
+}
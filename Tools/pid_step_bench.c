@@ -0,0 +1,127 @@
+/******************************************************************************
+ *
+ * Tool: pid_step_bench
+ *
+ * File Name: pid_step_bench.c
+ *
+ * Description: Host step-response benchmark of the firmware PID controller
+ *              (Services/PidController.c is compiled in unchanged) against the
+ *              previous threshold ladder of vHeaterMonitorTask. Both drive the
+ *              same first order seat model with a sensor lag:
+ *
+ *                  dT/dt = (T_ambient + HEATER_RISE * duty - T) / TAU
+ *
+ *              and each is sampled every SAMPLE_PERIOD_MS with the reading
+ *              quantised to 0.1 C. For a step of the setpoint the tool
+ *              reports the overshoot, the settling time into a +/-0.5 C band
+ *              and the residual ripple.
+ *
+ *              Build: gcc -O2 -I../FreeRTOS_Project_SeatControllerSystem
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Common
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Services
+ *                         -o pid_step_bench pid_step_bench.c -lm
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include <stdio.h>
+#include <math.h>
+#include <stdint.h>
+
+#include "PidController.c"
+#include "FreeRTOS_Project.h"
+
+#define SAMPLE_PERIOD_MS     HEATER_CONTROL_PERIOD_MS
+#define SIM_STEP_S           0.01
+#define SIM_DURATION_S       1800.0
+#define AMBIENT_C            20.0
+#define HEATER_RISE_C        30.0    /* Steady state rise at 100 % */
+#define TAU_S                180.0   /* Seat thermal time constant */
+#define SENSOR_TAU_S         8.0     /* Sensor to seat surface lag */
+#define SETTLE_BAND_C        0.5
+
+typedef enum { BENCH_PID, BENCH_LADDER } Bench_ControllerType;
+
+/* Previous vHeaterMonitorTask ladder and the duty each level now maps to */
+static uint8 Bench_Ladder(sint16 sSetpoint, sint16 sMeasurement, uint8 ucLast)
+{
+    sint16 sError = sSetpoint - sMeasurement;
+
+    if (sError >= 100)      return HIGH_HEATER_DUTY_PERCENT;
+    else if (sError >= 50)  return MEDIUM_HEATER_DUTY_PERCENT;
+    else if (sError > 20)   return LOW_HEATER_DUTY_PERCENT;
+    else if (-sError <= 30) return 0;
+    else                    return ucLast;
+}
+
+static void Bench_Run(Bench_ControllerType Controller, const char *pName, double dSetpoint)
+{
+    const PidController_ConfigType xConfig = HEATER_PID_CONFIG;
+    PidController_Type xPid;
+    double dSeat = AMBIENT_C;
+    double dSensor = AMBIENT_C;
+    double dTime;
+    double dNextSample = 0.0;
+    double dPeak = AMBIENT_C;
+    double dSettled = -1.0;
+    double dRippleMin = 1000.0;
+    double dRippleMax = -1000.0;
+    uint8 ucDuty = 0;
+    sint16 sReading;
+
+    PidController_Init(&xPid, &xConfig);
+
+    for (dTime = 0.0; dTime < SIM_DURATION_S; dTime += SIM_STEP_S)
+    {
+        if (dTime >= dNextSample)
+        {
+            sReading = (sint16)lround(dSensor * 10.0);
+            ucDuty = (BENCH_PID == Controller) ? PidController_Update(&xPid, (sint16)lround(dSetpoint * 10.0), sReading)
+                                               : Bench_Ladder((sint16)lround(dSetpoint * 10.0), sReading, ucDuty);
+            dNextSample += SAMPLE_PERIOD_MS / 1000.0;
+        }
+
+        dSeat += SIM_STEP_S * (AMBIENT_C + HEATER_RISE_C * ucDuty / 100.0 - dSeat) / TAU_S;
+        dSensor += SIM_STEP_S * (dSeat - dSensor) / SENSOR_TAU_S;
+
+        dPeak = fmax(dPeak, dSeat);
+        if (fabs(dSeat - dSetpoint) > SETTLE_BAND_C)
+        {
+            dSettled = -1.0;
+        }
+        else if (dSettled < 0.0)
+        {
+            dSettled = dTime;
+        }
+        if (dTime > SIM_DURATION_S - 300.0)
+        {
+            dRippleMin = fmin(dRippleMin, dSeat);
+            dRippleMax = fmax(dRippleMax, dSeat);
+        }
+    }
+
+    printf("%-7s %4.1f C  overshoot %5.2f C  settling ", pName, dSetpoint, fmax(0.0, dPeak - dSetpoint));
+    if (dSettled < 0.0)
+    {
+        printf("  never  ");
+    }
+    else
+    {
+        printf("%6.0f s ", dSettled);
+    }
+    printf(" final %5.2f C  ripple %4.2f C\n", dSeat, dRippleMax - dRippleMin);
+}
+
+int main(void)
+{
+    const double adSetpoints[] = {LOW_SEAT_HEATING_TEMPERATURE, MEDIUM_SEAT_HEATING_TEMPERATURE, HIGH_SEAT_HEATING_TEMPERATURE};
+    unsigned uIndex;
+
+    printf("seat model: ambient %.0f C, +%.0f C at 100 %%, tau %.0f s, sensor lag %.0f s, sample %u ms\n",
+           AMBIENT_C, HEATER_RISE_C, TAU_S, SENSOR_TAU_S, (unsigned)SAMPLE_PERIOD_MS);
+    for (uIndex = 0; uIndex < sizeof(adSetpoints) / sizeof(adSetpoints[0]); uIndex++)
+    {
+        Bench_Run(BENCH_LADDER, "ladder", adSetpoints[uIndex]);
+        Bench_Run(BENCH_PID, "pid", adSetpoints[uIndex]);
+    }
+    return 0;
+}
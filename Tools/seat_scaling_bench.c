@@ -0,0 +1,135 @@
+/******************************************************************************
+ *
+ * Tool: seat_scaling_bench
+ *
+ * File Name: seat_scaling_bench.c
+ *
+ * Description: Host benchmark of the per-seat heater logic (Services/Seat.c
+ *              and the services it uses are compiled in unchanged). One cycle
+ *              is the work the tasks do for every seat: button press, sensor
+ *              filter and conversion, range check and PID step, with their
+ *              sequence lock publishes and snapshots. The cycle is
+ *              timed for 2 to 16 seats and reported in total and per seat
+ *              (TSC on x86, nanoseconds elsewhere, best batch of
+ *              BENCH_BATCH cycles, the host scheduler only ever adds to it).
+ *
+ *              Build: gcc -O2 -I../FreeRTOS_Project_SeatControllerSystem
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Common
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Services
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/PWM
+ *                         -o seat_scaling_bench seat_scaling_bench.c
+ *
+ *              Single threaded, so the sequence lock writer side is built
+ *              without serialization.
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include <stdio.h>
+#include <time.h>
+
+/* One thread, nothing to serialize */
+#define SEQLOCK_WRITER_ENTER()
+#define SEQLOCK_WRITER_EXIT()
+
+#include "SeqLock.c"
+#include "PidController.c"
+#include "SensorFilter.c"
+#include "TempConversion.c"
+#include "Seat.c"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_UNIT "cycles"
+static unsigned long long Bench_Now(void)
+{
+    return __rdtsc();
+}
+#else
+#define BENCH_UNIT "ns"
+static unsigned long long Bench_Now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ULL + (unsigned long long)now.tv_nsec;
+}
+#endif
+
+#define BENCH_MAX_SEATS  16U
+#define BENCH_BATCH      256U
+#define BENCH_BATCHES    2000U
+
+static Seat_ConfigType Bench_Config[BENCH_MAX_SEATS];
+static Seat_StateType Bench_Seats[BENCH_MAX_SEATS];
+static volatile uint8 Bench_Sink;
+
+/* One task cycle over the first ucSeats seats */
+static void Bench_Cycle(uint8 ucSeats, uint32 ulCycle)
+{
+    uint8 ucSeat;
+    uint16 usRaw;
+
+    for (ucSeat = 0; ucSeat < ucSeats; ucSeat++)
+    {
+        /* A press every 64 cycles, a sensor reading around 25 C with some noise */
+        if ((ulCycle & 63U) == (ucSeat & 63U))
+        {
+            (void)Seat_HandlePress(&Bench_Seats[ucSeat]);
+        }
+        usRaw = (uint16)(2275U + ((ulCycle * 7U + ucSeat * 13U) & 15U));
+        Seat_SetTemperature(&Bench_Config[ucSeat], &Bench_Seats[ucSeat], Seat_FilterSample(&Bench_Seats[ucSeat], usRaw));
+        (void)Seat_CheckSensor(&Bench_Config[ucSeat], &Bench_Seats[ucSeat], ulCycle);
+        Seat_UpdateHeater(&Bench_Seats[ucSeat]);
+        Bench_Sink = Bench_Seats[ucSeat].xShared.ucHeaterDuty;
+    }
+}
+
+int main(void)
+{
+    const PidController_ConfigType xPidConfig = HEATER_PID_CONFIG;
+    const uint8 aucSeatCounts[] = {2, 4, 6, 8, 12, 16};
+    unsigned long long ullStart;
+    unsigned long long ullCost;
+    unsigned long long ullBest;
+    uint32 ulCycle = 0;
+    unsigned uCount;
+    unsigned uBatch;
+    unsigned uIndex;
+    uint8 ucSeat;
+
+    TempConv_Init();
+    for (ucSeat = 0; ucSeat < BENCH_MAX_SEATS; ucSeat++)
+    {
+        Bench_Config[ucSeat].ucAdcStep = ucSeat % TEMP_CONV_NUMBER_OF_CHANNELS;
+        Bench_Config[ucSeat].pFailureMessage = "Invalid Temperature Sensor Range ";
+        Bench_Config[ucSeat].xFilter.ucMedianSize = 5U;
+        Bench_Config[ucSeat].xFilter.ucIirShift = 2U;
+    }
+
+    printf("seat state %u bytes, descriptor %u bytes\n", (unsigned)sizeof(Seat_StateType), (unsigned)sizeof(Seat_ConfigType));
+    printf("seats  %s/cycle  %s/seat\n", BENCH_UNIT, BENCH_UNIT);
+    for (uCount = 0; uCount < sizeof(aucSeatCounts); uCount++)
+    {
+        for (ucSeat = 0; ucSeat < BENCH_MAX_SEATS; ucSeat++)
+        {
+            Seat_Init(&Bench_Config[ucSeat], &Bench_Seats[ucSeat], &xPidConfig);
+        }
+
+        ullBest = ~0ULL;
+        for (uBatch = 0; uBatch < BENCH_BATCHES; uBatch++)
+        {
+            ullStart = Bench_Now();
+            for (uIndex = 0; uIndex < BENCH_BATCH; uIndex++)
+            {
+                Bench_Cycle(aucSeatCounts[uCount], ulCycle++);
+            }
+            ullCost = Bench_Now() - ullStart;
+            if (ullCost < ullBest)
+            {
+                ullBest = ullCost;
+            }
+        }
+        printf("%5u  %12.1f  %10.1f\n", (unsigned)aucSeatCounts[uCount],
+               (double)ullBest / BENCH_BATCH, (double)ullBest / BENCH_BATCH / aucSeatCounts[uCount]);
+    }
+    return 0;
+}
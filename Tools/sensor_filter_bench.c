@@ -0,0 +1,149 @@
+/******************************************************************************
+ *
+ * Tool: sensor_filter_bench
+ *
+ * File Name: sensor_filter_bench.c
+ *
+ * Description: Host benchmark of the firmware sensor filter chain
+ *              (Services/SensorFilter.c is compiled in unchanged). Feeds a
+ *              noisy LM35-like signal with injected spikes through one
+ *              channel, once per filter configuration a seat can choose
+ *              (SensorFilter_ConfigType), and reports for each the average
+ *              and best-batch cycles per
+ *              sample (TSC on x86, nanoseconds elsewhere), the largest output
+ *              error once the filter has settled and how many spikes reached
+ *              the output. The best batch is the figure to compare, the host
+ *              scheduler only ever adds to the others.
+ *
+ *              Build: gcc -O2 -I../FreeRTOS_Project_SeatControllerSystem
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Common
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Services
+ *                         -o sensor_filter_bench sensor_filter_bench.c
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "SensorFilter.c"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_UNIT "cycles"
+static unsigned long long Bench_Now(void)
+{
+    return __rdtsc();
+}
+#else
+#define BENCH_UNIT "ns"
+static unsigned long long Bench_Now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ULL + (unsigned long long)now.tv_nsec;
+}
+#endif
+
+#define BENCH_SAMPLES      1000000UL
+#define BENCH_BATCH        64UL
+#define BENCH_SIGNAL       2048U   /* ~22.5 degrees on the 0..45 degree scale */
+#define BENCH_NOISE        8U      /* +/- counts of white noise */
+#define BENCH_SPIKE_EVERY  97UL    /* One single-sample spike every N samples */
+#define BENCH_SPIKE        1500U
+#define BENCH_SETTLE       32UL    /* Samples ignored by the quality pass while the filter primes */
+
+/* Seat configurations compared: no filter, median only, IIR only, and the default of Seat_PBcfg.c */
+static const SensorFilter_ConfigType Bench_Configs[] =
+{
+    { 1U, 0U },
+    { 3U, 0U },
+    { 1U, 2U },
+    { 3U, 2U },
+    { 5U, 2U },
+    { 5U, 3U }
+};
+
+static uint16 Bench_Input[BENCH_SAMPLES];
+
+static void Bench_Run(const SensorFilter_ConfigType *pConfig)
+{
+    SensorFilter_StateType xState;
+    unsigned long long ullStart;
+    unsigned long long ullCost;
+    unsigned long long ullTotal = 0;
+    unsigned long long ullBest = ~0ULL;
+    volatile uint16 usSink = 0;
+    unsigned long ulSample;
+    unsigned long ulBatch;
+    unsigned long ulSpikesPassed = 0;
+    int iMaxError = 0;
+    int iError;
+    uint16 usOutput;
+
+    /* Quality pass */
+    SensorFilter_Init(&xState, pConfig);
+    for (ulSample = 0; ulSample < BENCH_SAMPLES; ulSample++)
+    {
+        usOutput = SensorFilter_Process(&xState, Bench_Input[ulSample]);
+        iError = abs((int)usOutput - (int)BENCH_SIGNAL);
+        if (ulSample < BENCH_SETTLE)
+        {
+            continue;
+        }
+        if (iError > iMaxError)
+        {
+            iMaxError = iError;
+        }
+        if (iError > (int)(BENCH_SPIKE / 4U))
+        {
+            ulSpikesPassed++;
+        }
+    }
+
+    /* Timing pass, in batches so the timer read does not dominate */
+    SensorFilter_Init(&xState, pConfig);
+    for (ulSample = 0; ulSample < BENCH_SAMPLES; ulSample += BENCH_BATCH)
+    {
+        ullStart = Bench_Now();
+        for (ulBatch = 0; ulBatch < BENCH_BATCH; ulBatch++)
+        {
+            usSink = SensorFilter_Process(&xState, Bench_Input[ulSample + ulBatch]);
+        }
+        ullCost = Bench_Now() - ullStart;
+        ullTotal += ullCost;
+        if (ullCost < ullBest)
+        {
+            ullBest = ullCost;
+        }
+    }
+    (void)usSink;
+
+    printf("%6u %5u %10.1f %10.1f %9d %8lu\n", (unsigned)pConfig->ucMedianSize, (unsigned)pConfig->ucIirShift,
+           (double)ullTotal / BENCH_SAMPLES, (double)ullBest / BENCH_BATCH, iMaxError, ulSpikesPassed);
+}
+
+int main(void)
+{
+    unsigned long ulSample;
+    unsigned uConfig;
+
+    srand(1);
+    for (ulSample = 0; ulSample < BENCH_SAMPLES; ulSample++)
+    {
+        Bench_Input[ulSample] = (uint16)(BENCH_SIGNAL - BENCH_NOISE + (rand() % (2 * BENCH_NOISE + 1)));
+        if ((ulSample % BENCH_SPIKE_EVERY) == 0UL)
+        {
+            Bench_Input[ulSample] += BENCH_SPIKE;
+        }
+    }
+
+    printf("state %u bytes per channel, noise +/-%u counts, %lu spikes, %s/sample\n", (unsigned)sizeof(SensorFilter_StateType),
+           (unsigned)BENCH_NOISE, (BENCH_SAMPLES - BENCH_SETTLE) / BENCH_SPIKE_EVERY, BENCH_UNIT);
+    printf("median shift    average best batch max error  spikes passed\n");
+    for (uConfig = 0; uConfig < (sizeof(Bench_Configs) / sizeof(Bench_Configs[0])); uConfig++)
+    {
+        Bench_Run(&Bench_Configs[uConfig]);
+    }
+    return 0;
+}
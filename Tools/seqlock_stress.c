@@ -0,0 +1,309 @@
+/******************************************************************************
+ *
+ * Tool: seqlock_stress
+ *
+ * File Name: seqlock_stress.c
+ *
+ * Description: Host stress test of the sequence lock (Services/SeqLock.c and
+ *              Services/Seat.c are compiled in unchanged) on real threads, so
+ *              readers and writers run truly in parallel on different cores,
+ *              a harsher case than the preemption on the target.
+ *
+ *              1. Raw payload: writers fill every word of a payload with the
+ *                 same stamp, readers check that all words of their copy match.
+ *                 Run once with the lock and once copying without it, the
+ *                 second run shows the check does catch torn copies.
+ *              2. Seat data: one thread per writer task of Seat.h (button,
+ *                 temperature, heater monitor, failure handler) against reader
+ *                 threads taking Seat_GetSnapshot, which must always find the
+ *                 heater level matching the heater duty and never the failure
+ *                 flag without its failure record. The retries Seat_GetSnapshot
+ *                 makes internally are counted through SeqLock_ReadRetry.
+ *
+ *              Exits with 1 if a torn read got through the lock, or if a run
+ *              with the lock never retried: then the readers never overlapped
+ *              a write and the run proved nothing.
+ *
+ *              Build: gcc -O2 -pthread -I../FreeRTOS_Project_SeatControllerSystem
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Common
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Services
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/PWM
+ *                         -o seqlock_stress seqlock_stress.c
+ *              Usage: seqlock_stress [seconds per run]
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+
+/* Writers on different cores are serialized with a mutex, the target uses a critical section */
+static pthread_mutex_t Stress_WriterMutex = PTHREAD_MUTEX_INITIALIZER;
+#define SEQLOCK_WRITER_ENTER()  pthread_mutex_lock(&Stress_WriterMutex)
+#define SEQLOCK_WRITER_EXIT()   pthread_mutex_unlock(&Stress_WriterMutex)
+
+#include "SeqLock.c"
+
+/* Seat_GetSnapshot retries inside Seat.c, every reader thread counts them here */
+static __thread unsigned long long Stress_SnapshotRetries;
+
+static boolean Stress_CountedReadRetry(const SeqLock_Type *pLock, uint32 ulSequence)
+{
+    boolean bRetry = SeqLock_ReadRetry(pLock, ulSequence);
+
+    if (TRUE == bRetry)
+    {
+        Stress_SnapshotRetries++;
+    }
+    return bRetry;
+}
+#define SeqLock_ReadRetry Stress_CountedReadRetry
+
+#include "PidController.c"
+#include "SensorFilter.c"
+#include "TempConversion.c"
+#include "Seat.c"
+#undef SeqLock_ReadRetry
+
+#define STRESS_WRITERS        3U
+#define STRESS_READERS        3U
+#define STRESS_PAYLOAD_WORDS  32U
+
+typedef struct
+{
+    unsigned long long ullReads;
+    unsigned long long ullRetries;
+    unsigned long long ullTorn;
+} Stress_ReaderStatsType;
+
+static volatile int Stress_Running;
+static volatile int Stress_UseLock;
+
+static SeqLock_Type Stress_Lock;
+static volatile uint32 Stress_Payload[STRESS_PAYLOAD_WORDS];
+
+static Seat_StateType Stress_Seat;
+static const Seat_ConfigType Stress_SeatConfig = { 0, 0, PWM_TIMER0A_PB6, 0, (const uint8 *)"Stress", "Invalid Temperature Sensor Range ", { 5U, 2U } };
+
+/*******************************************************************************
+ *                              Raw payload run                                *
+ *******************************************************************************/
+
+static void *Stress_PayloadWriter(void *pvArgument)
+{
+    uint32 ulStamp = (uint32)(uintptr_t)pvArgument << 24;
+    uint8 ucWord;
+
+    while (Stress_Running)
+    {
+        ulStamp = (ulStamp & 0xFF000000UL) | ((ulStamp + 1U) & 0x00FFFFFFUL);
+        if (Stress_UseLock)
+        {
+            SeqLock_WriteBegin(&Stress_Lock);
+        }
+        for (ucWord = 0; ucWord < STRESS_PAYLOAD_WORDS; ucWord++)
+        {
+            Stress_Payload[ucWord] = ulStamp;
+        }
+        if (Stress_UseLock)
+        {
+            SeqLock_WriteEnd(&Stress_Lock);
+        }
+    }
+    return NULL;
+}
+
+static void *Stress_PayloadReader(void *pvArgument)
+{
+    Stress_ReaderStatsType *pStats = (Stress_ReaderStatsType *)pvArgument;
+    uint32 aCopy[STRESS_PAYLOAD_WORDS];
+    uint32 ulSequence = 0;
+    uint8 ucWord;
+
+    while (Stress_Running)
+    {
+        do
+        {
+            if (Stress_UseLock)
+            {
+                ulSequence = SeqLock_ReadBegin(&Stress_Lock);
+            }
+            for (ucWord = 0; ucWord < STRESS_PAYLOAD_WORDS; ucWord++)
+            {
+                aCopy[ucWord] = Stress_Payload[ucWord];
+            }
+        }
+        while (Stress_UseLock && SeqLock_ReadRetry(&Stress_Lock, ulSequence) && ++pStats->ullRetries);
+
+        for (ucWord = 1; ucWord < STRESS_PAYLOAD_WORDS; ucWord++)
+        {
+            if (aCopy[ucWord] != aCopy[0])
+            {
+                pStats->ullTorn++;
+                break;
+            }
+        }
+        pStats->ullReads++;
+    }
+    return NULL;
+}
+
+/*******************************************************************************
+ *                               Seat data run                                 *
+ *******************************************************************************/
+
+static void *Stress_ButtonWriter(void *pvArgument)
+{
+    uint32 ulCount = 0;
+
+    (void)pvArgument;
+    while (Stress_Running)
+    {
+        /* Mostly presses through every setpoint, now and then a long press back to off */
+        if ((++ulCount & 7U) == 0U)
+        {
+            (void)Seat_HandleLongPress(&Stress_Seat);
+        }
+        else
+        {
+            (void)Seat_HandlePress(&Stress_Seat);
+        }
+    }
+    return NULL;
+}
+
+static void *Stress_TemperatureWriter(void *pvArgument)
+{
+    uint32 ulCount = 0;
+
+    (void)pvArgument;
+    while (Stress_Running)
+    {
+        /* Sweeps through and beyond the valid range so the failure path runs too */
+        Seat_SetTemperature(&Stress_SeatConfig, &Stress_Seat, (uint16)((ulCount++ * 37U) % 4096U));
+    }
+    return NULL;
+}
+
+static void *Stress_MonitorWriter(void *pvArgument)
+{
+    (void)pvArgument;
+    while (Stress_Running)
+    {
+        Seat_UpdateHeater(&Stress_Seat);
+    }
+    return NULL;
+}
+
+static void *Stress_FailureWriter(void *pvArgument)
+{
+    uint32 ulTimestamp = 0;
+
+    (void)pvArgument;
+    while (Stress_Running)
+    {
+        (void)Seat_CheckSensor(&Stress_SeatConfig, &Stress_Seat, ulTimestamp++);
+    }
+    return NULL;
+}
+
+static void *Stress_SeatReader(void *pvArgument)
+{
+    Stress_ReaderStatsType *pStats = (Stress_ReaderStatsType *)pvArgument;
+    Seat_SnapshotType xSnapshot;
+
+    while (Stress_Running)
+    {
+        Seat_GetSnapshot(&Stress_Seat, &xSnapshot);
+        if ((xSnapshot.HeaterLevel != Seat_LevelFromDuty(xSnapshot.ucHeaterDuty)) ||
+            ((TRUE == xSnapshot.bSensorFailure) && (NULL_PTR == xSnapshot.xLatestFailure.failureMessage)))
+        {
+            pStats->ullTorn++;
+        }
+        pStats->ullReads++;
+    }
+    pStats->ullRetries = Stress_SnapshotRetries;
+    return NULL;
+}
+
+/*******************************************************************************
+ *                                   Runs                                      *
+ *******************************************************************************/
+
+/* Returns the total of the reader statistics in pTotal */
+static void Stress_Run(const char *pName, void *(*apWriters[])(void *), unsigned uWriters,
+                       void *(*pReader)(void *), unsigned uSeconds, Stress_ReaderStatsType *pTotal)
+{
+    pthread_t axThreads[STRESS_WRITERS + 1U + STRESS_READERS];
+    Stress_ReaderStatsType axStats[STRESS_READERS] = {{0}};
+    Stress_ReaderStatsType xTotal = {0};
+    unsigned uIndex;
+
+    Stress_Running = 1;
+    for (uIndex = 0; uIndex < uWriters; uIndex++)
+    {
+        pthread_create(&axThreads[uIndex], NULL, apWriters[uIndex], (void *)(uintptr_t)(uIndex + 1U));
+    }
+    for (uIndex = 0; uIndex < STRESS_READERS; uIndex++)
+    {
+        pthread_create(&axThreads[uWriters + uIndex], NULL, pReader, &axStats[uIndex]);
+    }
+    sleep(uSeconds);
+    Stress_Running = 0;
+    for (uIndex = 0; uIndex < uWriters + STRESS_READERS; uIndex++)
+    {
+        pthread_join(axThreads[uIndex], NULL);
+    }
+
+    for (uIndex = 0; uIndex < STRESS_READERS; uIndex++)
+    {
+        xTotal.ullReads += axStats[uIndex].ullReads;
+        xTotal.ullRetries += axStats[uIndex].ullRetries;
+        xTotal.ullTorn += axStats[uIndex].ullTorn;
+    }
+    printf("%-24s %12llu reads %12llu retries %10llu torn\n", pName, xTotal.ullReads, xTotal.ullRetries, xTotal.ullTorn);
+    *pTotal = xTotal;
+}
+
+int main(int argc, char **argv)
+{
+    void *(*apPayloadWriters[STRESS_WRITERS])(void *) = {Stress_PayloadWriter, Stress_PayloadWriter, Stress_PayloadWriter};
+    void *(*apSeatWriters[])(void *) = {Stress_ButtonWriter, Stress_TemperatureWriter, Stress_MonitorWriter, Stress_FailureWriter};
+    const PidController_ConfigType xPidConfig = HEATER_PID_CONFIG;
+    unsigned uSeconds = (argc > 1) ? (unsigned)atoi(argv[1]) : 2U;
+    Stress_ReaderStatsType xLocked;
+    Stress_ReaderStatsType xSeat;
+    Stress_ReaderStatsType xUnlocked;
+    boolean bPass;
+
+    printf("%u writers, %u readers, %ld cores, %u s per run\n", STRESS_WRITERS, STRESS_READERS,
+           sysconf(_SC_NPROCESSORS_ONLN), uSeconds);
+
+    SeqLock_Init(&Stress_Lock);
+    Stress_UseLock = 0;
+    Stress_Run("payload, no lock", apPayloadWriters, STRESS_WRITERS, Stress_PayloadReader, uSeconds, &xUnlocked);
+    Stress_UseLock = 1;
+    Stress_Run("payload, seqlock", apPayloadWriters, STRESS_WRITERS, Stress_PayloadReader, uSeconds, &xLocked);
+
+    TempConv_Init();
+    Seat_Init(&Stress_SeatConfig, &Stress_Seat, &xPidConfig);
+    Stress_Run("seat snapshot", apSeatWriters, 4U, Stress_SeatReader, uSeconds, &xSeat);
+
+    bPass = TRUE;
+    if ((xLocked.ullTorn + xSeat.ullTorn) != 0U)
+    {
+        printf("FAIL: torn read through the lock\n");
+        bPass = FALSE;
+    }
+    if ((0U == xLocked.ullRetries) || (0U == xSeat.ullRetries))
+    {
+        printf("FAIL: a locked run never retried, the readers never overlapped a write\n");
+        bPass = FALSE;
+    }
+    if (TRUE == bPass)
+    {
+        printf("PASS: no torn read through the lock, %llu unlocked torn reads for comparison\n", xUnlocked.ullTorn);
+    }
+    return (TRUE == bPass) ? 0 : 1;
+}
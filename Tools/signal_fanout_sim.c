@@ -0,0 +1,517 @@
+/******************************************************************************
+ *
+ * Tool: signal_fanout_sim
+ *
+ * File Name: signal_fanout_sim.c
+ *
+ * Description: Host simulation of the signalling between the seat controller
+ *              tasks, 1 ms steps, with the previous shared event group and with
+ *              the per-subscriber signals of Services/Signal.c. The kernel port
+ *              only builds for the target, so the scheduler is modelled: the
+ *              ready task of highest priority runs until it blocks, and a
+ *              task's own run time (a few us) is left out.
+ *
+ *              1. Event group: one group of clear-on-exit bits. A set bit wakes
+ *                 every task blocked on it, a bit set while its consumer is not
+ *                 waiting is taken by whichever task waits for it first, and
+ *                 vHeaterMonitorTask sets the temperature bit again itself.
+ *              2. Signals: every subscriber keeps its own pending bit, the
+ *                 heater monitor runs each HEATER_CONTROL_PERIOD_MS and at once
+ *                 on a new setpoint, the dashboard draws each heater update
+ *                 unless its previous frame is less than a refresh period old.
+ *
+ *              Button presses come at random. For each scheme it reports the
+ *              wakeups, the spurious ones (nothing new for the task), the
+ *              context switches, the latency from a temperature sample to its
+ *              sensor check and from a press to the new heater duty reaching
+ *              the PWM and the dashboard, and the updates a consumer never saw.
+ *
+ *              Build: gcc -O2 -I../FreeRTOS_Project_SeatControllerSystem
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Common
+ *                         -o signal_fanout_sim signal_fanout_sim.c
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "std_types.h"
+#include "FreeRTOS_Project.h"
+
+#define SIM_DURATION_MS      3600000UL  /* One hour */
+#define SIM_MIN_PRESS_GAP_MS 300U
+#define SIM_MAX_PRESS_GAP_MS 10000U
+#define SIM_MAX_PRESSES      (SIM_DURATION_MS / SIM_MIN_PRESS_GAP_MS + 1U)
+#define SIM_FOREVER          0xFFFFFFFFUL
+
+/* Event group bits, and the signal bits in the same positions */
+#define SIM_SETPOINT_BIT     (1UL << 0)
+#define SIM_TEMPERATURE_BIT  (1UL << 1)
+#define SIM_HEATER_BIT       (1UL << 2)
+#define SIM_PRESS_BIT        (1UL << 3)  /* Button events, task notification of vSeatButtonTask */
+
+typedef enum { SIM_EVENT_GROUP, SIM_SIGNALS } Sim_SchemeType;
+
+/* Highest priority first, same priorities as main.c */
+typedef enum
+{
+    SIM_BUTTON, SIM_TEMP, SIM_MONITOR, SIM_FAILURE, SIM_CONTROL, SIM_DASHBOARD,
+    SIM_NUMBER_OF_TASKS, SIM_IDLE = SIM_NUMBER_OF_TASKS
+} Sim_TaskIdType;
+
+static const uint8 Sim_Priority[SIM_NUMBER_OF_TASKS] = {4, 3, 2, 1, 1, 1};
+static const char *Sim_TaskName[SIM_NUMBER_OF_TASKS] = {"button", "temp", "monitor", "failure", "control", "dashboard"};
+
+/* Subscribers of each signal bit in the signal scheme, see main.c */
+static const uint32 Sim_Subscriptions[SIM_NUMBER_OF_TASKS] =
+{
+    SIM_PRESS_BIT, 0U, SIM_SETPOINT_BIT, SIM_TEMPERATURE_BIT, SIM_HEATER_BIT, SIM_HEATER_BIT
+};
+
+typedef struct
+{
+    boolean bReady;
+    uint32 ulWaitMask;      /* Blocked until one of these bits is set, 0 when not waiting */
+    uint32 ulWakeTime;      /* Delay end or wait timeout, SIM_FOREVER when none */
+    uint32 ulResult;        /* Bits taken by the last wait, 0 on timeout */
+    uint32 ulPending;       /* Own notification bits, signal scheme and button events */
+    uint8 ucResume;         /* Point of the task body to resume at */
+    uint32 ulWakeups;
+    uint32 ulSpurious;
+} Sim_TaskType;
+
+typedef struct
+{
+    uint32 ulSeen;          /* Last sequence number handled */
+    uint32 ulLost;          /* Sequence numbers skipped */
+    uint32 ulServedPresses; /* Presses whose setpoint reached this consumer */
+    uint64 ullLatencySum;
+    uint32 ulLatencyMax;
+    uint32 ulLatencyCount;
+} Sim_ConsumerType;
+
+static Sim_SchemeType Sim_Scheme;
+static Sim_TaskType Sim_Tasks[SIM_NUMBER_OF_TASKS];
+static uint32 Sim_Now;
+static uint32 Sim_Group;            /* Event group bits */
+static uint32 Sim_Switches;
+static Sim_TaskIdType Sim_Running;
+
+/* Temperature samples, presses and heater steps */
+static uint32 Sim_TempSeq;
+static uint32 Sim_TempTime[SIM_DURATION_MS / TEMP_SCAN_PERIOD_MS + 2U];
+static uint32 Sim_PressSeq;
+static uint32 *Sim_PressTime;
+static uint32 Sim_HeaterSeq;
+static uint32 Sim_HeaterPressSeq;   /* Presses included in the latest heater step */
+static uint32 Sim_MonitorLastRun;
+static uint32 Sim_DashboardLastFrame;
+
+static Sim_ConsumerType Sim_Failure;
+static Sim_ConsumerType Sim_Control;
+static Sim_ConsumerType Sim_Dashboard;
+
+static uint32 Sim_Random(uint32 ulMin, uint32 ulMax)
+{
+    return ulMin + (uint32)(rand() % (int)(ulMax - ulMin + 1U));
+}
+
+static void Sim_Unblock(Sim_TaskIdType Task, uint32 ulResult)
+{
+    Sim_Tasks[Task].bReady = TRUE;
+    Sim_Tasks[Task].ulWaitMask = 0U;
+    Sim_Tasks[Task].ulWakeTime = SIM_FOREVER;
+    Sim_Tasks[Task].ulResult = ulResult;
+}
+
+/* xEventGroupWaitBits(clear on exit, any bit) / Signal_Wait. TRUE when it did not block */
+static boolean Sim_Wait(Sim_TaskIdType Task, uint32 ulMask, uint32 ulTimeout)
+{
+    uint32 *pulBits = ((SIM_EVENT_GROUP == Sim_Scheme) && (SIM_BUTTON != Task)) ? &Sim_Group : &Sim_Tasks[Task].ulPending;
+
+    if (0U != (*pulBits & ulMask))
+    {
+        Sim_Tasks[Task].ulResult = *pulBits & ulMask;
+        *pulBits &= ~ulMask;
+        return TRUE;
+    }
+    if (0U == ulTimeout)
+    {
+        Sim_Tasks[Task].ulResult = 0U;
+        return TRUE;
+    }
+    Sim_Tasks[Task].bReady = FALSE;
+    Sim_Tasks[Task].ulWaitMask = ulMask;
+    Sim_Tasks[Task].ulWakeTime = (SIM_FOREVER == ulTimeout) ? SIM_FOREVER : Sim_Now + ulTimeout;
+    return FALSE;
+}
+
+/* vTaskDelay / vTaskDelayUntil. TRUE when the wake time has already passed */
+static boolean Sim_DelayUntil(Sim_TaskIdType Task, uint32 ulWakeTime)
+{
+    if (ulWakeTime <= Sim_Now)
+    {
+        return TRUE;
+    }
+    Sim_Tasks[Task].bReady = FALSE;
+    Sim_Tasks[Task].ulWakeTime = ulWakeTime;
+    return FALSE;
+}
+
+/* xEventGroupSetBits: every waiter whose bits are set unblocks, the bits are cleared after all of them */
+static void Sim_SetBits(uint32 ulBits)
+{
+    uint32 ulClear = 0U;
+    uint8 ucTask;
+
+    Sim_Group |= ulBits;
+    for (ucTask = SIM_TEMP; ucTask < SIM_NUMBER_OF_TASKS; ucTask++)
+    {
+        if (0U != (Sim_Tasks[ucTask].ulWaitMask & Sim_Group))
+        {
+            ulClear |= Sim_Tasks[ucTask].ulWaitMask;
+            Sim_Unblock((Sim_TaskIdType)ucTask, Sim_Tasks[ucTask].ulWaitMask & Sim_Group);
+        }
+    }
+    Sim_Group &= ~ulClear;
+}
+
+/* Signal_Publish, or the task notification of one task */
+static void Sim_Notify(Sim_TaskIdType Task, uint32 ulBit)
+{
+    Sim_Tasks[Task].ulPending |= ulBit;
+    if (0U != (Sim_Tasks[Task].ulWaitMask & Sim_Tasks[Task].ulPending))
+    {
+        Sim_Unblock(Task, Sim_Tasks[Task].ulWaitMask & Sim_Tasks[Task].ulPending);
+        Sim_Tasks[Task].ulPending &= ~Sim_Tasks[Task].ulResult;
+    }
+}
+
+static void Sim_Signal(uint32 ulBit)
+{
+    uint8 ucTask;
+
+    if (SIM_EVENT_GROUP == Sim_Scheme)
+    {
+        Sim_SetBits(ulBit);
+        return;
+    }
+    for (ucTask = 0; ucTask < SIM_NUMBER_OF_TASKS; ucTask++)
+    {
+        if (0U != (Sim_Subscriptions[ucTask] & ulBit))
+        {
+            Sim_Notify((Sim_TaskIdType)ucTask, ulBit);
+        }
+    }
+}
+
+static void Sim_Latency(Sim_ConsumerType *pConsumer, uint32 ulLatency)
+{
+    pConsumer->ullLatencySum += ulLatency;
+    pConsumer->ulLatencyCount++;
+    if (ulLatency > pConsumer->ulLatencyMax)
+    {
+        pConsumer->ulLatencyMax = ulLatency;
+    }
+}
+
+/* A consumer woke: new data, skipped data or nothing new */
+static void Sim_Consume(Sim_TaskIdType Task, Sim_ConsumerType *pConsumer, uint32 ulSeq)
+{
+    if (ulSeq == pConsumer->ulSeen)
+    {
+        Sim_Tasks[Task].ulSpurious++;
+        return;
+    }
+    pConsumer->ulLost += ulSeq - pConsumer->ulSeen - 1U;
+    pConsumer->ulSeen = ulSeq;
+}
+
+/* The heater step reached a consumer, every press it includes is served */
+static void Sim_ServePresses(Sim_ConsumerType *pConsumer)
+{
+    for (; pConsumer->ulServedPresses < Sim_HeaterPressSeq; pConsumer->ulServedPresses++)
+    {
+        Sim_Latency(pConsumer, Sim_Now - Sim_PressTime[pConsumer->ulServedPresses]);
+    }
+}
+
+static void Sim_HeaterStep(void)
+{
+    Sim_HeaterSeq++;
+    Sim_HeaterPressSeq = Sim_PressSeq;
+    Sim_Signal(SIM_HEATER_BIT);
+}
+
+/* Task bodies, each runs from its resume point until it blocks */
+static void Sim_RunTask(Sim_TaskIdType Task)
+{
+    Sim_TaskType *pTask = &Sim_Tasks[Task];
+    uint32 ulElapsed;
+
+    for (;;)
+    {
+        switch (Task)
+        {
+        case SIM_BUTTON:
+            if (1U == pTask->ucResume)
+            {
+                Sim_Signal(SIM_SETPOINT_BIT);
+            }
+            pTask->ucResume = 1U;
+            if (FALSE == Sim_Wait(Task, SIM_PRESS_BIT, SIM_FOREVER))
+            {
+                return;
+            }
+            break;
+
+        case SIM_TEMP:
+            Sim_TempSeq++;
+            Sim_TempTime[Sim_TempSeq] = Sim_Now;
+            Sim_Signal(SIM_TEMPERATURE_BIT);
+            pTask->ucResume = 1U;
+            if (FALSE == Sim_DelayUntil(Task, Sim_Now + TEMP_SCAN_PERIOD_MS))
+            {
+                return;
+            }
+            break;
+
+        case SIM_MONITOR:
+            if (SIM_EVENT_GROUP == Sim_Scheme)
+            {
+                /* Wait(temperature | setpoint), step, set heater and temperature, vTaskDelayUntil */
+                if (1U == pTask->ucResume)
+                {
+                    Sim_HeaterStep();
+                    Sim_SetBits(SIM_TEMPERATURE_BIT);
+                    pTask->ucResume = 2U;
+                    Sim_MonitorLastRun += HEATER_CONTROL_PERIOD_MS;
+                    if (FALSE == Sim_DelayUntil(Task, Sim_MonitorLastRun))
+                    {
+                        return;
+                    }
+                }
+                pTask->ucResume = 1U;
+                if (FALSE == Sim_Wait(Task, SIM_TEMPERATURE_BIT | SIM_SETPOINT_BIT, SIM_FOREVER))
+                {
+                    return;
+                }
+            }
+            else
+            {
+                /* Signal_Wait(setpoint, rest of the period), step, publish heater */
+                if (1U == pTask->ucResume)
+                {
+                    Sim_MonitorLastRun = (0U != pTask->ulResult) ? Sim_Now : Sim_MonitorLastRun + HEATER_CONTROL_PERIOD_MS;
+                    Sim_HeaterStep();
+                }
+                pTask->ucResume = 1U;
+                ulElapsed = Sim_Now - Sim_MonitorLastRun;
+                if (FALSE == Sim_Wait(Task, SIM_SETPOINT_BIT, (ulElapsed < HEATER_CONTROL_PERIOD_MS) ? (HEATER_CONTROL_PERIOD_MS - ulElapsed) : 0U))
+                {
+                    return;
+                }
+            }
+            break;
+
+        case SIM_FAILURE:
+            if (1U == pTask->ucResume)
+            {
+                Sim_Consume(Task, &Sim_Failure, Sim_TempSeq);
+                if (Sim_TempSeq != 0U)
+                {
+                    Sim_Latency(&Sim_Failure, Sim_Now - Sim_TempTime[Sim_TempSeq]);
+                }
+            }
+            pTask->ucResume = 1U;
+            if (FALSE == Sim_Wait(Task, SIM_TEMPERATURE_BIT, SIM_FOREVER))
+            {
+                return;
+            }
+            break;
+
+        case SIM_CONTROL:
+            if (1U == pTask->ucResume)
+            {
+                Sim_Consume(Task, &Sim_Control, Sim_HeaterSeq);
+                Sim_ServePresses(&Sim_Control);
+            }
+            pTask->ucResume = 1U;
+            if (FALSE == Sim_Wait(Task, SIM_HEATER_BIT, SIM_FOREVER))
+            {
+                return;
+            }
+            break;
+
+        case SIM_DASHBOARD:
+            if (SIM_EVENT_GROUP == Sim_Scheme)
+            {
+                /* Wait(heater), frame, vTaskDelay(refresh period) */
+                if (1U == pTask->ucResume)
+                {
+                    Sim_Consume(Task, &Sim_Dashboard, Sim_HeaterSeq);
+                    Sim_ServePresses(&Sim_Dashboard);
+                    pTask->ucResume = 2U;
+                    if (FALSE == Sim_DelayUntil(Task, Sim_Now + DASHBOARD_REFRESH_PERIOD_MS))
+                    {
+                        return;
+                    }
+                }
+                pTask->ucResume = 1U;
+                if (FALSE == Sim_Wait(Task, SIM_HEATER_BIT, SIM_FOREVER))
+                {
+                    return;
+                }
+            }
+            else
+            {
+                /* Signal_Wait(heater), only delayed when the previous frame is too recent, frame */
+                if (1U == pTask->ucResume)
+                {
+                    pTask->ucResume = 2U;
+                    if ((Sim_Now - Sim_DashboardLastFrame) < DASHBOARD_REFRESH_PERIOD_MS)
+                    {
+                        Sim_DashboardLastFrame += DASHBOARD_REFRESH_PERIOD_MS;
+                        if (FALSE == Sim_DelayUntil(Task, Sim_DashboardLastFrame))
+                        {
+                            return;
+                        }
+                    }
+                }
+                if (2U == pTask->ucResume)
+                {
+                    Sim_DashboardLastFrame = Sim_Now;
+                    Sim_Consume(Task, &Sim_Dashboard, Sim_HeaterSeq);
+                    Sim_ServePresses(&Sim_Dashboard);
+                }
+                pTask->ucResume = 1U;
+                if (FALSE == Sim_Wait(Task, SIM_HEATER_BIT, SIM_FOREVER))
+                {
+                    return;
+                }
+            }
+            break;
+
+        default:
+            return;
+        }
+    }
+}
+
+static Sim_TaskIdType Sim_HighestReady(void)
+{
+    Sim_TaskIdType Best = SIM_IDLE;
+    uint8 ucTask;
+
+    for (ucTask = 0; ucTask < SIM_NUMBER_OF_TASKS; ucTask++)
+    {
+        if ((TRUE == Sim_Tasks[ucTask].bReady) && ((SIM_IDLE == Best) || (Sim_Priority[ucTask] > Sim_Priority[Best])))
+        {
+            Best = (Sim_TaskIdType)ucTask;
+        }
+    }
+    return Best;
+}
+
+static void Sim_Run(Sim_SchemeType Scheme, const char *pName)
+{
+    uint32 ulNextPress = Sim_Random(SIM_MIN_PRESS_GAP_MS, SIM_MAX_PRESS_GAP_MS);
+    uint32 ulWakeups = 0U;
+    uint32 ulSpurious = 0U;
+    Sim_TaskIdType Task;
+    uint8 ucTask;
+    const double dSeconds = (double)SIM_DURATION_MS / 1000.0;
+
+    Sim_Scheme = Scheme;
+    Sim_Now = 0U;
+    Sim_Group = 0U;
+    Sim_Switches = 0U;
+    Sim_Running = SIM_IDLE;
+    Sim_TempSeq = 0U;
+    Sim_PressSeq = 0U;
+    Sim_HeaterSeq = 0U;
+    Sim_HeaterPressSeq = 0U;
+    Sim_MonitorLastRun = 0U;
+    Sim_DashboardLastFrame = 0U;
+    Sim_Failure = (Sim_ConsumerType){0};
+    Sim_Control = (Sim_ConsumerType){0};
+    Sim_Dashboard = (Sim_ConsumerType){0};
+    for (ucTask = 0; ucTask < SIM_NUMBER_OF_TASKS; ucTask++)
+    {
+        Sim_Tasks[ucTask] = (Sim_TaskType){TRUE, 0U, SIM_FOREVER, 0U, 0U, 0U, 0U, 0U};
+    }
+
+    for (Sim_Now = 0U; Sim_Now < SIM_DURATION_MS; Sim_Now++)
+    {
+        /* The button scans (timer service task) report a debounced press */
+        if (Sim_Now == ulNextPress)
+        {
+            Sim_PressTime[Sim_PressSeq++] = Sim_Now;
+            Sim_Notify(SIM_BUTTON, SIM_PRESS_BIT);
+            ulNextPress = Sim_Now + Sim_Random(SIM_MIN_PRESS_GAP_MS, SIM_MAX_PRESS_GAP_MS);
+        }
+        /* Tick: delays end and waits time out */
+        for (ucTask = 0; ucTask < SIM_NUMBER_OF_TASKS; ucTask++)
+        {
+            if ((FALSE == Sim_Tasks[ucTask].bReady) && (Sim_Tasks[ucTask].ulWakeTime == Sim_Now))
+            {
+                Sim_Unblock((Sim_TaskIdType)ucTask, 0U);
+            }
+        }
+        for (Task = Sim_HighestReady(); SIM_IDLE != Task; Task = Sim_HighestReady())
+        {
+            if (0U != Sim_Tasks[Task].ucResume)
+            {
+                Sim_Tasks[Task].ulWakeups++; /* Not the first run */
+            }
+            if (Task != Sim_Running)
+            {
+                Sim_Switches++;
+                Sim_Running = Task;
+            }
+            Sim_RunTask(Task);
+        }
+        if (SIM_IDLE != Sim_Running)
+        {
+            Sim_Switches++;
+            Sim_Running = SIM_IDLE;
+        }
+    }
+
+    printf("\n%s\n  wakeups/s:", pName);
+    for (ucTask = 0; ucTask < SIM_NUMBER_OF_TASKS; ucTask++)
+    {
+        printf(" %s %.2f", Sim_TaskName[ucTask], Sim_Tasks[ucTask].ulWakeups / dSeconds);
+        ulWakeups += Sim_Tasks[ucTask].ulWakeups;
+        ulSpurious += Sim_Tasks[ucTask].ulSpurious;
+    }
+    printf("\n  total %.2f wakeups/s, %.2f spurious/s (failure %lu, control %lu, dashboard %lu), %.2f context switches/s\n",
+           ulWakeups / dSeconds, ulSpurious / dSeconds, (unsigned long)Sim_Tasks[SIM_FAILURE].ulSpurious,
+           (unsigned long)Sim_Tasks[SIM_CONTROL].ulSpurious, (unsigned long)Sim_Tasks[SIM_DASHBOARD].ulSpurious,
+           Sim_Switches / dSeconds);
+    printf("  temperature sample -> sensor check   mean %6.1f ms  worst %4lu ms  samples never checked %lu of %lu\n",
+           (double)Sim_Failure.ullLatencySum / Sim_Failure.ulLatencyCount, (unsigned long)Sim_Failure.ulLatencyMax,
+           (unsigned long)Sim_Failure.ulLost, (unsigned long)Sim_TempSeq);
+    printf("  press -> heater PWM                  mean %6.1f ms  worst %4lu ms  heater steps never applied %lu of %lu\n",
+           (double)Sim_Control.ullLatencySum / Sim_Control.ulLatencyCount, (unsigned long)Sim_Control.ulLatencyMax,
+           (unsigned long)Sim_Control.ulLost, (unsigned long)Sim_HeaterSeq);
+    printf("  press -> dashboard                   mean %6.1f ms  worst %4lu ms  heater steps never shown  %lu of %lu\n",
+           (double)Sim_Dashboard.ullLatencySum / Sim_Dashboard.ulLatencyCount, (unsigned long)Sim_Dashboard.ulLatencyMax,
+           (unsigned long)Sim_Dashboard.ulLost, (unsigned long)Sim_HeaterSeq);
+}
+
+int main(void)
+{
+    Sim_PressTime = malloc(SIM_MAX_PRESSES * sizeof(uint32));
+
+    printf("%lu s, temperature scan every %u ms, heater period %u ms, dashboard refresh %u ms, presses every %u..%u ms\n",
+           SIM_DURATION_MS / 1000UL, (unsigned)TEMP_SCAN_PERIOD_MS, (unsigned)HEATER_CONTROL_PERIOD_MS,
+           (unsigned)DASHBOARD_REFRESH_PERIOD_MS, SIM_MIN_PRESS_GAP_MS, SIM_MAX_PRESS_GAP_MS);
+    srand(1);
+    Sim_Run(SIM_EVENT_GROUP, "event group (previous)");
+    srand(1);
+    Sim_Run(SIM_SIGNALS, "signals");
+
+    free(Sim_PressTime);
+    return 0;
+}
@@ -0,0 +1,214 @@
+/******************************************************************************
+ *
+ * Tool: telemetry_decode
+ *
+ * File Name: telemetry_decode.c
+ *
+ * Description: Host-side decoder for the binary telemetry stream sent on UART0
+ *              when TELEMETRY_OUTPUT is STD_ON. Reads a raw capture (file or
+ *              stdin), splits it on 0x00 delimiters, COBS-decodes each frame,
+ *              checks the CRC-16/CCITT-FALSE and prints one CSV row per record.
+ *              Frames with a bad length, version or CRC are counted and skipped.
+ *              The number of seats is taken from the first good record, the
+ *              CSV columns follow it.
+ *
+ *              Build: gcc -O2 -o telemetry_decode telemetry_decode.c
+ *              Usage: telemetry_decode [capture.bin] > telemetry.csv
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/* Must match Services/Telemetry.h */
+#define RECORD_VERSION   5U
+#define NUMBER_OF_TASKS  8U
+#define HEADER_SIZE      12U
+#define PAYLOAD_SIZE(seats) (HEADER_SIZE + ((seats) * 4U) + 1U + (NUMBER_OF_TASKS * 8U) + ((seats) * 10U) + 4U)
+#define CRC_SIZE         2U
+#define MAX_FRAME_SIZE   512U
+
+/* Indexed by the task tags of FreeRTOS_Project.h */
+static const char *TaskNames[NUMBER_OF_TASKS] = {
+    "idle", "seat_buttons", "current_temp", "failure",
+    "heater_monitor", "heater_control", "display", "runtime"
+};
+
+/* Seat count of the capture, 0 until the first good record */
+static uint8_t Seats = 0;
+
+static uint16_t Crc16(const uint8_t *pData, uint32_t length)
+{
+    uint16_t crc = 0xFFFF;
+    uint8_t bit;
+
+    while (length-- > 0U)
+    {
+        crc ^= (uint16_t)(*pData++) << 8;
+        for (bit = 0; bit < 8U; bit++)
+        {
+            crc = (crc & 0x8000U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+/* Returns the decoded length, or 0 if the frame is malformed */
+static uint32_t CobsDecode(const uint8_t *pIn, uint32_t length, uint8_t *pOut)
+{
+    uint32_t read = 0;
+    uint32_t write = 0;
+    uint8_t code;
+    uint8_t i;
+
+    while (read < length)
+    {
+        code = pIn[read++];
+        if (code == 0U || (read + code - 1U) > length)
+        {
+            return 0;
+        }
+        for (i = 1; i < code; i++)
+        {
+            pOut[write++] = pIn[read++];
+        }
+        if (code != 0xFFU && read < length)
+        {
+            pOut[write++] = 0x00;
+        }
+    }
+    return write;
+}
+
+static uint16_t GetU16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t GetU32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t GetU64(const uint8_t *p)
+{
+    return (uint64_t)GetU32(p) | ((uint64_t)GetU32(p + 4) << 32);
+}
+
+static void PrintHeader(void)
+{
+    uint8_t i;
+
+    printf("seq,timestamp_us");
+    for (i = 0; i < Seats; i++)
+    {
+        printf(",seat%u_level,seat%u_desired,seat%u_current", i, i, i);
+    }
+    printf(",cpu_load");
+    for (i = 0; i < NUMBER_OF_TASKS; i++)
+    {
+        printf(",%s_time_us", TaskNames[i]);
+    }
+    for (i = 0; i < Seats; i++)
+    {
+        printf(",seat%u_failure,seat%u_failure_level,seat%u_failure_time_us", i, i, i);
+    }
+    printf(",adc_overruns\n");
+}
+
+static int PrintRecord(const uint8_t *p, uint32_t length)
+{
+    uint8_t i;
+    uint8_t seats;
+    int16_t temp;
+
+    if (length < HEADER_SIZE || p[0] != RECORD_VERSION)
+    {
+        return 0;
+    }
+    seats = p[HEADER_SIZE - 1U];
+    if (length != PAYLOAD_SIZE(seats) + CRC_SIZE ||
+        Crc16(p, PAYLOAD_SIZE(seats)) != GetU16(p + PAYLOAD_SIZE(seats)) ||
+        (Seats != 0U && seats != Seats))
+    {
+        return 0;
+    }
+    if (Seats == 0U)
+    {
+        Seats = seats;
+        PrintHeader();
+    }
+
+    printf("%u,%llu", GetU16(p + 1), (unsigned long long)GetU64(p + 3));
+    p += HEADER_SIZE;
+    for (i = 0; i < seats; i++, p += 4)
+    {
+        temp = (int16_t)GetU16(p + 2);
+        printf(",%u,%u,%s%d.%d", p[0], p[1], (temp < 0) ? "-" : "", abs(temp) / 10, abs(temp) % 10);
+    }
+    printf(",%u", *p++);
+    for (i = 0; i < NUMBER_OF_TASKS; i++, p += 8)
+    {
+        printf(",%llu", (unsigned long long)GetU64(p));
+    }
+    for (i = 0; i < seats; i++, p += 10)
+    {
+        printf(",%u,%u,%llu", p[0], p[1], (unsigned long long)GetU64(p + 2));
+    }
+    printf(",%lu\n", (unsigned long)GetU32(p));
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    FILE *pFile = stdin;
+    uint8_t frame[MAX_FRAME_SIZE];
+    uint8_t payload[MAX_FRAME_SIZE];
+    uint32_t frameLength = 0;
+    uint32_t payloadLength;
+    unsigned long good = 0;
+    unsigned long bad = 0;
+    int c;
+
+    if (argc > 1 && (pFile = fopen(argv[1], "rb")) == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    while ((c = fgetc(pFile)) != EOF)
+    {
+        if (c != 0)
+        {
+            if (frameLength < MAX_FRAME_SIZE)
+            {
+                frame[frameLength] = (uint8_t)c;
+            }
+            frameLength++;
+            continue;
+        }
+
+        /* The first frame of a capture is usually cut, it fails the checks like any corrupted one */
+        if (frameLength > 0U)
+        {
+            payloadLength = (frameLength <= MAX_FRAME_SIZE) ? CobsDecode(frame, frameLength, payload) : 0U;
+            if (PrintRecord(payload, payloadLength))
+            {
+                good++;
+            }
+            else
+            {
+                bad++;
+            }
+        }
+        frameLength = 0;
+    }
+
+    fprintf(stderr, "%lu records decoded, %lu frames dropped\n", good, bad);
+    if (pFile != stdin)
+    {
+        fclose(pFile);
+    }
+    return 0;
+}
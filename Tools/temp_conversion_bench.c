@@ -0,0 +1,107 @@
+/******************************************************************************
+ *
+ * Tool: temp_conversion_bench
+ *
+ * File Name: temp_conversion_bench.c
+ *
+ * Description: Host benchmark of the firmware ADC to temperature conversion
+ *              (Services/TempConversion.c is compiled in unchanged) against
+ *              the previous (raw * 45) / 4095 integer path. Reports the cost
+ *              per conversion (TSC on x86, nanoseconds elsewhere) and the
+ *              worst error against the exact value over all 4096 codes.
+ *
+ *              The old path is timed twice: as written, where the compiler
+ *              may turn the constant divide into a multiply, and with the
+ *              divisor hidden behind a volatile so a real divide is issued.
+ *
+ *              Build: gcc -O2 -I../FreeRTOS_Project_SeatControllerSystem
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Common
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Services
+ *                         -o temp_conversion_bench temp_conversion_bench.c -lm
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+
+#include "TempConversion.c"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_UNIT "cycles"
+static unsigned long long Bench_Now(void)
+{
+    return __rdtsc();
+}
+#else
+#define BENCH_UNIT "ns"
+static unsigned long long Bench_Now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ULL + (unsigned long long)now.tv_nsec;
+}
+#endif
+
+#define BENCH_CODES   4096U
+#define BENCH_ROUNDS  2000U
+
+static volatile uint32 Bench_Divisor = TEMP_CONV_ADC_FULL_SCALE;
+
+/* Previous conversion, whole degrees */
+static uint32 Bench_OldConstant(uint16 usRaw)
+{
+    return (usRaw * 45UL) / TEMP_CONV_ADC_FULL_SCALE;
+}
+
+static uint32 Bench_OldRuntime(uint16 usRaw)
+{
+    return (usRaw * 45UL) / Bench_Divisor;
+}
+
+#define BENCH_TIME(label, expression)                                              \
+    do                                                                             \
+    {                                                                              \
+        unsigned long long ullStart = Bench_Now();                                 \
+        uint32 ulSum = 0;                                                          \
+        unsigned uRound;                                                           \
+        unsigned uCode;                                                            \
+        for (uRound = 0; uRound < BENCH_ROUNDS; uRound++)                          \
+        {                                                                          \
+            for (uCode = 0; uCode < BENCH_CODES; uCode++)                          \
+            {                                                                      \
+                ulSum += (uint32)(expression);                                     \
+            }                                                                      \
+        }                                                                          \
+        Bench_Sink = ulSum;                                                        \
+        printf("%-34s %6.2f %s/conversion\n", label,                               \
+               (double)(Bench_Now() - ullStart) / ((double)BENCH_ROUNDS * BENCH_CODES), BENCH_UNIT); \
+    } while (0)
+
+static volatile uint32 Bench_Sink;
+
+int main(void)
+{
+    double dExact;
+    double dOldError = 0.0;
+    double dNewError = 0.0;
+    unsigned uCode;
+
+    TempConv_Init();
+
+    for (uCode = 0; uCode < BENCH_CODES; uCode++)
+    {
+        dExact = (double)uCode * TEMP_CONV_SPAN_DECI_CELSIUS / TEMP_CONV_ADC_FULL_SCALE; /* 0.1 C */
+        dOldError = fmax(dOldError, fabs(Bench_OldConstant((uint16)uCode) * 10.0 - dExact));
+        dNewError = fmax(dNewError, fabs(TempConv_ToDeciCelsius(0, (uint16)uCode) - dExact));
+    }
+
+    BENCH_TIME("old (raw*45)/4095, constant", Bench_OldConstant((uint16)uCode));
+    BENCH_TIME("old (raw*45)/4095, runtime divide", Bench_OldRuntime((uint16)uCode));
+    BENCH_TIME("TempConv_ToDeciCelsius (Q16)", TempConv_ToDeciCelsius(0, (uint16)uCode));
+
+    printf("worst error: old %.2f C (1 C steps), new %.3f C (0.1 C steps)\n",
+           dOldError / 10.0, dNewError / 10.0);
+    return 0;
+}
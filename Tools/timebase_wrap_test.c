@@ -0,0 +1,133 @@
+/******************************************************************************
+ *
+ * Tool: timebase_wrap_test
+ *
+ * File Name: timebase_wrap_test.c
+ *
+ * Description: Host test of Timebase_Now (Services/Timebase.c is compiled in
+ *              unchanged) against a model of WTimer0A: the count wraps to 0
+ *              and raises the time-out flag on the same count, time moves on
+ *              between every register access, and the time-out interrupt
+ *              either runs at once, preempting the reader between two of its
+ *              accesses, or is held off for a while (a reader masking it).
+ *              Every timestamp must lie between the true time before and
+ *              after the call, so it never goes backwards or jumps a wrap.
+ *
+ *              Build: gcc -O2 -I../FreeRTOS_Project_SeatControllerSystem
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Common
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Services
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/GPTM
+ *                         -o timebase_wrap_test timebase_wrap_test.c
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "Timebase.c"
+
+#define TEST_CALLS          2000000UL
+#define TEST_NEAR_WRAP      64U         /* Ticks around a wrap where the steps get small */
+#define TEST_MAX_HOLD_OFF   8U          /* Register accesses the interrupt may be held off */
+
+/* The 32-bit counter, uint32 is wider on a 64-bit host */
+#define TEST_LOW(Time)      ((Time) & 0xFFFFFFFFULL)
+
+/* WTimer0A model */
+static uint64 Test_Time;                /* True ticks since Timebase_Init */
+static boolean Test_Pending;            /* RIS time-out flag */
+static uint32 Test_HoldOff;             /* Accesses left before the pending interrupt runs */
+static GPTM_CallbackType Test_Callback;
+static uint32 Test_Delayed;
+
+/* Time passes between two register accesses, a lot far from a wrap, little next to it and
+ * while the interrupt is held off (a critical section lasts us, a half period is minutes) */
+static void Test_Advance(void)
+{
+    uint64 ullToWrap = 0x100000000ULL - TEST_LOW(Test_Time);
+    uint64 ullStep = ((ullToWrap > TEST_NEAR_WRAP) && (FALSE == Test_Pending) && ((rand() % 4) != 0)) ?
+                     ((((uint64)rand() << 31) | (uint64)rand()) % (ullToWrap - TEST_NEAR_WRAP / 2U)) : (uint64)(rand() % 3);
+
+    if (ullStep >= ullToWrap)
+    {
+        Test_Pending = TRUE;
+        Test_HoldOff = ((rand() % 2) == 0) ? 0U : (uint32)(rand() % TEST_MAX_HOLD_OFF) + 1U;
+    }
+    Test_Time += ullStep;
+
+    /* The interrupt preempts the reader here, or later once it is unmasked */
+    if (TRUE == Test_Pending)
+    {
+        if (0U == Test_HoldOff)
+        {
+            Test_Pending = FALSE;
+            Test_Callback();
+        }
+        else
+        {
+            Test_HoldOff--;
+            Test_Delayed++;
+        }
+    }
+}
+
+void GPTM_WTimer0Init(uint16 usPrescaler, GPTM_CallbackType pOverflowCallback)
+{
+    (void)usPrescaler;
+    Test_Time = 1U;                     /* The first count after the reload */
+    Test_Pending = FALSE;
+    Test_Callback = pOverflowCallback;
+}
+
+uint32 GPTM_WTimer0Read(void)
+{
+    uint32 ulLow;
+
+    Test_Advance();
+    ulLow = (uint32)TEST_LOW(Test_Time);
+    Test_Advance();
+    return ulLow;
+}
+
+boolean GPTM_WTimer0OverflowPending(void)
+{
+    boolean bPending;
+
+    Test_Advance();
+    bPending = Test_Pending;
+    Test_Advance();
+    return bPending;
+}
+
+int main(void)
+{
+    Timebase_TicksType ullStamp;
+    Timebase_TicksType ullPrevious = 0;
+    uint64 ullBefore;
+    uint32 ulCall;
+    uint32 ulErrors = 0;
+
+    srand(1);
+    Timebase_Init();
+
+    for (ulCall = 0; ulCall < TEST_CALLS; ulCall++)
+    {
+        ullBefore = Test_Time;
+        ullStamp = Timebase_Now();
+        if ((ullStamp < ullBefore) || (ullStamp > Test_Time) || (ullStamp < ullPrevious))
+        {
+            if (ulErrors++ < 10U)
+            {
+                printf("call %lu: %llu not in [%llu, %llu], previous %llu\n", (unsigned long)ulCall,
+                       (unsigned long long)ullStamp, (unsigned long long)ullBefore,
+                       (unsigned long long)Test_Time, (unsigned long long)ullPrevious);
+            }
+        }
+        ullPrevious = ullStamp;
+    }
+
+    printf("%lu calls, %llu wraps, %lu register accesses with a wrap not counted yet, %lu errors\n",
+           (unsigned long)TEST_CALLS, (unsigned long long)(Test_Time >> 32),
+           (unsigned long)Test_Delayed, (unsigned long)ulErrors);
+    return (0U == ulErrors) ? 0 : 1;
+}
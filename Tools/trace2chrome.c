@@ -0,0 +1,467 @@
+/******************************************************************************
+ *
+ * Tool: trace2chrome
+ *
+ * File Name: trace2chrome.c
+ *
+ * Description: Host-side converter for the kernel event trace sent on UART0
+ *              when TRACE_OUTPUT is STD_ON (see Services/Trace.h). Reads a raw
+ *              capture (file or stdin), splits it on 0x00 delimiters,
+ *              COBS-decodes each frame, checks the CRC-16/CCITT-FALSE and
+ *              writes Chrome trace JSON for chrome://tracing or Perfetto:
+ *              - one track per task (kernel TCB number) with a slice for every
+ *                time it ran and instants for ready, delay, notify and waits
+ *              - one track per interrupt with a slice from entry to exit
+ *              - global instants where the target dropped events or frames
+ *                were lost on the line
+ *              The 32-bit timestamps are unwrapped, so consecutive events must
+ *              be less than one wrap (268 s at 16 MHz) apart. The record cost
+ *              measured by the target is printed on stderr.
+ *
+ *              Build: gcc -O2 -o trace2chrome trace2chrome.c
+ *              Usage: trace2chrome [capture.bin] > trace.json
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Must match Services/Trace.h */
+#define FRAME_EVENTS         0x81U
+#define FRAME_NAMES          0x82U
+#define EVENTS_HEADER_SIZE   8U
+#define NAMES_HEADER_SIZE    8U
+#define EVENT_SIZE           8U
+#define CRC_SIZE             2U
+#define MAX_FRAME_SIZE       512U
+
+#define EVENT_TASK_SWITCHED_IN  1U
+#define EVENT_TASK_READY        2U
+#define EVENT_TASK_DELAY        3U
+#define EVENT_TASK_DELAY_UNTIL  4U
+#define EVENT_NOTIFY            5U
+#define EVENT_NOTIFY_FROM_ISR   6U
+#define EVENT_NOTIFY_WAIT       7U
+#define EVENT_GROUP_SET_BITS    8U
+#define EVENT_GROUP_WAIT_BITS   9U
+#define EVENT_ISR_ENTER         10U
+#define EVENT_ISR_EXIT          11U
+
+/* Used until the first names frame, TIMEBASE_TICKS_PER_SECOND of the default build */
+#define DEFAULT_TICKS_PER_SECOND 16000000UL
+
+#define TASK_PROCESS         1
+#define ISR_PROCESS          2
+#define MAX_TASKS            256U
+#define MAX_VECTORS          512U
+#define MAX_ISR_NESTING      8U
+
+/* Exception numbers (IRQ + 16) of the traced MCAL handlers */
+static const struct
+{
+    uint16_t vector;
+    const char *pName;
+} IsrNames[] = {
+    { 30U, "ADC0_Seq0" }, { 46U, "GPIOPortF" }, { 110U, "WTimer0A" }
+};
+
+static char TaskNames[MAX_TASKS][32];
+static uint8_t TaskSeen[MAX_TASKS];
+static uint8_t VectorSeen[MAX_VECTORS];
+
+static double TicksPerSecond = DEFAULT_TICKS_PER_SECOND;
+static uint32_t RecordCost = 0;
+
+/* Timestamp unwrapping and the open slices */
+static uint64_t Base = 0;
+static uint32_t LastStamp = 0;
+static int HaveStamp = 0;
+static int Running = -1;
+static uint64_t RunStart = 0;
+static uint16_t IsrVector[MAX_ISR_NESTING];
+static uint64_t IsrStart[MAX_ISR_NESTING];
+static uint32_t IsrDepth = 0;
+
+static uint32_t Dropped = 0;
+static uint16_t NextSequence = 0;
+static int HaveSequence = 0;
+static unsigned long Events = 0;
+static unsigned long LostFrames = 0;
+static int FirstJson = 1;
+
+static uint16_t Crc16(const uint8_t *pData, uint32_t length)
+{
+    uint16_t crc = 0xFFFF;
+    uint8_t bit;
+
+    while (length-- > 0U)
+    {
+        crc ^= (uint16_t)(*pData++) << 8;
+        for (bit = 0; bit < 8U; bit++)
+        {
+            crc = (crc & 0x8000U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+/* Returns the decoded length, or 0 if the frame is malformed */
+static uint32_t CobsDecode(const uint8_t *pIn, uint32_t length, uint8_t *pOut)
+{
+    uint32_t read = 0;
+    uint32_t write = 0;
+    uint8_t code;
+    uint8_t i;
+
+    while (read < length)
+    {
+        code = pIn[read++];
+        if (code == 0U || (read + code - 1U) > length)
+        {
+            return 0;
+        }
+        for (i = 1; i < code; i++)
+        {
+            pOut[write++] = pIn[read++];
+        }
+        if (code != 0xFFU && read < length)
+        {
+            pOut[write++] = 0x00;
+        }
+    }
+    return write;
+}
+
+static uint16_t GetU16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t GetU32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/* Chrome trace timestamps are microseconds */
+static double ToUs(uint64_t ticks)
+{
+    return (double)ticks * 1000000.0 / TicksPerSecond;
+}
+
+static void JsonSeparator(void)
+{
+    printf(FirstJson ? "\n" : ",\n");
+    FirstJson = 0;
+}
+
+static void Slice(int pid, unsigned tid, const char *pName, uint64_t start, uint64_t end)
+{
+    JsonSeparator();
+    printf("{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%u,\"ts\":%.4f,\"dur\":%.4f}",
+           pName, pid, tid, ToUs(start), ToUs(end) - ToUs(start));
+}
+
+static void Instant(int pid, unsigned tid, const char *pName, const char *pArgName, unsigned long argument, uint64_t time)
+{
+    JsonSeparator();
+    printf("{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":%d,\"tid\":%u,\"ts\":%.4f,\"args\":{\"%s\":%lu}}",
+           pName, pid, tid, ToUs(time), pArgName, argument);
+}
+
+static void GlobalInstant(const char *pName, unsigned long count, uint64_t time)
+{
+    JsonSeparator();
+    printf("{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"g\",\"pid\":%d,\"tid\":0,\"ts\":%.4f,\"args\":{\"count\":%lu}}",
+           pName, TASK_PROCESS, ToUs(time), count);
+}
+
+static const char *TaskName(unsigned task)
+{
+    return (TaskNames[task][0] != '\0') ? TaskNames[task] : "task";
+}
+
+static void HandleEvent(const uint8_t *p)
+{
+    uint32_t stamp = GetU32(p);
+    uint8_t event = p[4];
+    uint8_t task = p[5];
+    uint16_t argument = GetU16(p + 6);
+    uint64_t now;
+
+    if (HaveStamp && stamp < LastStamp)
+    {
+        Base += 0x100000000ULL;
+    }
+    HaveStamp = 1;
+    LastStamp = stamp;
+    now = Base + stamp;
+    Events++;
+
+    switch (event)
+    {
+    case EVENT_TASK_SWITCHED_IN:
+        if (Running >= 0)
+        {
+            Slice(TASK_PROCESS, (unsigned)Running, TaskName((unsigned)Running), RunStart, now);
+        }
+        Running = task;
+        RunStart = now;
+        TaskSeen[task] = 1;
+        break;
+    case EVENT_TASK_READY:
+        Instant(TASK_PROCESS, task, "ready", "priority", argument, now);
+        TaskSeen[task] = 1;
+        break;
+    case EVENT_TASK_DELAY:
+    case EVENT_TASK_DELAY_UNTIL:
+        Instant(TASK_PROCESS, task, (event == EVENT_TASK_DELAY) ? "delay" : "block", "ticks", argument, now);
+        TaskSeen[task] = 1;
+        break;
+    case EVENT_NOTIFY:
+    case EVENT_NOTIFY_FROM_ISR:
+        Instant(TASK_PROCESS, task, (event == EVENT_NOTIFY) ? "notified" : "notified from ISR", "index", argument, now);
+        TaskSeen[task] = 1;
+        break;
+    case EVENT_NOTIFY_WAIT:
+        Instant(TASK_PROCESS, task, "wait notification", "index", argument, now);
+        TaskSeen[task] = 1;
+        break;
+    case EVENT_GROUP_SET_BITS:
+    case EVENT_GROUP_WAIT_BITS:
+        /* Recorded without the task, shown on the running one */
+        Instant(TASK_PROCESS, (Running >= 0) ? (unsigned)Running : 0U,
+                (event == EVENT_GROUP_SET_BITS) ? "event group set" : "event group wait", "bits", argument, now);
+        break;
+    case EVENT_ISR_ENTER:
+        if (IsrDepth < MAX_ISR_NESTING)
+        {
+            IsrVector[IsrDepth] = argument;
+            IsrStart[IsrDepth] = now;
+        }
+        IsrDepth++;
+        break;
+    case EVENT_ISR_EXIT:
+        /* An exit without its entry (capture started inside the handler) is skipped */
+        if (IsrDepth > 0U)
+        {
+            IsrDepth--;
+            if (IsrDepth < MAX_ISR_NESTING && IsrVector[IsrDepth] == argument && argument < MAX_VECTORS)
+            {
+                Slice(ISR_PROCESS, argument, "ISR", IsrStart[IsrDepth], now);
+                VectorSeen[argument] = 1;
+            }
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static int HandleEventsFrame(const uint8_t *p, uint32_t length)
+{
+    uint16_t sequence;
+    uint32_t dropped;
+    uint8_t count;
+    uint8_t i;
+
+    if (length < EVENTS_HEADER_SIZE)
+    {
+        return 0;
+    }
+    count = p[7];
+    if (length != EVENTS_HEADER_SIZE + (count * EVENT_SIZE))
+    {
+        return 0;
+    }
+    sequence = GetU16(p + 1);
+    dropped = GetU32(p + 3);
+
+    if (HaveSequence && sequence != NextSequence)
+    {
+        LostFrames += (uint16_t)(sequence - NextSequence);
+        GlobalInstant("frames lost", (uint16_t)(sequence - NextSequence), Base + LastStamp);
+    }
+    HaveSequence = 1;
+    NextSequence = (uint16_t)(sequence + 1U);
+
+    /* The newest events were dropped, the gap lies between the last events sent and these */
+    if (dropped > Dropped)
+    {
+        GlobalInstant("events dropped", dropped - Dropped, Base + LastStamp);
+        Dropped = dropped;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        HandleEvent(p + EVENTS_HEADER_SIZE + (i * EVENT_SIZE));
+    }
+    return 1;
+}
+
+static int HandleNamesFrame(const uint8_t *p, uint32_t length)
+{
+    uint32_t offset = NAMES_HEADER_SIZE;
+    uint8_t count;
+    uint8_t task;
+    uint8_t nameLength;
+    uint8_t i;
+
+    if (length < NAMES_HEADER_SIZE || GetU32(p + 1) == 0U)
+    {
+        return 0;
+    }
+    TicksPerSecond = (double)GetU32(p + 1);
+    RecordCost = GetU16(p + 5);
+    count = p[7];
+
+    for (i = 0; i < count; i++)
+    {
+        if (offset + 2U > length)
+        {
+            return 0;
+        }
+        task = p[offset];
+        nameLength = p[offset + 1U];
+        if (offset + 2U + nameLength > length || nameLength >= sizeof(TaskNames[0]))
+        {
+            return 0;
+        }
+        memcpy(TaskNames[task], p + offset + 2U, nameLength);
+        TaskNames[task][nameLength] = '\0';
+        offset += 2U + nameLength;
+    }
+    return offset == length;
+}
+
+static int HandleFrame(const uint8_t *p, uint32_t length)
+{
+    if (length <= CRC_SIZE || Crc16(p, length - CRC_SIZE) != GetU16(p + length - CRC_SIZE))
+    {
+        return 0;
+    }
+    length -= CRC_SIZE;
+    if (p[0] == FRAME_EVENTS)
+    {
+        return HandleEventsFrame(p, length);
+    }
+    if (p[0] == FRAME_NAMES)
+    {
+        return HandleNamesFrame(p, length);
+    }
+    return 0;
+}
+
+static void PrintMetadata(void)
+{
+    unsigned i;
+    unsigned j;
+    const char *pName;
+
+    JsonSeparator();
+    printf("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"Tasks\"}}", TASK_PROCESS);
+    JsonSeparator();
+    printf("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"Interrupts\"}}", ISR_PROCESS);
+    for (i = 0; i < MAX_TASKS; i++)
+    {
+        if (TaskSeen[i])
+        {
+            JsonSeparator();
+            printf("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,\"args\":{\"name\":\"%u %s\"}}",
+                   TASK_PROCESS, i, i, TaskName(i));
+        }
+    }
+    for (i = 0; i < MAX_VECTORS; i++)
+    {
+        if (VectorSeen[i])
+        {
+            pName = NULL;
+            for (j = 0; j < sizeof(IsrNames) / sizeof(IsrNames[0]); j++)
+            {
+                if (IsrNames[j].vector == i)
+                {
+                    pName = IsrNames[j].pName;
+                }
+            }
+            JsonSeparator();
+            if (pName != NULL)
+            {
+                printf("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                       ISR_PROCESS, i, pName);
+            }
+            else
+            {
+                printf("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,\"args\":{\"name\":\"IRQ %u\"}}",
+                       ISR_PROCESS, i, i - 16U);
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    FILE *pFile = stdin;
+    uint8_t frame[MAX_FRAME_SIZE];
+    uint8_t payload[MAX_FRAME_SIZE];
+    uint32_t frameLength = 0;
+    uint32_t payloadLength;
+    unsigned long good = 0;
+    unsigned long bad = 0;
+    int c;
+
+    if (argc > 1 && (pFile = fopen(argv[1], "rb")) == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    printf("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    while ((c = fgetc(pFile)) != EOF)
+    {
+        if (c != 0)
+        {
+            if (frameLength < MAX_FRAME_SIZE)
+            {
+                frame[frameLength] = (uint8_t)c;
+            }
+            frameLength++;
+            continue;
+        }
+
+        /* The first frame of a capture is usually cut, it fails the checks like any corrupted one */
+        if (frameLength > 0U)
+        {
+            payloadLength = (frameLength <= MAX_FRAME_SIZE) ? CobsDecode(frame, frameLength, payload) : 0U;
+            if (HandleFrame(payload, payloadLength))
+            {
+                good++;
+            }
+            else
+            {
+                bad++;
+            }
+        }
+        frameLength = 0;
+    }
+
+    /* Close the slice of the task still running at the end of the capture */
+    if (Running >= 0 && HaveStamp)
+    {
+        Slice(TASK_PROCESS, (unsigned)Running, TaskName((unsigned)Running), RunStart, Base + LastStamp);
+    }
+    PrintMetadata();
+    printf("\n]}\n");
+
+    fprintf(stderr, "%lu frames decoded, %lu frames dropped, %lu frames lost on the line\n", good, bad, LostFrames);
+    fprintf(stderr, "%lu events, %lu dropped by the target\n", Events, (unsigned long)Dropped);
+    if (RecordCost != 0U)
+    {
+        fprintf(stderr, "record cost %lu ticks = %.0f ns per event (%.0f Hz timebase)\n",
+                (unsigned long)RecordCost, (double)RecordCost * 1e9 / TicksPerSecond, TicksPerSecond);
+    }
+    if (pFile != stdin)
+    {
+        fclose(pFile);
+    }
+    return 0;
+}
@@ -0,0 +1,452 @@
+/******************************************************************************
+ *
+ * Tool: uart_tx_bench
+ *
+ * File Name: uart_tx_bench.c
+ *
+ * Description: Host throughput and CPU cost benchmark of the interrupt driven
+ *              UART0 transmit path. MCAL/UART/uart0.c is compiled in unchanged
+ *              on the emulated peripheral block (MCAL/hw_sim.c) with the kernel
+ *              calls stubbed. The emulated UART adds what plain register memory
+ *              cannot do: a byte written to UARTDR enters a 16-byte transmit
+ *              FIFO, UARTFR reports it full, the line shifts one byte out every
+ *              10 bit times at UART0_BAUD_RATE and the TX interrupt runs
+ *              UART0_Handler when the FIFO level drops to the UARTIFLS trigger.
+ *              The line only moves while the sender is blocked on the full
+ *              ring (or polls it before the scheduler runs): the CPU is taken
+ *              as infinitely fast against the 9600 baud line.
+ *
+ *              Checked are:
+ *              1. Before the scheduler: a string longer than the ring is sent
+ *                 by polling the FIFO, without the mutex.
+ *              2. BENCH_FRAMES dashboard frames of about 1 KB, every byte on
+ *                 the line in order, the FIFO never empty while the ring holds
+ *                 bytes (the line runs at the full baud rate), never written
+ *                 while full, about one interrupt per 8 bytes.
+ *              3. A second task sending while the first one is blocked on the
+ *                 full ring: its line waits for the mutex and follows the
+ *                 first call whole.
+ *              It reports the host time spent in the driver (the send calls
+ *              and UART0_Handler, the emulated register accesses included),
+ *              the interrupts and register accesses per byte, and the CPU the
+ *              busy-wait UART0_SendByte spent on the same frame: the whole line
+ *              time, as it spun on TXFE for every byte with the FIFO disabled.
+ *
+ *              Build: gcc -O2 -DTM4C_HOST_SIM
+ *                         -I../FreeRTOS_Project_SeatControllerSystem
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/Common
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/MCAL/UART
+ *                         -I../FreeRTOS_Project_SeatControllerSystem/FreeRTOS/Source/include
+ *                         -o uart_tx_bench uart_tx_bench.c
+ *
+ * Author: Mohamed Hassan
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_FRAMES            20U
+#define BENCH_FRAME_ROWS        34U         /* Cursor move, label and value per row, as Dashboard.c */
+#define BENCH_OUTPUT_SIZE       65536U
+#define BENCH_FIFO_SIZE         16U
+#define BENCH_FIFO_TRIGGER      8U          /* UART_IFLS_TX4_8 */
+#define BENCH_DR_EMPTY          0xFFFFFFFFUL /* UARTDR holds no byte the FIFO did not take yet */
+
+#define BENCH_UART0_DR          0x4000C000UL
+#define BENCH_UART0_FR          0x4000C018UL
+
+/* The kernel as the driver sees it: one sending task at a time runs, the
+ * scheduler only decides whether the driver may block */
+#define INC_FREERTOS_H
+#define INC_TASK_H
+#define SEMAPHORE_H
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef unsigned long TickType_t;
+typedef void * TaskHandle_t;
+typedef struct { int iHeld; } * SemaphoreHandle_t;
+#define pdFALSE                             ( ( BaseType_t ) 0 )
+#define pdTRUE                              ( ( BaseType_t ) 1 )
+#define portMAX_DELAY                       ( ( TickType_t ) 0xffffffffUL )
+#define taskSCHEDULER_NOT_STARTED           ( ( BaseType_t ) 1 )
+#define taskSCHEDULER_RUNNING               ( ( BaseType_t ) 2 )
+#define configUSE_MUTEXES                   1
+#define configSUPPORT_STATIC_ALLOCATION     0
+#define configASSERT( x )                   if( ( x ) == 0 ) { printf( "FAIL assert %s\n", #x ); exit( 1 ); }
+#define portYIELD_FROM_ISR( x )             ( ( void ) ( x ) )
+static BaseType_t xTaskGetSchedulerState( void );
+static TaskHandle_t xTaskGetCurrentTaskHandle( void );
+static uint32_t ulTaskNotifyTakeIndexed( UBaseType_t uxIndexToWait, BaseType_t xClearCountOnExit, TickType_t xTicksToWait );
+static void vTaskNotifyGiveIndexedFromISR( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, BaseType_t *pxHigherPriorityTaskWoken );
+static SemaphoreHandle_t xSemaphoreCreateMutex( void );
+static BaseType_t xSemaphoreTake( SemaphoreHandle_t xSemaphore, TickType_t xBlockTime );
+static BaseType_t xSemaphoreGive( SemaphoreHandle_t xSemaphore );
+
+/* hw_sim.c backs the registers, the emulated UART sits in front of it */
+#define Sim_PeripheralAddress Sim_PageAddress
+#include "hw_sim.c"
+#undef Sim_PeripheralAddress
+volatile uint32 * Sim_PeripheralAddress(uint32 address);
+
+#include "uart0.c"
+
+/* Emulated UART0 */
+static uint8 Bench_Fifo[BENCH_FIFO_SIZE];
+static uint32 Bench_FifoHead;
+static uint32 Bench_FifoLevel;
+static uint64 Bench_LineBytes;                /* Byte times elapsed on the line */
+static uint64 Bench_LineBusyBytes;            /* Byte times a byte was shifted out */
+static uint32 Bench_Starvations;              /* Byte times the FIFO was empty with bytes in the ring */
+static uint32 Bench_FifoOverruns;             /* UARTDR written with the FIFO full */
+static uint32 Bench_Interrupts;
+static uint64 Bench_RegisterAccesses;
+static uint8 Bench_Line[BENCH_OUTPUT_SIZE];    /* Every byte shifted out */
+static uint32 Bench_LineLength;
+static uint8 Bench_Expected[BENCH_OUTPUT_SIZE]; /* Every byte the bench asked the driver to send */
+static uint32 Bench_ExpectedLength;
+
+/* Emulated kernel */
+static BaseType_t Bench_SchedulerState = taskSCHEDULER_NOT_STARTED;
+static uint32 Bench_CurrentTask = 1U;
+static boolean Bench_Notified;
+static uint32 Bench_Blocks;
+static uint64 Bench_BlockedBytes;              /* Byte times the sender was blocked */
+static struct { int iHeld; } Bench_Mutex;
+static uint32 Bench_MutexTakes;
+static uint32 Bench_MutexContended;
+static const char *Bench_WaitingLine;          /* Line of the second task, blocked on the mutex */
+static const char *Bench_SecondLine;           /* Line the second task sends at the first block */
+
+/* Host time */
+static uint64 Bench_LineNs;                    /* Spent emulating the line, not in the driver */
+static uint64 Bench_HandlerNs;
+static uint32 Bench_Failures;
+
+static uint64 Bench_NowNs(void)
+{
+    struct timespec xNow;
+    clock_gettime(CLOCK_MONOTONIC, &xNow);
+    return (uint64)xNow.tv_sec * 1000000000ULL + (uint64)xNow.tv_nsec;
+}
+
+static void Bench_Expect(const char *pName, boolean bOk)
+{
+    if (FALSE == bOk)
+    {
+        printf("FAIL %s\n", pName);
+        Bench_Failures++;
+    }
+}
+
+/* Move a byte the driver wrote to UARTDR into the FIFO. The write lands after
+ * Sim_PeripheralAddress returned, so it is taken at the next register access */
+static void Bench_TakeDataRegister(void)
+{
+    volatile uint32 *pDr = Sim_PageAddress(BENCH_UART0_DR);
+
+    if (BENCH_DR_EMPTY != *pDr)
+    {
+        if (BENCH_FIFO_SIZE == Bench_FifoLevel)
+        {
+            Bench_FifoOverruns++;
+        }
+        else
+        {
+            Bench_Fifo[(Bench_FifoHead + Bench_FifoLevel) % BENCH_FIFO_SIZE] = (uint8)*pDr;
+            Bench_FifoLevel++;
+        }
+        *pDr = BENCH_DR_EMPTY;
+    }
+}
+
+static void Bench_RunHandler(void)
+{
+    uint64 ullStart = Bench_NowNs();
+
+    Bench_Interrupts++;
+    UART0_Handler();
+    Bench_TakeDataRegister();
+    Bench_HandlerNs += Bench_NowNs() - ullStart;
+}
+
+/* One byte time of the line: shift a byte out of the FIFO, raise the TX interrupt at the trigger level */
+static void Bench_LineStep(void)
+{
+    Bench_TakeDataRegister();
+    Bench_LineBytes++;
+    if (0U == Bench_FifoLevel)
+    {
+        if (UART0_TxHead != UART0_TxTail)
+        {
+            Bench_Starvations++;
+        }
+        return;
+    }
+
+    if (Bench_LineLength < BENCH_OUTPUT_SIZE)
+    {
+        Bench_Line[Bench_LineLength++] = Bench_Fifo[Bench_FifoHead];
+    }
+    Bench_FifoHead = (Bench_FifoHead + 1U) % BENCH_FIFO_SIZE;
+    Bench_FifoLevel--;
+    Bench_LineBusyBytes++;
+
+    if ((BENCH_FIFO_TRIGGER == Bench_FifoLevel) && (0U != (UART0_IM_REG & UART_IM_TXIM_MASK)))
+    {
+        Bench_RunHandler();
+    }
+}
+
+volatile uint32 * Sim_PeripheralAddress(uint32 address)
+{
+    volatile uint32 *pRegister;
+    uint64 ullStart;
+
+    Bench_RegisterAccesses++;
+    Bench_TakeDataRegister();
+    pRegister = Sim_PageAddress(address);
+    if (BENCH_UART0_FR == address)
+    {
+        /* Polling a full FIFO before the scheduler runs waits for the line */
+        if ((BENCH_FIFO_SIZE == Bench_FifoLevel) && (taskSCHEDULER_RUNNING != Bench_SchedulerState))
+        {
+            ullStart = Bench_NowNs();
+            Bench_LineStep();
+            Bench_LineNs += Bench_NowNs() - ullStart;
+        }
+        *pRegister = UART_FR_RXFE_MASK | ((0U == Bench_FifoLevel) ? UART_FR_TXFE_MASK : 0U) |
+                     ((BENCH_FIFO_SIZE == Bench_FifoLevel) ? UART_FR_TXFF_MASK : 0U);
+    }
+    return pRegister;
+}
+
+static BaseType_t xTaskGetSchedulerState(void)
+{
+    return Bench_SchedulerState;
+}
+
+static TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return (TaskHandle_t)&Bench_CurrentTask;
+}
+
+/* The sending task blocks on the full ring: the line runs until UART0_Handler
+ * gives the notification, the second task gets its turn at the first block */
+static uint32_t ulTaskNotifyTakeIndexed(UBaseType_t uxIndexToWait, BaseType_t xClearCountOnExit, TickType_t xTicksToWait)
+{
+    uint64 ullStart = Bench_NowNs();
+    uint64 ullBlockStart = Bench_LineBytes;
+    const char *pLine = Bench_SecondLine;
+
+    (void)xClearCountOnExit;
+    (void)xTicksToWait;
+    configASSERT(UART0_TX_NOTIFY_INDEX == uxIndexToWait);
+    Bench_Blocks++;
+
+    if (NULL != pLine)
+    {
+        Bench_SecondLine = NULL;
+        if (0 != Bench_Mutex.iHeld)
+        {
+            Bench_WaitingLine = pLine; /* Its xSemaphoreTake blocks */
+            Bench_MutexContended++;
+        }
+        else
+        {
+            Bench_LineNs += Bench_NowNs() - ullStart;
+            UART0_SendString((const uint8 *)pLine);
+            ullStart = Bench_NowNs();
+        }
+    }
+
+    while (FALSE == Bench_Notified)
+    {
+        Bench_LineStep();
+        configASSERT((Bench_LineBytes - ullBlockStart) < (2U * UART0_TX_BUFFER_SIZE)); /* Never woken */
+    }
+    Bench_Notified = FALSE;
+    Bench_BlockedBytes += Bench_LineBytes - ullBlockStart;
+    Bench_LineNs += Bench_NowNs() - ullStart;
+    return 1U;
+}
+
+static void vTaskNotifyGiveIndexedFromISR(TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, BaseType_t *pxHigherPriorityTaskWoken)
+{
+    configASSERT((TaskHandle_t)&Bench_CurrentTask == xTaskToNotify);
+    configASSERT(UART0_TX_NOTIFY_INDEX == uxIndexToNotify);
+    Bench_Notified = TRUE;
+    *pxHigherPriorityTaskWoken = pdTRUE;
+}
+
+static SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return (SemaphoreHandle_t)&Bench_Mutex;
+}
+
+/* The running task never finds the mutex held: it does not take it twice */
+static BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xBlockTime)
+{
+    configASSERT(portMAX_DELAY == xBlockTime);
+    configASSERT(0 == xSemaphore->iHeld);
+    Bench_MutexTakes++;
+    xSemaphore->iHeld = 1;
+    return pdTRUE;
+}
+
+/* A task waiting for the mutex gets it and runs its call */
+static BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore)
+{
+    const char *pLine = Bench_WaitingLine;
+
+    configASSERT(0 != xSemaphore->iHeld);
+    xSemaphore->iHeld = 0;
+    if (NULL != pLine)
+    {
+        Bench_WaitingLine = NULL;
+        UART0_SendString((const uint8 *)pLine);
+    }
+    return pdTRUE;
+}
+
+/* Queue text through the driver and note what the line has to carry */
+static void Bench_SendString(const char *pText)
+{
+    UART0_SendString((const uint8 *)pText);
+    memcpy(&Bench_Expected[Bench_ExpectedLength], pText, strlen(pText));
+    Bench_ExpectedLength += (uint32)strlen(pText);
+}
+
+static void Bench_SendInteger(sint64 sValue)
+{
+    UART0_SendInteger(sValue);
+    Bench_ExpectedLength += (uint32)sprintf((char *)&Bench_Expected[Bench_ExpectedLength], "%lld", (long long)sValue);
+}
+
+/* Let the line send everything queued, as the dashboard task sleeps between frames */
+static void Bench_Drain(void)
+{
+    uint64 ullStart = Bench_NowNs();
+
+    while ((0U != Bench_FifoLevel) || (UART0_TxHead != UART0_TxTail) ||
+           (BENCH_DR_EMPTY != *Sim_PageAddress(BENCH_UART0_DR)))
+    {
+        Bench_LineStep();
+        if ((0U == Bench_FifoLevel) && (UART0_TxHead != UART0_TxTail))
+        {
+            /* Below the trigger the interrupt does not come again, the next send kicks the FIFO */
+            break;
+        }
+    }
+    Bench_LineNs += Bench_NowNs() - ullStart;
+}
+
+/* About 1 KB: per row a cursor move, a label and a value, as the dashboard fields */
+static void Bench_SendFrame(uint32 ulFrame)
+{
+    char aMove[16];
+    uint32 ulRow;
+
+    Bench_SendString("\033[2J\033[H Seat heater controller\r\n");
+    for (ulRow = 0; ulRow < BENCH_FRAME_ROWS; ulRow++)
+    {
+        (void)sprintf(aMove, "\033[%u;%uH", (unsigned)(ulRow + 2U), 4U);
+        Bench_SendString(aMove);
+        Bench_SendString("Task time [ms]: ");
+        Bench_SendInteger((sint64)(ulFrame * 1000U + ulRow * 37U) - 500);
+        Bench_SendString("   ");
+    }
+}
+
+static boolean Bench_LineMatches(void)
+{
+    return (Bench_LineLength == Bench_ExpectedLength) && (0 == memcmp(Bench_Line, Bench_Expected, Bench_LineLength));
+}
+
+int main(void)
+{
+    static char aLong[600 + 1];
+    uint64 ullStart;
+    uint64 ullDriverNs = 0;
+    uint64 ullFrameLineBytes = 0;
+    uint64 ullFrameBusyBytes = 0;
+    uint64 ullLineBefore;
+    uint64 ullBusyBefore;
+    uint64 ullLineNsBefore;
+    uint32 ulFrameBytes;
+    uint32 ulBytes;
+    uint32 ulFrame;
+    double dByteUs = 10.0 * 1e6 / (double)UART0_BAUD_RATE;
+
+    *Sim_PageAddress(BENCH_UART0_DR) = BENCH_DR_EMPTY; /* Before the first access takes it as a byte */
+    UART0_Init();
+    Bench_Expect("UART0 IFLS at the FIFO half", UART_IFLS_TX4_8 == UART0_IFLS_REG);
+
+    /* 1. Before the scheduler: polled, no mutex */
+    memset(aLong, 'b', sizeof(aLong) - 1U);
+    Bench_SendString(aLong);
+    Bench_Drain();
+    Bench_Expect("boot string on the line", Bench_LineMatches());
+    Bench_Expect("no mutex before the scheduler", 0U == Bench_MutexTakes);
+
+    /* 2. Dashboard frames */
+    Bench_SchedulerState = taskSCHEDULER_RUNNING;
+    ulBytes = Bench_ExpectedLength;
+    Bench_Interrupts = 0;
+    Bench_RegisterAccesses = 0;
+    Bench_Blocks = 0;
+    Bench_BlockedBytes = 0;
+    Bench_Starvations = 0;
+    for (ulFrame = 0; ulFrame < BENCH_FRAMES; ulFrame++)
+    {
+        ullLineBefore = Bench_LineBytes;
+        ullBusyBefore = Bench_LineBusyBytes;
+        ullLineNsBefore = Bench_LineNs + Bench_HandlerNs;
+        ullStart = Bench_NowNs();
+        Bench_SendFrame(ulFrame);
+        Bench_Drain();
+        ullDriverNs += (Bench_NowNs() - ullStart) - ((Bench_LineNs + Bench_HandlerNs) - ullLineNsBefore);
+        ullFrameLineBytes += Bench_LineBytes - ullLineBefore;
+        ullFrameBusyBytes += Bench_LineBusyBytes - ullBusyBefore;
+    }
+    ullDriverNs += Bench_HandlerNs;
+    ulBytes = Bench_ExpectedLength - ulBytes;
+    ulFrameBytes = ulBytes / BENCH_FRAMES;
+
+    Bench_Expect("frames on the line in order", Bench_LineMatches());
+    Bench_Expect("FIFO never starved with bytes in the ring", 0U == Bench_Starvations);
+    Bench_Expect("line busy the whole frame", ullFrameBusyBytes == ullFrameLineBytes);
+    Bench_Expect("UARTDR never written with the FIFO full", 0U == Bench_FifoOverruns);
+    Bench_Expect("about one interrupt per 8 bytes", (Bench_Interrupts * 8U <= ulBytes) && (Bench_Interrupts * 8U + BENCH_FRAMES * 16U >= ulBytes));
+    Bench_Expect("mutex given back", 0 == Bench_Mutex.iHeld);
+
+    printf("UART0 at %lu baud, %u-byte ring, %u frames of %u bytes\n", (unsigned long)UART0_BAUD_RATE,
+           (unsigned)UART0_TX_BUFFER_SIZE, (unsigned)BENCH_FRAMES, (unsigned)ulFrameBytes);
+    printf("  line time per frame          %10.1f ms, %.1f %% busy\n", (double)ulFrameBytes * dByteUs / 1000.0,
+           100.0 * (double)ullFrameBusyBytes / (double)ullFrameLineBytes);
+    printf("  sender blocked per frame     %10.1f ms (%u blocks), the ring full\n",
+           (double)Bench_BlockedBytes * dByteUs / 1000.0 / BENCH_FRAMES, (unsigned)(Bench_Blocks / BENCH_FRAMES));
+    printf("  interrupts per frame         %10.1f\n", (double)Bench_Interrupts / BENCH_FRAMES);
+    printf("  register accesses per byte   %10.2f\n", (double)Bench_RegisterAccesses / (double)ulBytes);
+    printf("  driver CPU per frame (host)  %10.1f us, %.1f ns per byte\n", (double)ullDriverNs / 1000.0 / BENCH_FRAMES,
+           (double)ullDriverNs / (double)ulBytes);
+    printf("  busy-wait SendByte CPU/frame %10.1f ms, the whole line time\n", (double)ulFrameBytes * dByteUs / 1000.0);
+
+    /* 3. A second task sends while the first one waits for ring space */
+    Bench_SecondLine = "\r\n[second task]\r\n";
+    Bench_MutexContended = 0;
+    ulBytes = Bench_ExpectedLength;
+    Bench_SendString(aLong);
+    memcpy(&Bench_Expected[Bench_ExpectedLength], "\r\n[second task]\r\n", strlen("\r\n[second task]\r\n"));
+    Bench_ExpectedLength += (uint32)strlen("\r\n[second task]\r\n");
+    Bench_Drain();
+    Bench_Expect("second task waited for the mutex", 1U == Bench_MutexContended);
+    Bench_Expect("second line after the first call, whole", Bench_LineMatches());
+    Bench_Expect("mutex given back after both", 0 == Bench_Mutex.iHeld);
+    printf("  contended send               %10u bytes, then the second line whole\n", (unsigned)(Bench_ExpectedLength - ulBytes));
+
+    printf("%s: %u failures\n", (0U == Bench_Failures) ? "PASS" : "FAIL", (unsigned)Bench_Failures);
+    return (0U == Bench_Failures) ? 0 : 1;
+}